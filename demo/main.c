@@ -4,6 +4,8 @@
  */
 #include "GL/freeglut.h"
 #include "src/app.h"
+#include <ace/math/mat4.h>
+#include <ace/math/math.h>
 
 //--------------------------------------------------------------------------------------------------
 // Forward Declatations
@@ -61,11 +63,12 @@ void opengl_init(void)
 
 void set_projection_matrix(int width, int height)
 {
-    GLdouble fov     = 38.0;  // degrees
-    GLdouble aspect  = 1.0 * ((GLdouble) width / (GLdouble) height);
-    GLdouble nearVal = 0.5;
-    GLdouble farVal  = 500.0;
-    gluPerspective(fov, aspect, nearVal, farVal);
+    float   fov        = 38.0f;  // degrees
+    float   aspect     = (float) width / (float) height;
+    float   nearVal    = 0.5f;
+    float   farVal     = 500.0f;
+    ac_mat4 projection = ac_mat4_perspective(ac_deg_to_rad(fov), aspect, nearVal, farVal);
+    glMultMatrixf(projection.data);
 }
 
 void resize_window(int w, int h)
@@ -11,6 +11,7 @@
 #include <GL/freeglut.h>
 #include <ace/core/string.h>
 #include <ace/geometry/shapes.h>
+#include <ace/math/mat4.h>
 #include <ace/math/math.h>
 #include <ace/math/vec3.h>
 #include <ace/physics/phys_world.h>
@@ -28,7 +29,7 @@ float get_surface_roughness_from_terminal(void);
 void  get_config_from_user(void);
 
 // game logic
-void ball_collision_callback(unsigned, unsigned);
+void ball_collision_callback(PhysWorld*, unsigned, unsigned);
 void reset_target_ball_if_sleeping(void);
 void update_cue_stick_visibility(void);
 void detect_balls_off_table(void);
@@ -147,9 +148,16 @@ frame_time* app_init(void)
     initialise_frame_time(&app->timer);
     initialise_orbit_camera(&app->main_camera);
     initialise_physics_world(&app->physics_world, app->timer.update_rate);
+    app->physics_world.userData = app;
+
+    // the cloth grips the balls so they roll, and its roughness is what brings them to rest
+    static const float max_rolling_friction = 0.02f;
+    app->physics_world.friction             = 0.2f;
+    app->physics_world.rollingFriction      = app->surface_roughness * max_rolling_friction;
 
     // table must be initialised before balls
     initialise_pool_table(&app->physics_world, &app->table);
+    phys_bake_static(&app->physics_world);  // the table never moves
     initialise_pool_balls(
         &app->physics_world,
         &app->balls,
@@ -168,48 +176,23 @@ frame_time* app_init(void)
     return &app->timer;
 }
 
-void ball_collision_callback(unsigned body1, unsigned body2)
+void ball_collision_callback(PhysWorld* world, unsigned body1, unsigned body2)
 {
-    unsigned* pockets     = app->table.pocket_physics_ids;
-    int       num_pockets = 4;
+    // the app is reached through the world so the callback also works on copies of the world
+    const pool_app* state = (const pool_app*) world->userData;
+
+    const unsigned* pockets     = state->table.pocket_physics_ids;
+    int             num_pockets = 4;
     for ( int i = 0; i < num_pockets; ++i )
     {
         if ( body2 == pockets[i] )
         {
             // sleep the bodies
-            app->physics_world.sleeping[body1]   = true;
-            app->physics_world.velocities[body1] = ac_vec3_zero();
-            app->physics_world.positions[body1]  = ac_vec3_zero();
-        }
-    }
-
-    // contact with the surface
-    if ( body2 == app->table.physics_ids[0] )
-    {
-        // we remove at most 2% of the velocity per frame
-        const static float max_deprecation = 0.02f;
-        float              scalar          = app->surface_roughness * max_deprecation;
-
-        // only account for the x and z components of the velocity
-        // we don't want to slow down the ball in the y direction
-        // nor do we want to slow down the ball if it's already slow
-        ac_vec3 velocity     = app->physics_world.velocities[body1];
-        ac_vec2 velocity_xz  = { velocity.x, velocity.z };
-        float   magnitude_xz = ac_vec2_magnitude(&velocity_xz);
-        if ( magnitude_xz <= app->min_ball_speed )
-        {
-            return;
+            world->sleeping[body1]          = true;
+            world->velocities[body1]        = ac_vec3_zero();
+            world->angularVelocities[body1] = ac_vec3_zero();
+            world->positions[body1]         = ac_vec3_zero();
         }
-
-        // apply the scalar to the velocity
-        // 1.0f - scalar is the percentage of the velocity that will be kept
-        // and apply this to the x and z components of the velocity
-        float   new_velocity_magnitude = magnitude_xz * (1.0f - scalar);
-        ac_vec2 normalised_velocity    = ac_vec2_normalize(&velocity_xz);
-        ac_vec2 new_velocity_xz = ac_vec2_scale(&normalised_velocity, new_velocity_magnitude);
-        ac_vec3 new_velocity =
-            (ac_vec3){ .x = new_velocity_xz.x, .y = velocity.y, .z = new_velocity_xz.y };
-        app->physics_world.velocities[body1] = new_velocity;
     }
 }
 
@@ -267,16 +250,18 @@ void reset_target_ball_if_sleeping(void)
     unsigned target_physics_id = app->balls[app->cue_stick.target_ball].physics_id;
     if ( app->physics_world.sleeping[target_physics_id] )
     {
-        app->physics_world.sleeping[target_physics_id]   = false;
+        app->physics_world.sleeping[target_physics_id]          = false;
         // we apply a small downward velocity to help the stick not become
         // visible when the ball is reset
-        app->physics_world.velocities[target_physics_id] = (ac_vec3){ 0.0f, -0.01f, 0.0f };
-        app->physics_world.positions[target_physics_id]  = ball_start_pos_to_world_pos(
+        app->physics_world.velocities[target_physics_id]        = (ac_vec3){ 0.0f, -0.01f, 0.0f };
+        app->physics_world.angularVelocities[target_physics_id] = ac_vec3_zero();
+        ac_vec3 start_position = ball_start_pos_to_world_pos(
             &app->cue_start_position,
             &app->table.surface_center,
             &(ac_vec2){ app->table.width, app->table.length },
             app->ball_drop_height
         );
+        phys_set_entity_position(&app->physics_world, target_physics_id, &start_position);
     }
 }
 
@@ -310,7 +295,7 @@ void detect_balls_off_table(void)
             continue;
         }
 
-        ac_vec3* pos = &app->physics_world.positions[app->balls[i].physics_id];
+        const ac_vec3* pos = &app->physics_world.positions[app->balls[i].physics_id];
         if ( pos->y < app->y_threshold )
         {
             if ( i == target_ball_id )
@@ -320,13 +305,19 @@ void detect_balls_off_table(void)
                 continue;
             }
 
-            *pos = ball_start_pos_to_world_pos(
+            ac_vec3 start_position = ball_start_pos_to_world_pos(
                 &app->target_start_position,
                 &app->table.surface_center,
                 &(ac_vec2){ app->table.width, app->table.length },
                 app->ball_drop_height
             );
-            app->physics_world.velocities[app->balls[i].physics_id] = ac_vec3_zero();
+            phys_set_entity_position(
+                &app->physics_world,
+                app->balls[i].physics_id,
+                &start_position
+            );
+            app->physics_world.velocities[app->balls[i].physics_id]        = ac_vec3_zero();
+            app->physics_world.angularVelocities[app->balls[i].physics_id] = ac_vec3_zero();
         }
     }
 }
@@ -347,42 +338,24 @@ void strike_target_ball(void)
         return;
     }
 
-    pool_ball*         balls                  = app->balls;
     PhysWorld*         world                  = &app->physics_world;
-    unsigned           target_ball_physics_id = balls[target_ball].physics_id;
-    float              mass_kg                = world->masses[target_ball_physics_id];
+    unsigned           target_ball_physics_id = app->balls[target_ball].physics_id;
     static const float contact_time_seconds   = 0.01f;  // 10ms
-    if ( mass_kg > 0.0f )
-    {
-        // calculate normalised direction of force based on stick orientation, yaw, and pitch
-        ac_vec3 direction = (ac_vec3){
-            .x = -sinf(ac_deg_to_rad(cue_stick->yaw)) * cosf(ac_deg_to_rad(cue_stick->pitch_angle)),
-            .y = sinf(ac_deg_to_rad(cue_stick->pitch_angle)),
-            .z = -cosf(ac_deg_to_rad(cue_stick->yaw)) * cosf(ac_deg_to_rad(cue_stick->pitch_angle))
-        };
-
-        direction = ac_vec3_normalize(&direction);
-
-        // calculate the impulse based on power and direction
-        ac_vec3 impulse =
-            ac_vec3_scale(&direction, cue_stick->power * cue_stick->max_power_newtons);
-
-        // calculate the acceleration of the ball based on 'F = ma' -> 'a = F/m'
-        ac_vec3 acceleration = ac_vec3_scale(&impulse, 1.0f / mass_kg);
-
-        // we will use the formula 'v = u + at' to calculate the new velocity
-        // where 'u' is the initial velocity of the ball
-        // 'a' is the acceleration of the ball
-        // and 't' is the contact time between the stick and the ball
-
-        // first we calculate the change in velocity based on acceleration and contact time
-        // 'dv = a * t'
-        ac_vec3 delta_velocity = ac_vec3_scale(&acceleration, contact_time_seconds);
-
-        // update the velocity of the ball -> 'v = u + dv'
-        world->velocities[target_ball_physics_id] =
-            ac_vec3_add(&world->velocities[target_ball_physics_id], &delta_velocity);
-    }
+
+    // calculate normalised direction of force based on stick orientation, yaw, and pitch
+    ac_vec3 direction = (ac_vec3){
+        .x = -sinf(ac_deg_to_rad(cue_stick->yaw)) * cosf(ac_deg_to_rad(cue_stick->pitch_angle)),
+        .y = sinf(ac_deg_to_rad(cue_stick->pitch_angle)),
+        .z = -cosf(ac_deg_to_rad(cue_stick->yaw)) * cosf(ac_deg_to_rad(cue_stick->pitch_angle))
+    };
+
+    direction = ac_vec3_normalize(&direction);
+
+    // the stick pushes with its force for the contact time, 'J = F * t', and the world turns the
+    // impulse into a change of velocity and wakes the ball
+    float   force_newtons = cue_stick->power * cue_stick->max_power_newtons;
+    ac_vec3 impulse       = ac_vec3_scale(&direction, force_newtons * contact_time_seconds);
+    phys_apply_impulse(world, target_ball_physics_id, &impulse);
 
     // reset stick power
     cue_stick->power  = 0.0f;
@@ -582,9 +555,9 @@ void update_main_camera(const orbit_camera* cam)
     radial          = ac_vec3_normalize(&radial);
     radial          = ac_vec3_scale(&radial, cam->radius);
     ac_vec3 eye     = ac_vec3_add(&cam->target, &radial);
-    ac_vec3 look_at = cam->target;
+    ac_mat4 view    = ac_mat4_look_at(&eye, &cam->target, &up);
 
-    gluLookAt(eye.x, eye.y, eye.z, look_at.x, look_at.y, look_at.z, up.x, up.y, up.z);
+    glMultMatrixf(view.data);
 }
 
 void setup_lighting(void)
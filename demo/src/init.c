@@ -328,7 +328,7 @@ void initialise_pool_balls(
     pool_ball** balls_ptr,
     int         num_balls,
     int         layout,
-    void (*callback)(unsigned, unsigned),
+    void (*callback)(PhysWorld*, unsigned, unsigned),
     const ac_vec2* table_dimensions,
     const ac_vec3* table_center,
     const ac_vec2* cue_position,
@@ -345,35 +345,54 @@ void initialise_pool_balls(
     static Sphere         sphere_collider = { .radius = 0.0305f };
     static const Collider collider        = { .type = SPHERE_C, .data = &sphere_collider };
 
+    // describe every ball so they can be added to the world in one call
+    PhysEntityDesc* descs = (PhysEntityDesc*) calloc(num_balls, sizeof(PhysEntityDesc));
+    unsigned*       ids   = (unsigned*) malloc(num_balls * sizeof(unsigned));
+    if ( balls == NULL || descs == NULL || ids == NULL )
+    {
+        printf("Failed to allocate the pool balls\n");
+        exit(1);
+    }
+    for ( int i = 0; i < num_balls; ++i )
+    {
+        descs[i].collider      = collider;
+        descs[i].flags         = AC_PHYS_ENT_DYNAMIC;
+        descs[i].worldCallback = callback;
+    }
+
     // cue ball
-    ac_vec3 cue_start_pos =
+    descs[0].position =
         ball_start_pos_to_world_pos(cue_position, table_center, table_dimensions, drop_height);
-    unsigned ball_id = phys_add_entity(world, &cue_start_pos);
-    phys_add_entity_collider(world, collider, ball_id);
-    phys_make_entity_dynamic(world, ball_id);
-    phys_add_collision_callback(world, ball_id, callback);
-    world->masses[ball_id] = 0.170f;
+    descs[0].mass = 0.170f;
 
-    balls[0].physics_id = ball_id;
+    // seed the random number generator
+    srand((unsigned int) time(NULL));
+    for ( int i = 1; i < num_balls; ++i )
+    {
+        descs[i].mass = generate_random_ball_mass(0.1f, 0.2f);
+    }
+
+    // the world adds all of the balls or none of them
+    if ( phys_add_entities(world, descs, (unsigned) num_balls, ids) != (unsigned) num_balls )
+    {
+        printf("Not enough room in the physics world for %d balls\n", num_balls);
+        exit(1);
+    }
+
+    balls[0].physics_id = ids[0];
     balls[0].color      = (ac_vec3){ 1.0f, 1.0f, 1.0f };
     balls[0].radius     = sphere_collider.radius;
     balls[0].draw       = draw_pool_ball;
 
-    // seed the random number generator
-    srand((unsigned int) time(NULL));
     for ( int i = 1; i < num_balls; ++i )
     {
-        unsigned ball_index = phys_add_entity(world, &(ac_vec3){ 0.0f, 0.0f, 0.0f });
-        phys_add_entity_collider(world, collider, ball_index);
-        phys_make_entity_dynamic(world, ball_index);
-        world->masses[ball_index] = generate_random_ball_mass(0.1f, 0.2f);
-
-        balls[i].physics_id = ball_index;
-        balls[i].color      = generate_ball_color(world->masses[ball_index], 0.1f, 0.2f);
+        balls[i].physics_id = ids[i];
+        balls[i].color      = generate_ball_color(descs[i].mass, 0.1f, 0.2f);
         balls[i].radius     = radius;
-        phys_add_collision_callback(world, ball_index, callback);
-        balls[i].draw = draw_pool_ball;
+        balls[i].draw       = draw_pool_ball;
     }
+    free(descs);
+    free(ids);
 
     ac_vec3 target_start_pos =
         ball_start_pos_to_world_pos(target_pos, table_center, table_dimensions, drop_height);
@@ -417,7 +436,7 @@ void ball_formation_triangle(
                 .z = start_pos.z - row * spacing  // move down -z
             };
 
-            world->positions[balls[ball_index].physics_id] = pos;
+            phys_set_entity_position(world, balls[ball_index].physics_id, &pos);
 
             ball_index++;
         }
@@ -447,7 +466,7 @@ void ball_formation_rectangle(
             .z = start_pos.z - row * spacing
         };
 
-        world->positions[balls[ball_index].physics_id] = pos;
+        phys_set_entity_position(world, balls[ball_index].physics_id, &pos);
 
         ball_index++;
 
@@ -58,7 +58,7 @@ void initialise_pool_balls(
     pool_ball** balls_ptr,
     int         num_balls,
     int         layout,
-    void (*callback)(unsigned, unsigned),
+    void (*callback)(PhysWorld*, unsigned, unsigned),
     const ac_vec2* table_dimensions,
     const ac_vec3* table_center,
     const ac_vec2* cue_position,
@@ -45,9 +45,10 @@ void draw_scene(const pool_app* app, bool orthographic)
         {
             continue;
         }
-        const ac_vec3*   pos  = &app->physics_world.positions[app->balls[i].physics_id];
+        // interpolate so the balls move smoothly between physics steps
+        const ac_vec3    pos  = phys_get_interpolated_position(world, app->balls[i].physics_id);
         const pool_ball* ball = &app->balls[i];
-        app->balls[i].draw(ball, pos);
+        app->balls[i].draw(ball, &pos);
     }
 
     // draw the cue stick
@@ -58,9 +59,10 @@ void draw_scene(const pool_app* app, bool orthographic)
         {
             const pool_ball* target_ball       = &balls[stick->target_ball];
             const unsigned   target_physics_id = target_ball->physics_id;
-            const ac_vec3*   target_pos        = &world->positions[target_physics_id];
             const float      target_radius     = target_ball->radius;
-            stick->draw(&app->cue_stick, target_pos, target_radius);
+            const ac_vec3    target_pos =
+                phys_get_interpolated_position(world, target_physics_id);
+            stick->draw(&app->cue_stick, &target_pos, target_radius);
         }
     }
 
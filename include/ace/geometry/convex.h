@@ -0,0 +1,97 @@
+/**
+ * \file
+ * \brief Collision detection between convex shapes described by support functions.
+ * \details
+ * A convex shape is described by its support function, which returns the point of the shape
+ * furthest along a direction. \ref convex_intersect runs GJK on the Minkowski difference of two
+ * shapes to find whether they overlap, then EPA to find the penetration depth and normal. Spheres,
+ * AABBs, and \ref CONVEX_C colliders can be mixed freely, so a new convex shape only needs a
+ * support function rather than a function for every other shape.
+ *
+ * A \ref ConvexCache holds the directions that produced the final simplex of a query. Passing the
+ * same cache for a pair on the next frame starts GJK from that simplex, so a pair that has barely
+ * moved converges in one or two iterations.
+ */
+#pragma once
+#include "intersection.h"
+#include "shapes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \def AC_CONVEX_MAX_ITERATIONS
+ * \brief The most support points GJK or EPA will add before returning their best result.
+ */
+#define AC_CONVEX_MAX_ITERATIONS 64
+
+/**
+ * \struct ConvexCache
+ * \brief The simplex of the last query for a pair of shapes, used to warm-start the next.
+ * \details
+ * A zero initialised cache is empty.
+ */
+typedef struct
+{
+    ac_vec3  directions[4]; /**< \brief The directions of the simplex's support points. */
+    unsigned count;         /**< \brief The number of directions, 0 when empty. */
+    unsigned iterations;    /**< \brief The GJK iterations used by the last query. */
+} ConvexCache;
+
+/**
+ * \brief Finds the point of a collider furthest along a direction.
+ * \param collider A sphere, AABB, or convex collider.
+ * \param position The position of the collider.
+ * \param direction The direction, it does not need to be normalised.
+ * \return The support point in world space, or \p position for other collider types.
+ */
+ac_vec3 collider_support(
+    const Collider* collider, const ac_vec3* position, const ac_vec3* direction
+);
+
+/**
+ * \brief Checks for intersection between two convex colliders using GJK and EPA.
+ * \param c1 The first collider, a sphere, AABB, or convex collider.
+ * \param p1 The position of the first collider.
+ * \param c2 The second collider, a sphere, AABB, or convex collider.
+ * \param p2 The position of the second collider.
+ * \param[in,out] cache The simplex of the previous query for this pair, or NULL.
+ * \return The result of the check. The normal points from \p c1 towards \p c2 and the contact
+ * point is the deepest point of \p c1.
+ * \details
+ * Shapes that only touch are reported as not intersecting.
+ */
+IntersectionResult convex_intersect(
+    const Collider* c1,
+    const ac_vec3*  p1,
+    const Collider* c2,
+    const ac_vec3*  p2,
+    ConvexCache*    cache
+);
+
+/**
+ * \brief The support function of a \ref ConvexHull.
+ * \param shape The hull.
+ * \param direction The direction.
+ * \return The hull point furthest along \p direction.
+ */
+ac_vec3 convex_hull_support(const void* shape, const ac_vec3* direction);
+/**
+ * \brief The support function of a \ref Cylinder.
+ * \param shape The cylinder.
+ * \param direction The direction.
+ * \return The point of the cylinder furthest along \p direction.
+ */
+ac_vec3 cylinder_support(const void* shape, const ac_vec3* direction);
+/**
+ * \brief The support function of a \ref Cone.
+ * \param shape The cone.
+ * \param direction The direction.
+ * \return The point of the cone furthest along \p direction.
+ */
+ac_vec3 cone_support(const void* shape, const ac_vec3* direction);
+
+#ifdef __cplusplus
+}
+#endif
@@ -60,6 +60,127 @@ IntersectionResult AABB_sphere(
     const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
 );
 
+/**
+ * \brief Check for intersection between a sphere and a triangle mesh.
+ *
+ * \param c1 The sphere collider.
+ * \param p1 Pointer to the position of the sphere.
+ * \param c2 The mesh collider, its data is a built \ref TriangleMesh.
+ * \param p2 Pointer to the position of the mesh.
+ *
+ * \return IntersectionResult structure containing the contact with the closest point of the mesh,
+ * the normal points from the sphere towards the mesh.
+ */
+IntersectionResult sphere_mesh(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+);
+
+/**
+ * \brief Check for intersection between a triangle mesh and a sphere.
+ * \see sphere_mesh, the normal points from the mesh towards the sphere.
+ */
+IntersectionResult mesh_sphere(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+);
+
+/**
+ * \brief Check for intersection between a sphere and a heightfield.
+ *
+ * \param c1 The sphere collider.
+ * \param p1 Pointer to the position of the sphere.
+ * \param c2 The heightfield collider, its data is an initialised \ref Heightfield.
+ * \param p2 Pointer to the position of the heightfield's first sample.
+ *
+ * \return IntersectionResult structure containing the contact with the closest point of the
+ * heightfield, the normal points from the sphere towards the heightfield.
+ */
+IntersectionResult sphere_heightfield(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+);
+
+/**
+ * \brief Check for intersection between a heightfield and a sphere.
+ * \see sphere_heightfield, the normal points from the heightfield towards the sphere.
+ */
+IntersectionResult heightfield_sphere(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+);
+
+/**
+ * \brief Check for intersection between two convex colliders with GJK and EPA.
+ *
+ * \param c1 The first collider, a sphere, AABB, or convex collider.
+ * \param p1 Pointer to the position of the first collider.
+ * \param c2 The second collider, a sphere, AABB, or convex collider.
+ * \param p2 Pointer to the position of the second collider.
+ *
+ * \return IntersectionResult structure containing information about the intersection.
+ * \see convex_intersect, which can warm-start from the previous query of a pair.
+ */
+IntersectionResult convex_convex(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+);
+
+/**
+ * \brief Check for intersection between two AABBs.
+ *
+ * \param c1 The first AABB collider.
+ * \param p1 Pointer to the position of the first AABB.
+ * \param c2 The second AABB collider.
+ * \param p2 Pointer to the position of the second AABB.
+ *
+ * \return IntersectionResult structure containing the deepest point of the contact manifold.
+ * \see box_box_manifold, which finds every contact point.
+ */
+IntersectionResult AABB_AABB(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+);
+
+/**
+ * \brief Check for intersection between an AABB and a plane.
+ *
+ * \param c1 The AABB collider.
+ * \param p1 Pointer to the position of the AABB.
+ * \param c2 The plane collider.
+ * \param p2 Pointer to a point on the plane.
+ *
+ * \return IntersectionResult structure containing the deepest corner of the AABB.
+ * \see box_plane_manifold, which finds every contact point.
+ */
+IntersectionResult AABB_plane(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+);
+
+/**
+ * \brief Check for intersection between a plane and an AABB.
+ * \see AABB_plane, the normal points from the plane towards the AABB.
+ */
+IntersectionResult plane_AABB(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+);
+
+/**
+ * \brief Check for intersection between a sphere and a plane.
+ *
+ * \param c1 The sphere collider.
+ * \param p1 Pointer to the position of the sphere.
+ * \param c2 The plane collider.
+ * \param p2 Pointer to a point on the plane.
+ *
+ * \return IntersectionResult structure containing information about the intersection.
+ */
+IntersectionResult sphere_plane(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+);
+
+/**
+ * \brief Check for intersection between a plane and a sphere.
+ * \see sphere_plane, the normal points from the plane towards the sphere.
+ */
+IntersectionResult plane_sphere(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,120 @@
+/**
+ * \file
+ * \brief Multi-point contact manifolds for boxes and planes.
+ * \details
+ * A single contact point cannot hold a box still on a face, so box contacts produce a manifold of
+ * up to \ref AC_MANIFOLD_MAX_POINTS points found by clipping the incident face of one box against
+ * the reference face of the other. Each point carries a feature ID naming the pair of features
+ * that produced it, so a manifold can be matched against the one from the previous frame with
+ * \ref contact_manifold_merge and keep the impulses the solver accumulated for it.
+ *
+ * Boxes are described by a centre, three unit axes, and half extents along those axes, so the
+ * functions work for oriented boxes as well as \ref AABB colliders.
+ */
+#pragma once
+#include "../math/vec3.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \def AC_MANIFOLD_MAX_POINTS
+ * \brief The most points a \ref ContactManifold holds.
+ */
+#define AC_MANIFOLD_MAX_POINTS 4
+
+/**
+ * \struct ContactPoint
+ * \brief A point of a \ref ContactManifold.
+ */
+typedef struct
+{
+    ac_vec3  position;         /**< \brief The point on the surface of the incident shape. */
+    float    penetrationDepth; /**< \brief The depth of the point below the other shape. */
+    uint32_t feature;          /**< \brief Identifies the features that produced the point. */
+    float    normalImpulse;    /**< \brief The impulse the solver has applied at the point. */
+} ContactPoint;
+
+/**
+ * \struct ContactManifold
+ * \brief The contact points between two shapes sharing a normal.
+ */
+typedef struct
+{
+    ac_vec3      normal;    /**< \brief The contact normal, from the first shape to the second. */
+    unsigned     numPoints; /**< \brief The number of points, 0 when the shapes are apart. */
+    ContactPoint points[AC_MANIFOLD_MAX_POINTS]; /**< \brief The contact points. */
+} ContactManifold;
+
+/**
+ * \brief Finds the contact manifold between two boxes.
+ * \param p1 The centre of the first box.
+ * \param axes1 The unit axes of the first box.
+ * \param halfExtents1 The half extents of the first box along its axes.
+ * \param p2 The centre of the second box.
+ * \param axes2 The unit axes of the second box.
+ * \param halfExtents2 The half extents of the second box along its axes.
+ * \param[out] manifold The manifold, its impulses are zero.
+ * \retval true the boxes overlap.
+ * \retval false the boxes are separated, \p manifold has no points.
+ * \details
+ * The axis of least penetration is found with the separating axis test. When it is a face axis
+ * the incident face is clipped against the side planes of the reference face, giving up to four
+ * points. When it is the cross product of two edges the closest point between them is used.
+ */
+bool box_box_manifold(
+    const ac_vec3*   p1,
+    const ac_vec3    axes1[3],
+    const ac_vec3*   halfExtents1,
+    const ac_vec3*   p2,
+    const ac_vec3    axes2[3],
+    const ac_vec3*   halfExtents2,
+    ContactManifold* manifold
+);
+
+/**
+ * \brief Finds the contact manifold between a box and a plane.
+ * \param p1 The centre of the box.
+ * \param axes1 The unit axes of the box.
+ * \param halfExtents1 The half extents of the box along its axes.
+ * \param planePoint A point on the plane.
+ * \param planeNormal The unit normal of the plane, pointing out of the solid side.
+ * \param[out] manifold The manifold, its normal points from the box into the plane.
+ * \retval true a corner of the box is below the plane.
+ * \retval false the box is above the plane, \p manifold has no points.
+ * \details
+ * The feature ID of each point is the index of the box corner. When more than four corners are
+ * below the plane the four spanning the largest area are kept.
+ */
+bool box_plane_manifold(
+    const ac_vec3*   p1,
+    const ac_vec3    axes1[3],
+    const ac_vec3*   halfExtents1,
+    const ac_vec3*   planePoint,
+    const ac_vec3*   planeNormal,
+    ContactManifold* manifold
+);
+
+/**
+ * \brief Replaces a persistent manifold with a new one, keeping the impulses of matching points.
+ * \param[in,out] persistent The manifold from the previous frame.
+ * \param fresh The manifold found this frame.
+ * \details
+ * Points are matched by feature ID. The impulses are discarded if the normal has turned by more
+ * than about 18 degrees, as they no longer act in the same direction.
+ */
+void contact_manifold_merge(ContactManifold* persistent, const ContactManifold* fresh);
+
+/**
+ * \brief Returns the deepest point of a manifold.
+ * \param manifold The manifold, which must have at least one point.
+ * \return The index of the deepest point.
+ */
+unsigned contact_manifold_deepest(const ContactManifold* manifold);
+
+#ifdef __cplusplus
+}
+#endif
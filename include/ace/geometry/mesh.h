@@ -0,0 +1,117 @@
+/**
+ * \file
+ * \brief Builds and queries triangle meshes and heightfields.
+ * \details
+ * A \ref TriangleMesh is given a bounding volume hierarchy once by \ref triangle_mesh_build, after
+ * which it is read only and can be shared by any number of colliders. The hierarchy stores each
+ * node in 16 bytes by quantizing its bounds to 16 bits within the bounds of the mesh.
+ *
+ * A \ref Heightfield needs no acceleration structure, the cells under a point are found directly
+ * from its coordinates.
+ */
+#pragma once
+#include "shapes.h"
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \def AC_MESH_MAX_LEAF_TRIANGLES
+ * \brief The maximum number of triangles stored in a leaf of the hierarchy.
+ */
+#define AC_MESH_MAX_LEAF_TRIANGLES 4
+
+/**
+ * \brief Builds the hierarchy of a triangle mesh.
+ * \param[out] mesh The mesh to build.
+ * \param vertices The vertices of the mesh, they are referenced rather than copied.
+ * \param numVertices The number of vertices.
+ * \param indices Three vertex indices per triangle, they are referenced rather than copied.
+ * \param numTriangles The number of triangles.
+ * \retval true the mesh was built.
+ * \retval false the mesh has no triangles, an index is out of range, or an allocation failed.
+ * \details
+ * The vertices and indices must outlive the mesh and must not change while it is in use. The
+ * hierarchy is split at the median triangle along the longest axis of the triangle centroids.
+ */
+bool triangle_mesh_build(
+    TriangleMesh*   mesh,
+    const ac_vec3*  vertices,
+    unsigned        numVertices,
+    const uint32_t* indices,
+    unsigned        numTriangles
+);
+/**
+ * \brief Frees the hierarchy of a triangle mesh.
+ * \param mesh The mesh to free, the vertices and indices are not freed.
+ */
+void triangle_mesh_free(TriangleMesh* mesh);
+/**
+ * \brief Finds the closest point on a triangle mesh to a point within a radius.
+ * \param mesh The mesh.
+ * \param point The point, relative to the mesh.
+ * \param radius The radius to search within.
+ * \param[out] closest The closest point on the mesh.
+ * \param[out] normal The unit face normal of the triangle containing \p closest.
+ * \retval true a point of the mesh lies within \p radius.
+ * \retval false no point of the mesh lies within \p radius, the outputs are not written.
+ */
+bool triangle_mesh_closest_point(
+    const TriangleMesh* mesh,
+    const ac_vec3*      point,
+    float               radius,
+    ac_vec3*            closest,
+    ac_vec3*            normal
+);
+
+/**
+ * \brief Initialises a heightfield.
+ * \param[out] heightfield The heightfield to initialise.
+ * \param heights numX * numZ heights, row major along x, they are referenced rather than copied.
+ * \param numX The number of samples along x.
+ * \param numZ The number of samples along z.
+ * \param cellSize The distance between samples.
+ * \retval true the heightfield was initialised.
+ * \retval false there are fewer than 2 samples along an axis or \p cellSize is not positive.
+ */
+bool heightfield_init(
+    Heightfield* heightfield, const float* heights, unsigned numX, unsigned numZ, float cellSize
+);
+/**
+ * \brief Finds the closest point on a heightfield to a point within a radius.
+ * \param heightfield The heightfield.
+ * \param point The point, relative to the heightfield.
+ * \param radius The radius to search within.
+ * \param[out] closest The closest point on the heightfield.
+ * \param[out] normal The unit face normal of the triangle containing \p closest.
+ * \retval true a point of the heightfield lies within \p radius.
+ * \retval false no point of the heightfield lies within \p radius, the outputs are not written.
+ * \details
+ * Only the cells overlapping the sphere are visited, they are found from the coordinates of the
+ * point without a search.
+ */
+bool heightfield_closest_point(
+    const Heightfield* heightfield,
+    const ac_vec3*     point,
+    float              radius,
+    ac_vec3*           closest,
+    ac_vec3*           normal
+);
+
+/**
+ * \brief Finds the closest point on a triangle to a point.
+ * \param p The point.
+ * \param a The first vertex of the triangle.
+ * \param b The second vertex of the triangle.
+ * \param c The third vertex of the triangle.
+ * \return The closest point on the triangle.
+ */
+ac_vec3 triangle_closest_point(
+    const ac_vec3* p, const ac_vec3* a, const ac_vec3* b, const ac_vec3* c
+);
+
+#ifdef __cplusplus
+}
+#endif
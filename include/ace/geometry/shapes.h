@@ -5,6 +5,7 @@
  */
 #pragma once
 #include "../math/vec3.h"
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,6 +30,121 @@ typedef struct
     ac_vec3 half_extents; /**< \brief The half extents of the bounding box. */
 } AABB;
 
+/**
+ * \struct Plane
+ * \brief Structure to hold the data for an infinite plane through the entity's position.
+ * \details
+ * Everything below the plane is solid, so a plane cannot be tunnelled through.
+ */
+typedef struct
+{
+    ac_vec3 normal; /**< \brief The unit normal of the plane, pointing out of the solid side. */
+} Plane;
+
+/**
+ * \typedef ConvexSupportFunc
+ * \brief Returns the point of a convex shape furthest along a direction.
+ * \details
+ * The shape is centred on the origin, the direction is not normalised and may be zero.
+ */
+typedef ac_vec3 (*ConvexSupportFunc)(const void* shape, const ac_vec3* direction);
+
+/**
+ * \struct Convex
+ * \brief Structure to hold the data for an arbitrary convex shape.
+ * \details
+ * The shape data is not copied, so it can be shared by any number of colliders.
+ */
+typedef struct
+{
+    ConvexSupportFunc support; /**< \brief The support function of the shape. */
+    const void*       shape;   /**< \brief The data passed to the support function. */
+} Convex;
+
+/**
+ * \struct ConvexHull
+ * \brief Structure to hold the data for the convex hull of a set of points.
+ */
+typedef struct
+{
+    const ac_vec3* points;    /**< \brief The points, relative to the centre of the hull. */
+    unsigned       numPoints; /**< \brief The number of points. */
+} ConvexHull;
+
+/**
+ * \struct Cylinder
+ * \brief Structure to hold the data for a cylinder along the y axis.
+ */
+typedef struct
+{
+    float radius;     /**< \brief The radius of the cylinder. */
+    float halfHeight; /**< \brief Half the height of the cylinder. */
+} Cylinder;
+
+/**
+ * \struct Cone
+ * \brief Structure to hold the data for a cone along the y axis with its apex at the top.
+ */
+typedef struct
+{
+    float radius;     /**< \brief The radius of the base. */
+    float halfHeight; /**< \brief Half the height of the cone. */
+} Cone;
+
+/**
+ * \struct TriangleMeshNode
+ * \brief A node of the bounding volume hierarchy of a \ref TriangleMesh.
+ * \details
+ * The bounds are quantized to 16 bits within the bounds of the whole mesh, rounded outwards so
+ * they always contain the node's triangles. Nodes are stored depth first, so the left child of an
+ * interior node directly follows it.
+ */
+typedef struct
+{
+    uint16_t min[3]; /**< \brief The quantized minimum corner of the node. */
+    uint16_t max[3]; /**< \brief The quantized maximum corner of the node. */
+    uint32_t data;   /**< \brief Leaves: triangle count << 29 | first triangle, else right child. */
+} TriangleMeshNode;
+
+/**
+ * \struct TriangleMesh
+ * \brief Structure to hold the data for a static triangle mesh.
+ * \details
+ * The vertices and indices are owned by the caller and are not copied, only the hierarchy built by
+ * \ref triangle_mesh_build is owned by the mesh. A mesh can be shared by the colliders of any
+ * number of entities, its vertices are relative to each entity's position.
+ */
+typedef struct
+{
+    const ac_vec3*    vertices;      /**< \brief The vertices of the mesh. */
+    const uint32_t*   indices;       /**< \brief Three vertex indices per triangle. */
+    unsigned          numVertices;   /**< \brief The number of vertices. */
+    unsigned          numTriangles;  /**< \brief The number of triangles. */
+    ac_vec3           boundsMin;     /**< \brief The minimum corner of the mesh. */
+    ac_vec3           boundsMax;     /**< \brief The maximum corner of the mesh. */
+    ac_vec3           quantizeScale; /**< \brief Converts from mesh space to node bounds. */
+    TriangleMeshNode* nodes;         /**< \brief The hierarchy, the root is the first node. */
+    unsigned          numNodes;      /**< \brief The number of nodes. */
+    uint32_t*         triangles;     /**< \brief The triangle indices in hierarchy order. */
+} TriangleMesh;
+
+/**
+ * \struct Heightfield
+ * \brief Structure to hold the data for a static heightfield.
+ * \details
+ * The heights are sampled on a regular grid in the xz plane starting at the entity's position,
+ * and are owned by the caller. Each grid cell is split into two triangles.
+ */
+typedef struct
+{
+    const float* heights;   /**< \brief numX * numZ heights, row major along x. */
+    unsigned     numX;      /**< \brief The number of samples along x, at least 2. */
+    unsigned     numZ;      /**< \brief The number of samples along z, at least 2. */
+    float        cellSize;  /**< \brief The distance between samples. */
+    float        minHeight; /**< \brief The lowest height, set by \ref heightfield_init. */
+    float        maxHeight; /**< \brief The highest height, set by \ref heightfield_init. */
+} Heightfield;
+
 #ifdef __cplusplus
 }
 #endif
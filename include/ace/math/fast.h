@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \brief Fast approximations of the math library functions for hot paths.
+ * \details
+ * These functions trade a few units in the last place (ULP) of accuracy for speed. Each documents
+ * its largest error, measured against a double precision reference over its whole domain. They are
+ * opt in, none of the other library functions use them.
+ *
+ * The approximations are built from plain float arithmetic, so they give the same results on every
+ * platform in an \ref AC_DETERMINISTIC build, except where noted.
+ */
+#pragma once
+#include "vec3.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Computes the reciprocal square root, 1 / sqrt(x).
+ * \param[in] x The value, which must be positive and finite.
+ * \return The reciprocal square root, within 5 ULP.
+ * \details
+ * Refines the hardware estimate of SSE or NEON with Newton-Raphson steps. The estimate differs
+ * between processor vendors, so \ref AC_DETERMINISTIC builds compute 1.0f / sqrtf(x) instead.
+ */
+float ac_rsqrt(float x);
+/**
+ * \brief Computes the sine and cosine of an angle together.
+ * \param[in] angle The angle in radians.
+ * \param[out] sine The sine of the angle, within 1e-7.
+ * \param[out] cosine The cosine of the angle, within 1e-7.
+ * \details
+ * The angle is reduced to a quarter turn once for both results. Angles larger than 8192 radians
+ * fall back to sinf and cosf, which reduce them more accurately. Results with a magnitude of at
+ * least 0.25 are also within 2 ULP.
+ */
+void  ac_sincos(float angle, float* sine, float* cosine);
+/**
+ * \brief Computes the arc cosine.
+ * \param[in] x The value, between -1 and 1.
+ * \return The angle in radians between 0 and pi, within 2 ULP, or NaN if \p x is out of range.
+ */
+float ac_acos_fast(float x);
+/**
+ * \brief Computes the arc tangent of y / x, using the signs of both to pick the quadrant.
+ * \param[in] y The y coordinate.
+ * \param[in] x The x coordinate.
+ * \return The angle in radians between -pi and pi, within 4 ULP.
+ * \details
+ * As with atan2f, the result is 0 when both coordinates are zero.
+ */
+float ac_atan2_fast(float y, float x);
+
+/**
+ * \ingroup vec3
+ * \brief Normalizes a vector using \ref ac_rsqrt.
+ * \param[in] v The vector.
+ * \return The normalized vector, each component within 6 ULP of the exact result.
+ * \details
+ * As with \ref ac_vec3_normalize, a vector of zero length or NaN gives a vector with NaN
+ * components.
+ */
+ac_vec3 ac_vec3_normalize_fast(const ac_vec3* v);
+
+#ifdef __cplusplus
+}
+#endif
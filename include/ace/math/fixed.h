@@ -0,0 +1,374 @@
+/**
+ * \file
+ * \brief Fixed-point scalar and vector types and functions.
+ * \details
+ * Fixed-point values are integers with an implied binary point, so every operation on them is
+ * exact integer arithmetic that gives the same result on every platform and compiler, whatever
+ * its floating point settings. They are intended for simulations that must stay in lockstep.
+ *
+ * Two formats are provided: \ref ac_fixed is Q16.16, a 32-bit integer with 16 fractional bits,
+ * and \ref ac_fixed64 is Q32.32, a 64-bit integer with 32 fractional bits. The Q16.16 vector is
+ * an \ref ac_ivec3, so the ivec3 functions for zero, invalid, equality, and negation apply to it.
+ *
+ * Results are rounded to the nearest representable value, with ties away from zero, except for
+ * square roots and lengths, which are rounded down. A result that does not fit saturates to the
+ * invalid sentinel, \ref INT_INVALID or \ref AC_FIXED64_INVALID, in the same way as the ivec3
+ * functions, and invalid inputs give invalid results.
+ */
+#pragma once
+#include "vec3.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup fixed fixed
+ * \brief Fixed-point scalars and vectors.
+ */
+
+//--------------------------------------------------------------------------------------------------
+// Q16.16
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \ingroup fixed
+ * \brief A Q16.16 fixed-point value, with \ref INT_INVALID as its invalid sentinel.
+ */
+typedef int ac_fixed;
+/**
+ * \ingroup fixed
+ * \brief A 3-component Q16.16 fixed-point vector.
+ */
+typedef ac_ivec3 ac_fixed_vec3;
+
+/**
+ * \ingroup fixed
+ * \def AC_FIXED_ONE
+ * \brief The Q16.16 value of one.
+ */
+#define AC_FIXED_ONE ((ac_fixed) 0x10000)
+
+/**
+ * \ingroup fixed
+ * \brief Converts an integer to Q16.16.
+ * \param[in] value The integer.
+ * \return The fixed-point value, or \ref INT_INVALID if it is outside [-32767, 32767].
+ */
+ac_fixed ac_fixed_from_int(int value);
+/**
+ * \ingroup fixed
+ * \brief Converts a float to Q16.16.
+ * \param[in] value The float.
+ * \return The nearest fixed-point value, or \ref INT_INVALID if it is out of range or NaN.
+ */
+ac_fixed ac_fixed_from_float(float value);
+/**
+ * \ingroup fixed
+ * \brief Converts a Q16.16 value to a float.
+ * \param[in] value The fixed-point value.
+ * \return The nearest float, or NaN if the value is invalid.
+ */
+float    ac_fixed_to_float(ac_fixed value);
+/**
+ * \ingroup fixed
+ * \brief Adds two Q16.16 values: a + b.
+ * \param[in] a The first value.
+ * \param[in] b The second value.
+ * \return The sum, or \ref INT_INVALID if it overflows.
+ */
+ac_fixed ac_fixed_add(ac_fixed a, ac_fixed b);
+/**
+ * \ingroup fixed
+ * \brief Subtracts two Q16.16 values: a - b.
+ * \param[in] a The first value.
+ * \param[in] b The second value.
+ * \return The difference, or \ref INT_INVALID if it overflows.
+ */
+ac_fixed ac_fixed_sub(ac_fixed a, ac_fixed b);
+/**
+ * \ingroup fixed
+ * \brief Multiplies two Q16.16 values: a * b.
+ * \param[in] a The first value.
+ * \param[in] b The second value.
+ * \return The product, or \ref INT_INVALID if it overflows.
+ */
+ac_fixed ac_fixed_mul(ac_fixed a, ac_fixed b);
+/**
+ * \ingroup fixed
+ * \brief Divides two Q16.16 values: a / b.
+ * \param[in] a The dividend.
+ * \param[in] b The divisor.
+ * \return The quotient, or \ref INT_INVALID if it overflows or \p b is zero.
+ */
+ac_fixed ac_fixed_div(ac_fixed a, ac_fixed b);
+/**
+ * \ingroup fixed
+ * \brief Computes the square root of a Q16.16 value.
+ * \param[in] value The value.
+ * \return The square root rounded down, or \ref INT_INVALID if the value is negative.
+ */
+ac_fixed ac_fixed_sqrt(ac_fixed value);
+
+/**
+ * \ingroup fixed
+ * \brief Converts a float vector to Q16.16.
+ * \param[in] v The float vector.
+ * \return The fixed-point vector, or the invalid ac_ivec3 if any component is out of range.
+ */
+ac_fixed_vec3 ac_fixed_vec3_from_vec3(const ac_vec3* v);
+/**
+ * \ingroup fixed
+ * \brief Converts a Q16.16 vector to a float vector.
+ * \param[in] v The fixed-point vector.
+ * \return The float vector, with NaN components if the vector is invalid.
+ */
+ac_vec3       ac_fixed_vec3_to_vec3(const ac_fixed_vec3* v);
+/**
+ * \ingroup fixed
+ * \brief Adds two Q16.16 vectors: a + b.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The sum, or the invalid ac_ivec3 if any component overflows.
+ */
+ac_fixed_vec3 ac_fixed_vec3_add(const ac_fixed_vec3* a, const ac_fixed_vec3* b);
+/**
+ * \ingroup fixed
+ * \brief Subtracts two Q16.16 vectors: a - b.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The difference, or the invalid ac_ivec3 if any component overflows.
+ */
+ac_fixed_vec3 ac_fixed_vec3_sub(const ac_fixed_vec3* a, const ac_fixed_vec3* b);
+/**
+ * \ingroup fixed
+ * \brief Multiplies a Q16.16 vector by a scalar: v * scalar.
+ * \param[in] v The vector.
+ * \param[in] scalar The scalar.
+ * \return The scaled vector, or the invalid ac_ivec3 if any component overflows.
+ */
+ac_fixed_vec3 ac_fixed_vec3_scale(const ac_fixed_vec3* v, ac_fixed scalar);
+/**
+ * \ingroup fixed
+ * \brief Computes the dot product of two Q16.16 vectors.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The dot product, or \ref INT_INVALID if it overflows.
+ * \details
+ * The products are summed exactly and the sum is rounded once.
+ */
+ac_fixed      ac_fixed_vec3_dot(const ac_fixed_vec3* a, const ac_fixed_vec3* b);
+/**
+ * \ingroup fixed
+ * \brief Computes the cross product of two Q16.16 vectors: a x b.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The cross product, or the invalid ac_ivec3 if any component overflows.
+ */
+ac_fixed_vec3 ac_fixed_vec3_cross(const ac_fixed_vec3* a, const ac_fixed_vec3* b);
+/**
+ * \ingroup fixed
+ * \brief Computes the length of a Q16.16 vector.
+ * \param[in] v The vector.
+ * \return The length rounded down, or \ref INT_INVALID if it overflows.
+ * \details
+ * The squared length is kept exact, so it cannot overflow before the square root.
+ */
+ac_fixed      ac_fixed_vec3_length(const ac_fixed_vec3* v);
+/**
+ * \ingroup fixed
+ * \brief Normalizes a Q16.16 vector.
+ * \param[in] v The vector.
+ * \return The normalized vector, or the invalid ac_ivec3 if the vector is zero or invalid.
+ */
+ac_fixed_vec3 ac_fixed_vec3_normalize(const ac_fixed_vec3* v);
+
+//--------------------------------------------------------------------------------------------------
+// Q32.32
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \ingroup fixed
+ * \brief A Q32.32 fixed-point value, with \ref AC_FIXED64_INVALID as its invalid sentinel.
+ */
+typedef int64_t ac_fixed64;
+
+/**
+ * \ingroup fixed
+ * \union ac_fixed64_vec3
+ * \brief A 3-component Q32.32 fixed-point vector.
+ */
+typedef union ac_fixed64_vec3
+{
+    struct
+    {
+        ac_fixed64 x, y, z;
+    };
+    ac_fixed64 data[3];
+} ac_fixed64_vec3;
+
+/**
+ * \ingroup fixed
+ * \def AC_FIXED64_ONE
+ * \brief The Q32.32 value of one.
+ */
+#define AC_FIXED64_ONE ((ac_fixed64) 0x100000000)
+/**
+ * \ingroup fixed
+ * \def AC_FIXED64_INVALID
+ * \brief A sentinel value for an invalid Q32.32 value.
+ */
+#define AC_FIXED64_INVALID INT64_MIN
+
+/**
+ * \ingroup fixed
+ * \brief Converts an integer to Q32.32.
+ * \param[in] value The integer.
+ * \return The fixed-point value, or \ref AC_FIXED64_INVALID if the integer is \ref INT_INVALID.
+ */
+ac_fixed64 ac_fixed64_from_int(int value);
+/**
+ * \ingroup fixed
+ * \brief Converts a double to Q32.32.
+ * \param[in] value The double.
+ * \return The nearest fixed-point value, or \ref AC_FIXED64_INVALID if it is out of range or NaN.
+ */
+ac_fixed64 ac_fixed64_from_double(double value);
+/**
+ * \ingroup fixed
+ * \brief Converts a Q32.32 value to a double.
+ * \param[in] value The fixed-point value.
+ * \return The nearest double, or NaN if the value is invalid.
+ */
+double     ac_fixed64_to_double(ac_fixed64 value);
+/**
+ * \ingroup fixed
+ * \brief Adds two Q32.32 values: a + b.
+ * \param[in] a The first value.
+ * \param[in] b The second value.
+ * \return The sum, or \ref AC_FIXED64_INVALID if it overflows.
+ */
+ac_fixed64 ac_fixed64_add(ac_fixed64 a, ac_fixed64 b);
+/**
+ * \ingroup fixed
+ * \brief Subtracts two Q32.32 values: a - b.
+ * \param[in] a The first value.
+ * \param[in] b The second value.
+ * \return The difference, or \ref AC_FIXED64_INVALID if it overflows.
+ */
+ac_fixed64 ac_fixed64_sub(ac_fixed64 a, ac_fixed64 b);
+/**
+ * \ingroup fixed
+ * \brief Multiplies two Q32.32 values: a * b.
+ * \param[in] a The first value.
+ * \param[in] b The second value.
+ * \return The product, or \ref AC_FIXED64_INVALID if it overflows.
+ */
+ac_fixed64 ac_fixed64_mul(ac_fixed64 a, ac_fixed64 b);
+/**
+ * \ingroup fixed
+ * \brief Divides two Q32.32 values: a / b.
+ * \param[in] a The dividend.
+ * \param[in] b The divisor.
+ * \return The quotient, or \ref AC_FIXED64_INVALID if it overflows or \p b is zero.
+ */
+ac_fixed64 ac_fixed64_div(ac_fixed64 a, ac_fixed64 b);
+/**
+ * \ingroup fixed
+ * \brief Computes the square root of a Q32.32 value.
+ * \param[in] value The value.
+ * \return The square root rounded down, or \ref AC_FIXED64_INVALID if the value is negative.
+ */
+ac_fixed64 ac_fixed64_sqrt(ac_fixed64 value);
+
+/**
+ * \ingroup fixed
+ * \brief Creates a Q32.32 vector with all components set to the invalid sentinel.
+ * \return The invalid vector.
+ */
+ac_fixed64_vec3 ac_fixed64_vec3_invalid(void);
+/**
+ * \ingroup fixed
+ * \brief Checks if a Q32.32 vector has invalid components.
+ * \param[in] v The vector.
+ * \retval true if any of the components of the vector are invalid.
+ * \retval false if all of the components of the vector are valid.
+ */
+bool            ac_fixed64_vec3_is_invalid(const ac_fixed64_vec3* v);
+/**
+ * \ingroup fixed
+ * \brief Converts a float vector to Q32.32.
+ * \param[in] v The float vector.
+ * \return The fixed-point vector, or the invalid vector if any component is out of range.
+ */
+ac_fixed64_vec3 ac_fixed64_vec3_from_vec3(const ac_vec3* v);
+/**
+ * \ingroup fixed
+ * \brief Converts a Q32.32 vector to a float vector.
+ * \param[in] v The fixed-point vector.
+ * \return The float vector, with NaN components if the vector is invalid.
+ */
+ac_vec3         ac_fixed64_vec3_to_vec3(const ac_fixed64_vec3* v);
+/**
+ * \ingroup fixed
+ * \brief Adds two Q32.32 vectors: a + b.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The sum, or the invalid vector if any component overflows.
+ */
+ac_fixed64_vec3 ac_fixed64_vec3_add(const ac_fixed64_vec3* a, const ac_fixed64_vec3* b);
+/**
+ * \ingroup fixed
+ * \brief Subtracts two Q32.32 vectors: a - b.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The difference, or the invalid vector if any component overflows.
+ */
+ac_fixed64_vec3 ac_fixed64_vec3_sub(const ac_fixed64_vec3* a, const ac_fixed64_vec3* b);
+/**
+ * \ingroup fixed
+ * \brief Multiplies a Q32.32 vector by a scalar: v * scalar.
+ * \param[in] v The vector.
+ * \param[in] scalar The scalar.
+ * \return The scaled vector, or the invalid vector if any component overflows.
+ */
+ac_fixed64_vec3 ac_fixed64_vec3_scale(const ac_fixed64_vec3* v, ac_fixed64 scalar);
+/**
+ * \ingroup fixed
+ * \brief Computes the dot product of two Q32.32 vectors.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The dot product, or \ref AC_FIXED64_INVALID if it overflows.
+ * \details
+ * The products are summed exactly and the sum is rounded once.
+ */
+ac_fixed64      ac_fixed64_vec3_dot(const ac_fixed64_vec3* a, const ac_fixed64_vec3* b);
+/**
+ * \ingroup fixed
+ * \brief Computes the cross product of two Q32.32 vectors: a x b.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The cross product, or the invalid vector if any component overflows.
+ */
+ac_fixed64_vec3 ac_fixed64_vec3_cross(const ac_fixed64_vec3* a, const ac_fixed64_vec3* b);
+/**
+ * \ingroup fixed
+ * \brief Computes the length of a Q32.32 vector.
+ * \param[in] v The vector.
+ * \return The length rounded down, or \ref AC_FIXED64_INVALID if it overflows.
+ * \details
+ * The squared length is kept exact, so it cannot overflow before the square root.
+ */
+ac_fixed64      ac_fixed64_vec3_length(const ac_fixed64_vec3* v);
+/**
+ * \ingroup fixed
+ * \brief Normalizes a Q32.32 vector.
+ * \param[in] v The vector.
+ * \return The normalized vector, or the invalid vector if the vector is zero or invalid.
+ */
+ac_fixed64_vec3 ac_fixed64_vec3_normalize(const ac_fixed64_vec3* v);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,90 @@
+/**
+ * \file
+ * \brief 3x3 matrix types and functions.
+ * \details
+ * Matrices are stored in column-major order, as OpenGL expects, and multiply column vectors on
+ * their right. A 3x3 matrix holds a rotation and scale without a translation, such as the normal
+ * matrix of a transform or an inertia tensor.
+ */
+#pragma once
+#include "quat.h"
+#include "vec3.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup mat3 mat3
+ * \brief 3x3 float matrix and functions.
+ */
+
+/**
+ * \ingroup mat3
+ * \union ac_mat3
+ * \brief A 3x3 matrix of type float in column-major order.
+ * \details
+ * Element (row, column) is data[column * 3 + row], or columns[column].data[row].
+ */
+typedef union ac_mat3
+{
+    ac_vec3 columns[3];
+    float   data[9];
+} ac_mat3;
+
+/**
+ * \ingroup mat3
+ * \brief Creates the identity matrix.
+ * \return The identity matrix.
+ */
+ac_mat3 ac_mat3_identity(void);
+/**
+ * \ingroup mat3
+ * \brief Creates the rotation matrix of a quaternion.
+ * \param[in] q The unit quaternion.
+ * \return The matrix that rotates vectors as \ref ac_quat_rotate does.
+ */
+ac_mat3 ac_mat3_from_quat(const ac_quat* q);
+/**
+ * \ingroup mat3
+ * \brief Multiplies two matrices: a * b.
+ * \param[in] a The first matrix.
+ * \param[in] b The second matrix.
+ * \return The product, which transforms by \p b then by \p a.
+ */
+ac_mat3 ac_mat3_mul(const ac_mat3* a, const ac_mat3* b);
+/**
+ * \ingroup mat3
+ * \brief Transforms a vector by a matrix: m * v.
+ * \param[in] m The matrix.
+ * \param[in] v The vector.
+ * \return The transformed vector.
+ */
+ac_vec3 ac_mat3_transform(const ac_mat3* m, const ac_vec3* v);
+/**
+ * \ingroup mat3
+ * \brief Transposes a matrix.
+ * \param[in] m The matrix.
+ * \return The transposed matrix, which is the inverse of a rotation matrix.
+ */
+ac_mat3 ac_mat3_transpose(const ac_mat3* m);
+/**
+ * \ingroup mat3
+ * \brief Computes the determinant of a matrix.
+ * \param[in] m The matrix.
+ * \return The determinant.
+ */
+float   ac_mat3_determinant(const ac_mat3* m);
+/**
+ * \ingroup mat3
+ * \brief Inverts a matrix.
+ * \param[in] m The matrix.
+ * \return The inverse matrix.
+ * \details
+ * If the matrix has a determinant of zero, the returned matrix will have NaN components.
+ */
+ac_mat3 ac_mat3_inverse(const ac_mat3* m);
+
+#ifdef __cplusplus
+}
+#endif
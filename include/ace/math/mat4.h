@@ -0,0 +1,189 @@
+/**
+ * \file
+ * \brief 4x4 matrix types and functions.
+ * \details
+ * Matrices are stored in column-major order, as OpenGL expects, so \ref ac_mat4::data can be
+ * passed directly to glLoadMatrixf or glMultMatrixf. They multiply column vectors on their right.
+ * Each column is an \ref ac_vec4, and the products use SSE or NEON wherever \ref ac_vec4 does.
+ */
+#pragma once
+#include "mat3.h"
+#include "quat.h"
+#include "vec3.h"
+#include "vec4.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup mat4 mat4
+ * \brief 4x4 float matrix and functions.
+ */
+
+/**
+ * \ingroup mat4
+ * \union ac_mat4
+ * \brief A 4x4 matrix of type float in column-major order, aligned to 16 bytes.
+ * \details
+ * Element (row, column) is data[column * 4 + row], or columns[column].data[row].
+ */
+typedef union ac_mat4
+{
+    ac_vec4 columns[4];
+    float   data[16];
+} ac_mat4;
+
+/**
+ * \ingroup mat4
+ * \brief Creates the identity matrix.
+ * \return The identity matrix.
+ */
+ac_mat4 ac_mat4_identity(void);
+/**
+ * \ingroup mat4
+ * \brief Creates a translation matrix.
+ * \param[in] translation The translation.
+ * \return The translation matrix.
+ */
+ac_mat4 ac_mat4_translation(const ac_vec3* translation);
+/**
+ * \ingroup mat4
+ * \brief Creates a scaling matrix.
+ * \param[in] scale The scale along each axis.
+ * \return The scaling matrix.
+ */
+ac_mat4 ac_mat4_scaling(const ac_vec3* scale);
+/**
+ * \ingroup mat4
+ * \brief Creates the rotation matrix of a quaternion.
+ * \param[in] q The unit quaternion.
+ * \return The matrix that rotates vectors as \ref ac_quat_rotate does.
+ */
+ac_mat4 ac_mat4_from_quat(const ac_quat* q);
+/**
+ * \ingroup mat4
+ * \brief Creates a transform from a translation, rotation, and scale.
+ * \param[in] translation The translation.
+ * \param[in] rotation The unit quaternion rotation.
+ * \param[in] scale The scale along each axis.
+ * \return The transform, which scales then rotates then translates.
+ */
+ac_mat4 ac_mat4_from_trs(const ac_vec3* translation, const ac_quat* rotation, const ac_vec3* scale);
+/**
+ * \ingroup mat4
+ * \brief Creates the transforms of many objects from their translations, rotations, and scales.
+ * \param[out] out The transforms.
+ * \param[in] translations The translations.
+ * \param[in] rotations The unit quaternion rotations.
+ * \param[in] scales The scales, or NULL for a scale of one.
+ * \param[in] count The number of transforms.
+ * \see ac_mat4_from_trs
+ */
+void    ac_mat4_from_trs_n(
+    ac_mat4*       out,
+    const ac_vec3* translations,
+    const ac_quat* rotations,
+    const ac_vec3* scales,
+    size_t         count
+);
+/**
+ * \ingroup mat4
+ * \brief Creates a view matrix looking from a point towards a target.
+ * \param[in] eye The position of the viewer.
+ * \param[in] target The point to look at.
+ * \param[in] up The up direction, which must not be parallel to the view direction.
+ * \return The view matrix, the same as gluLookAt.
+ */
+ac_mat4 ac_mat4_look_at(const ac_vec3* eye, const ac_vec3* target, const ac_vec3* up);
+/**
+ * \ingroup mat4
+ * \brief Creates a perspective projection matrix.
+ * \param[in] fov_y The vertical field of view in radians.
+ * \param[in] aspect The width of the view divided by its height.
+ * \param[in] near_plane The distance to the near clipping plane.
+ * \param[in] far_plane The distance to the far clipping plane.
+ * \return The projection matrix, the same as gluPerspective.
+ */
+ac_mat4 ac_mat4_perspective(float fov_y, float aspect, float near_plane, float far_plane);
+/**
+ * \ingroup mat4
+ * \brief Multiplies two matrices: a * b.
+ * \param[in] a The first matrix.
+ * \param[in] b The second matrix.
+ * \return The product, which transforms by \p b then by \p a.
+ */
+ac_mat4 ac_mat4_mul(const ac_mat4* a, const ac_mat4* b);
+/**
+ * \ingroup mat4
+ * \brief Transforms a vector by a matrix: m * v.
+ * \param[in] m The matrix.
+ * \param[in] v The vector.
+ * \return The transformed vector.
+ */
+ac_vec4 ac_mat4_transform(const ac_mat4* m, const ac_vec4* v);
+/**
+ * \ingroup mat4
+ * \brief Transforms a point by an affine matrix, including its translation.
+ * \param[in] m The matrix.
+ * \param[in] point The point.
+ * \return The transformed point.
+ * \note The point is transformed with a w of one and the w of the result is discarded, so
+ * projection matrices need \ref ac_mat4_transform and a divide by w instead.
+ */
+ac_vec3 ac_mat4_transform_point(const ac_mat4* m, const ac_vec3* point);
+/**
+ * \ingroup mat4
+ * \brief Transforms a direction by a matrix, ignoring its translation.
+ * \param[in] m The matrix.
+ * \param[in] direction The direction.
+ * \return The transformed direction.
+ */
+ac_vec3 ac_mat4_transform_direction(const ac_mat4* m, const ac_vec3* direction);
+/**
+ * \ingroup mat4
+ * \brief Transforms an array of points by an affine matrix.
+ * \param[out] out The transformed points, which may be the same array as \p points.
+ * \param[in] m The matrix.
+ * \param[in] points The points.
+ * \param[in] count The number of points.
+ * \see ac_mat4_transform_point
+ */
+void    ac_mat4_transform_points_n(
+    ac_vec3* out, const ac_mat4* m, const ac_vec3* points, size_t count
+);
+/**
+ * \ingroup mat4
+ * \brief Transposes a matrix.
+ * \param[in] m The matrix.
+ * \return The transposed matrix.
+ */
+ac_mat4 ac_mat4_transpose(const ac_mat4* m);
+/**
+ * \ingroup mat4
+ * \brief Computes the determinant of a matrix.
+ * \param[in] m The matrix.
+ * \return The determinant.
+ */
+float   ac_mat4_determinant(const ac_mat4* m);
+/**
+ * \ingroup mat4
+ * \brief Inverts a matrix.
+ * \param[in] m The matrix.
+ * \return The inverse matrix.
+ * \details
+ * If the matrix has a determinant of zero, the returned matrix will have NaN components.
+ */
+ac_mat4 ac_mat4_inverse(const ac_mat4* m);
+/**
+ * \ingroup mat4
+ * \brief Extracts the upper-left 3x3 matrix, which is the rotation and scale of a transform.
+ * \param[in] m The matrix.
+ * \return The upper-left 3x3 matrix.
+ */
+ac_mat3 ac_mat4_to_mat3(const ac_mat4* m);
+
+#ifdef __cplusplus
+}
+#endif
@@ -5,6 +5,26 @@
 #pragma once
 #include <stdbool.h>
 
+#ifdef AC_MATH_INLINE
+    #define AC_MATH_API static inline
+#else
+    #define AC_MATH_API
+#endif
+
+/**
+ * \def AC_MATH_INLINE
+ * \brief Defined when the library is configured with the AC_MATH_INLINE CMake option.
+ * \details
+ * The vec2, ivec2, vec3, and ivec3 functions are then defined in their headers as static inline
+ * functions, so they can be inlined into calling code without link time optimisation. The library
+ * still exports the out-of-line functions, so code built without the option links against it
+ * unchanged.
+ */
+/**
+ * \def AC_MATH_API
+ * \brief Qualifies the vector functions, static inline when \ref AC_MATH_INLINE is defined.
+ */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
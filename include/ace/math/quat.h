@@ -0,0 +1,96 @@
+/**
+ * \file
+ * \brief Quaternion types and functions.
+ * \details
+ * Quaternions are used to store orientations. All of the functions expect unit quaternions other
+ * than \ref ac_quat_normalize, and \ref ac_quat_integrate renormalises its result so repeated
+ * integration does not drift away from unit length.
+ */
+#pragma once
+#include "vec3.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup quat quat
+ * \brief Quaternion and functions.
+ */
+
+/**
+ * \ingroup quat
+ * \union ac_quat
+ * \brief A quaternion of type float.
+ * \details
+ * The vector part is stored first, the identity is { 0, 0, 0, 1 }.
+ */
+typedef union ac_quat
+{
+    struct
+    {
+        float x, y, z, w;
+    };
+    float data[4];
+} ac_quat;
+
+/**
+ * \ingroup quat
+ * \brief Creates the identity quaternion, which is no rotation.
+ * \return The identity quaternion.
+ */
+ac_quat ac_quat_identity(void);
+/**
+ * \ingroup quat
+ * \brief Creates a quaternion rotating about an axis.
+ * \param[in] axis The unit axis of rotation.
+ * \param[in] angle The angle of rotation in radians, counter clockwise looking down the axis.
+ * \return The rotation.
+ */
+ac_quat ac_quat_from_axis_angle(const ac_vec3* axis, float angle);
+/**
+ * \ingroup quat
+ * \brief Multiplies two quaternions: a * b.
+ * \param[in] a The first quaternion.
+ * \param[in] b The second quaternion.
+ * \return The product, which rotates by \p b then by \p a.
+ */
+ac_quat ac_quat_mul(const ac_quat* a, const ac_quat* b);
+/**
+ * \ingroup quat
+ * \brief Computes the conjugate of a quaternion.
+ * \param[in] q The quaternion.
+ * \return The conjugate, which is the inverse rotation of a unit quaternion.
+ */
+ac_quat ac_quat_conjugate(const ac_quat* q);
+/**
+ * \ingroup quat
+ * \brief Normalises a quaternion to unit length.
+ * \param[in] q The quaternion.
+ * \return The normalised quaternion, or the identity if \p q has zero length.
+ */
+ac_quat ac_quat_normalize(const ac_quat* q);
+/**
+ * \ingroup quat
+ * \brief Rotates a vector by a quaternion.
+ * \param[in] q The unit quaternion.
+ * \param[in] v The vector.
+ * \return The rotated vector.
+ */
+ac_vec3 ac_quat_rotate(const ac_quat* q, const ac_vec3* v);
+/**
+ * \ingroup quat
+ * \brief Advances an orientation by an angular velocity.
+ * \param[in] q The unit quaternion.
+ * \param[in] angular_velocity The angular velocity in world space, in radians per second.
+ * \param[in] delta_time The time to advance by.
+ * \return The normalised new orientation.
+ * \details
+ * Integrates dq/dt = 0.5 * w * q with a single Euler step, which is accurate for the small angles
+ * covered by a physics step.
+ */
+ac_quat ac_quat_integrate(const ac_quat* q, const ac_vec3* angular_velocity, float delta_time);
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,8 +4,10 @@
  * \brief 2-component vector types and functions.
  */
 #pragma once
+#include "math.h"
 #include <limits.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,13 +52,13 @@ typedef union ac_vec2
  * \brief Creates a vector with all components set to zero.
  * \return A vector with all components set to zero.
  */
-ac_vec2 ac_vec2_zero(void);
+AC_MATH_API ac_vec2 ac_vec2_zero(void);
 /**
  * \ingroup vec2
  * \brief Creates a vector with all components set to NaN.
  * \return A vector with all components set to NaN.
  */
-ac_vec2 ac_vec2_nan(void);
+AC_MATH_API ac_vec2 ac_vec2_nan(void);
 /**
  * \ingroup vec2
  * \brief Checks if a vector has zero components.
@@ -65,14 +67,14 @@ ac_vec2 ac_vec2_nan(void);
  * \retval false one or more of the components of the vector are non-zero.
  * \note This function uses \ref AC_EPSILON as the epsilon value for floating point comparisons.
  */
-bool    ac_vec2_is_zero(const ac_vec2* v);
+AC_MATH_API bool    ac_vec2_is_zero(const ac_vec2* v);
 /**
  * \ingroup vec2
  * \brief Checks if a vector has NaN components.
  * \param[in] v The vector.
  * \return True if any of the components of the vector are NaN, false otherwise.
  */
-bool    ac_vec2_is_nan(const ac_vec2* v);
+AC_MATH_API bool    ac_vec2_is_nan(const ac_vec2* v);
 /**
  * \ingroup vec2
  * \brief Checks if two vectors are equal.
@@ -83,7 +85,7 @@ bool    ac_vec2_is_nan(const ac_vec2* v);
  * has NaN components. \note This function uses \ref AC_EPSILON as the epsilon value for floating
  * point comparisons.
  */
-bool    ac_vec2_is_equal(const ac_vec2* a, const ac_vec2* b);
+AC_MATH_API bool    ac_vec2_is_equal(const ac_vec2* a, const ac_vec2* b);
 /**
  * \ingroup vec2
  * \brief Adds two vectors: a + b.
@@ -91,7 +93,7 @@ bool    ac_vec2_is_equal(const ac_vec2* a, const ac_vec2* b);
  * \param[in] b The second vector.
  * \return The sum of the two vectors.
  */
-ac_vec2 ac_vec2_add(const ac_vec2* a, const ac_vec2* b);
+AC_MATH_API ac_vec2 ac_vec2_add(const ac_vec2* a, const ac_vec2* b);
 /**
  * \ingroup vec2
  * \brief Subtracts two vectors: a - b.
@@ -99,14 +101,14 @@ ac_vec2 ac_vec2_add(const ac_vec2* a, const ac_vec2* b);
  * \param[in] b The second vector.
  * \return The difference of the two vectors.
  */
-ac_vec2 ac_vec2_sub(const ac_vec2* a, const ac_vec2* b);
+AC_MATH_API ac_vec2 ac_vec2_sub(const ac_vec2* a, const ac_vec2* b);
 /**
  * \ingroup vec2
  * \brief Negates a vector.
  * \param[in] v The vector to negate.
  * \return The negated vector.
  */
-ac_vec2 ac_vec2_negate(const ac_vec2* v);
+AC_MATH_API ac_vec2 ac_vec2_negate(const ac_vec2* v);
 /**
  * \ingroup vec2
  * \brief Multiplies a vector by a scalar: a * scalar.
@@ -114,7 +116,7 @@ ac_vec2 ac_vec2_negate(const ac_vec2* v);
  * \param[in] scalar The scalar.
  * \return The scaled vector.
  */
-ac_vec2 ac_vec2_scale(const ac_vec2* v, float scalar);
+AC_MATH_API ac_vec2 ac_vec2_scale(const ac_vec2* v, float scalar);
 /**
  * \ingroup vec2
  * \brief Computes the dot product of two vectors.
@@ -122,14 +124,14 @@ ac_vec2 ac_vec2_scale(const ac_vec2* v, float scalar);
  * \param[in] b The second vector.
  * \return The dot product of the two vectors.
  */
-float   ac_vec2_dot(const ac_vec2* a, const ac_vec2* b);
+AC_MATH_API float   ac_vec2_dot(const ac_vec2* a, const ac_vec2* b);
 /**
  * \ingroup vec2
  * \brief Computes the length of a vector.
  * \param[in] v The vector.
  * \return The length of the vector.
  */
-float   ac_vec2_magnitude(const ac_vec2* v);
+AC_MATH_API float   ac_vec2_magnitude(const ac_vec2* v);
 /**
  * \ingroup vec2
  * \brief Normalizes a vector.
@@ -138,7 +140,7 @@ float   ac_vec2_magnitude(const ac_vec2* v);
  * \details
  * If the vector is of zero length or NaN, the returned vector will have NaN components.
  */
-ac_vec2 ac_vec2_normalize(const ac_vec2* v);
+AC_MATH_API ac_vec2 ac_vec2_normalize(const ac_vec2* v);
 
 //--------------------------------------------------------------------------------------------------
 // int
@@ -177,14 +179,14 @@ typedef union ac_ivec2
  * \brief Creates a vector with all components set to zero.
  * \return A vector with all components set to zero.
  */
-ac_ivec2 ac_ivec2_zero(void);
+AC_MATH_API ac_ivec2 ac_ivec2_zero(void);
 /**
  * \ingroup ivec2
  * \brief Creates a vector with all components set to an invalid sentinel.
  * \return A vector with all components set to an invalid sentinel.
  * \see INT_INVALID
  */
-ac_ivec2 ac_ivec2_invalid(void);
+AC_MATH_API ac_ivec2 ac_ivec2_invalid(void);
 /**
  * \ingroup ivec2
  * \brief Checks if a vector has zero components.
@@ -192,7 +194,7 @@ ac_ivec2 ac_ivec2_invalid(void);
  * \retval true if all of the components of the vector are zero.
  * \retval false one or more of the components of the vector are non-zero.
  */
-bool     ac_ivec2_is_zero(const ac_ivec2* v);
+AC_MATH_API bool     ac_ivec2_is_zero(const ac_ivec2* v);
 /**
  * \ingroup ivec2
  * \brief Checks if a vector has invalid components.
@@ -201,7 +203,7 @@ bool     ac_ivec2_is_zero(const ac_ivec2* v);
  * \retval false if all of the components of the vector are valid.
  * \see INT_INVALID
  */
-bool     ac_ivec2_is_invalid(const ac_ivec2* v);
+AC_MATH_API bool     ac_ivec2_is_invalid(const ac_ivec2* v);
 /**
  * \ingroup ivec2
  * \brief Checks if two vectors are equal.
@@ -210,7 +212,7 @@ bool     ac_ivec2_is_invalid(const ac_ivec2* v);
  * \retval true if all of the components of the vectors are equal.
  * \retval false if one or more of the components of the vectors are not equal.
  */
-bool     ac_ivec2_is_equal(const ac_ivec2* a, const ac_ivec2* b);
+AC_MATH_API bool     ac_ivec2_is_equal(const ac_ivec2* a, const ac_ivec2* b);
 /**
  * \ingroup ivec2
  * \brief Adds two vectors: a + b.
@@ -218,9 +220,10 @@ bool     ac_ivec2_is_equal(const ac_ivec2* a, const ac_ivec2* b);
  * \param[in] b The second vector.
  * \return The sum of the two vectors.
  * \note If either vector has invalid components, the result will be the invalid ac_ivec2.
+ * \note If any component of the result overflows, the result will be the invalid ac_ivec2.
  * \see ac_ivec2_is_invalid
  */
-ac_ivec2 ac_ivec2_add(const ac_ivec2* a, const ac_ivec2* b);
+AC_MATH_API ac_ivec2 ac_ivec2_add(const ac_ivec2* a, const ac_ivec2* b);
 /**
  * \ingroup ivec2
  * \brief Subtracts two vectors: a - b.
@@ -228,9 +231,10 @@ ac_ivec2 ac_ivec2_add(const ac_ivec2* a, const ac_ivec2* b);
  * \param[in] b The second vector.
  * \return The difference of the two vectors.
  * \note If either vector has invalid components, the result will be the invalid ac_ivec2.
+ * \note If any component of the result overflows, the result will be the invalid ac_ivec2.
  * \see ac_ivec2_is_invalid
  */
-ac_ivec2 ac_ivec2_sub(const ac_ivec2* a, const ac_ivec2* b);
+AC_MATH_API ac_ivec2 ac_ivec2_sub(const ac_ivec2* a, const ac_ivec2* b);
 /**
  * \ingroup ivec2
  * \brief Negates a vector.
@@ -239,7 +243,7 @@ ac_ivec2 ac_ivec2_sub(const ac_ivec2* a, const ac_ivec2* b);
  * \note If the vector has invalid components, the result will be the invalid ac_ivec2.
  * \see ac_ivec2_is_invalid
  */
-ac_ivec2 ac_ivec2_negate(const ac_ivec2* v);
+AC_MATH_API ac_ivec2 ac_ivec2_negate(const ac_ivec2* v);
 /**
  * \ingroup ivec2
  * \brief Multiplies a vector by a scalar: a * scalar.
@@ -247,9 +251,10 @@ ac_ivec2 ac_ivec2_negate(const ac_ivec2* v);
  * \param[in] scalar The scalar.
  * \return The scaled vector.
  * \note If the vector has invalid components, the result will be the invalid ac_ivec2.
+ * \note If any component of the result overflows, the result will be the invalid ac_ivec2.
  * \see ac_ivec2_is_invalid
  */
-ac_ivec2 ac_ivec2_scale(const ac_ivec2* v, int scalar);
+AC_MATH_API ac_ivec2 ac_ivec2_scale(const ac_ivec2* v, int scalar);
 /**
  * \ingroup ivec2
  * \brief Divides a vector by a scalar: a / scalar.
@@ -265,7 +270,7 @@ ac_ivec2 ac_ivec2_scale(const ac_ivec2* v, int scalar);
  * floor of the division. If you need a different behavior for this rounding,
  * use \ref ac_ivec2_divide_ext.
  */
-ac_ivec2 ac_ivec2_divide(const ac_ivec2* v, int scalar);
+AC_MATH_API ac_ivec2 ac_ivec2_divide(const ac_ivec2* v, int scalar);
 /**
  * \ingroup ivec2
  * \brief Divides a vector by a scalar: a / scalar.
@@ -282,7 +287,9 @@ ac_ivec2 ac_ivec2_divide(const ac_ivec2* v, int scalar);
  * The result of the division is then rounded using this function.
  * If the result of the standard C integer division is desired, use \ref ac_ivec2_divide.
  */
-ac_ivec2 ac_ivec2_divide_ext(const ac_ivec2* v, int scalar, int (*rounding_func)(float));
+AC_MATH_API ac_ivec2 ac_ivec2_divide_ext(
+    const ac_ivec2* v, int scalar, int (*rounding_func)(float)
+);
 /**
  * \ingroup ivec2
  * \brief Computes the dot product of two vectors.
@@ -291,8 +298,12 @@ ac_ivec2 ac_ivec2_divide_ext(const ac_ivec2* v, int scalar, int (*rounding_func)
  * \return The dot product of the two vectors.
  * \note If either vector has invalid components, the result will be \ref INT_INVALID.
  */
-int      ac_ivec2_dot(const ac_ivec2* a, const ac_ivec2* b);
+AC_MATH_API int      ac_ivec2_dot(const ac_ivec2* a, const ac_ivec2* b);
 
 #ifdef __cplusplus
 }
 #endif
+
+#ifdef AC_MATH_INLINE
+    #include "vec2.inl"
+#endif
@@ -0,0 +1,239 @@
+/**
+ * \file
+ * \brief 2-component vector function definitions.
+ * \details
+ * Included by vec2.h to provide static inline definitions when \ref AC_MATH_INLINE is defined, and
+ * by vec2.c to provide the exported definitions otherwise.
+ */
+#pragma once
+#include "vec2.h"
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//--------------------------------------------------------------------------------------------------
+// float
+//--------------------------------------------------------------------------------------------------
+
+AC_MATH_API ac_vec2 ac_vec2_zero(void)
+{
+    ac_vec2 result = { { 0.0f, 0.0f } };
+    return result;
+}
+
+AC_MATH_API ac_vec2 ac_vec2_nan(void)
+{
+    ac_vec2 result = { { NAN, NAN } };
+    return result;
+}
+
+AC_MATH_API bool ac_vec2_is_zero(const ac_vec2* v)
+{
+    return ac_vec2_magnitude(v) <= AC_EPSILON;
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+AC_MATH_API bool ac_vec2_is_nan(const ac_vec2* v)
+{
+    return (isnan(v->x) || isnan(v->y));
+}
+
+AC_MATH_API bool ac_vec2_is_equal(const ac_vec2* a, const ac_vec2* b)
+{
+    ac_vec2 diff = ac_vec2_sub(a, b);
+    return ac_vec2_is_zero(&diff);
+}
+
+AC_MATH_API ac_vec2 ac_vec2_add(const ac_vec2* a, const ac_vec2* b)
+{
+    ac_vec2 result = { { a->x + b->x, a->y + b->y } };
+    return result;
+}
+
+AC_MATH_API ac_vec2 ac_vec2_sub(const ac_vec2* a, const ac_vec2* b)
+{
+    ac_vec2 result = { { a->x - b->x, a->y - b->y } };
+    return result;
+}
+
+AC_MATH_API ac_vec2 ac_vec2_negate(const ac_vec2* v)
+{
+    ac_vec2 result = { { -v->x, -v->y } };
+    return result;
+}
+
+AC_MATH_API ac_vec2 ac_vec2_scale(const ac_vec2* v, float scalar)
+{
+    ac_vec2 result = { { v->x * scalar, v->y * scalar } };
+    return result;
+}
+
+AC_MATH_API float ac_vec2_dot(const ac_vec2* a, const ac_vec2* b)
+{
+    return (a->x * b->x + a->y * b->y);
+}
+
+AC_MATH_API float ac_vec2_magnitude(const ac_vec2* v)
+{
+    return sqrtf(ac_vec2_dot(v, v));
+}
+
+AC_MATH_API ac_vec2 ac_vec2_normalize(const ac_vec2* v)
+{
+    float magnitude = ac_vec2_magnitude(v);
+    if ( magnitude <= AC_EPSILON )
+    {
+        return ac_vec2_nan();
+    }
+
+    // calculate the inverse magnitude and scale the vector
+    float inv_magnitude = 1.0f / magnitude;
+    return ac_vec2_scale(v, inv_magnitude);
+}
+
+//--------------------------------------------------------------------------------------------------
+// int
+//--------------------------------------------------------------------------------------------------
+
+AC_MATH_API ac_ivec2 ac_ivec2_zero(void)
+{
+    ac_ivec2 result = { { 0, 0 } };
+    return result;
+}
+
+AC_MATH_API ac_ivec2 ac_ivec2_invalid(void)
+{
+    ac_ivec2 result = { { INT_INVALID, INT_INVALID } };
+    return result;
+}
+
+AC_MATH_API bool ac_ivec2_is_zero(const ac_ivec2* v)
+{
+    return (v->x == 0 && v->y == 0);
+}
+
+AC_MATH_API bool ac_ivec2_is_invalid(const ac_ivec2* v)
+{
+    return (v->x == INT_INVALID || v->y == INT_INVALID);
+}
+
+AC_MATH_API bool ac_ivec2_is_equal(const ac_ivec2* a, const ac_ivec2* b)
+{
+    if ( ac_ivec2_is_invalid(a) || ac_ivec2_is_invalid(b) )
+    {
+        return false;
+    }
+
+    return (a->x == b->x && a->y == b->y);
+}
+
+AC_MATH_API ac_ivec2 ac_ivec2_add(const ac_ivec2* a, const ac_ivec2* b)
+{
+    // widened to 64 bits so that overflow is detectable, and the tests are combined without
+    // branches so that the compiler can keep the whole vector in registers
+    ac_ivec2 result;
+    bool     invalid = false;
+    for ( int i = 0; i < 2; i++ )
+    {
+        int64_t sum    = (int64_t) a->data[i] + b->data[i];
+        invalid        = invalid | (a->data[i] == INT_INVALID) | (b->data[i] == INT_INVALID)
+                | (sum < -INT_MAX) | (sum > INT_MAX);
+        result.data[i] = (int) sum;
+    }
+    for ( int i = 0; i < 2; i++ )
+    {
+        result.data[i] = invalid ? INT_INVALID : result.data[i];
+    }
+    return result;
+}
+
+AC_MATH_API ac_ivec2 ac_ivec2_sub(const ac_ivec2* a, const ac_ivec2* b)
+{
+    ac_ivec2 result;
+    bool     invalid = false;
+    for ( int i = 0; i < 2; i++ )
+    {
+        int64_t diff   = (int64_t) a->data[i] - b->data[i];
+        invalid        = invalid | (a->data[i] == INT_INVALID) | (b->data[i] == INT_INVALID)
+                | (diff < -INT_MAX) | (diff > INT_MAX);
+        result.data[i] = (int) diff;
+    }
+    for ( int i = 0; i < 2; i++ )
+    {
+        result.data[i] = invalid ? INT_INVALID : result.data[i];
+    }
+    return result;
+}
+
+AC_MATH_API ac_ivec2 ac_ivec2_negate(const ac_ivec2* v)
+{
+    if ( ac_ivec2_is_invalid(v) )
+    {
+        return ac_ivec2_invalid();
+    }
+
+    ac_ivec2 result = { { -v->x, -v->y } };
+    return result;
+}
+
+AC_MATH_API ac_ivec2 ac_ivec2_scale(const ac_ivec2* v, int scalar)
+{
+    ac_ivec2 result;
+    bool     invalid = false;
+    for ( int i = 0; i < 2; i++ )
+    {
+        int64_t product = (int64_t) v->data[i] * scalar;
+        invalid         = invalid | (v->data[i] == INT_INVALID) | (product < -INT_MAX)
+                | (product > INT_MAX);
+        result.data[i]  = (int) product;
+    }
+    for ( int i = 0; i < 2; i++ )
+    {
+        result.data[i] = invalid ? INT_INVALID : result.data[i];
+    }
+    return result;
+}
+
+AC_MATH_API ac_ivec2 ac_ivec2_divide(const ac_ivec2* v, int scalar)
+{
+    if ( ac_ivec2_is_invalid(v) || scalar == 0 )
+    {
+        return ac_ivec2_invalid();
+    }
+
+    ac_ivec2 result = { { v->x / scalar, v->y / scalar } };
+    return result;
+}
+
+AC_MATH_API ac_ivec2 ac_ivec2_divide_ext(const ac_ivec2* v, int scalar, int (*rounding_func)(float))
+{
+    if ( ac_ivec2_is_invalid(v) || scalar == 0 )
+    {
+        return ac_ivec2_invalid();
+    }
+
+    // convert to float
+    float scalarf = (float) scalar;
+    float xf      = (float) v->x;
+    float yf      = (float) v->y;
+
+    // divide and round
+    ac_ivec2 result = { { rounding_func(xf / scalarf), rounding_func(yf / scalarf) } };
+    return result;
+}
+
+AC_MATH_API int ac_ivec2_dot(const ac_ivec2* a, const ac_ivec2* b)
+{
+    if ( ac_ivec2_is_invalid(a) || ac_ivec2_is_invalid(b) )
+    {
+        return INT_INVALID;
+    }
+
+    return (a->x * b->x + a->y * b->y);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,8 +4,11 @@
  * \brief 3-component vector types and functions.
  */
 #pragma once
+#include "math.h"
 #include <limits.h>
+#include <math.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -45,18 +48,53 @@ typedef union ac_vec3
     float data[3];
 } ac_vec3;
 
+/**
+ * \ingroup vec3
+ * \def AC_VEC3_LITERAL
+ * \brief A vector literal from three components, usable as a value in C and C++.
+ * \details
+ * Unlike \ref ac_vec3_make this is a constant expression the compiler can fold, so a loop that
+ * stores it becomes plain stores or a memset even when the vector functions are not inlined.
+ */
+#ifdef __cplusplus
+    #define AC_VEC3_LITERAL(x, y, z) (ac_vec3{ { (x), (y), (z) } })
+#else
+    #define AC_VEC3_LITERAL(x, y, z) ((ac_vec3){ { (x), (y), (z) } })
+#endif
+/**
+ * \ingroup vec3
+ * \def AC_VEC3_ZERO
+ * \brief The vector literal with all components set to zero.
+ */
+#define AC_VEC3_ZERO AC_VEC3_LITERAL(0.0f, 0.0f, 0.0f)
+/**
+ * \ingroup vec3
+ * \def AC_VEC3_NAN
+ * \brief The vector literal with all components set to NaN.
+ */
+#define AC_VEC3_NAN  AC_VEC3_LITERAL(NAN, NAN, NAN)
+
+/**
+ * \ingroup vec3
+ * \brief Creates a vector from its components.
+ * \param[in] x The x component.
+ * \param[in] y The y component.
+ * \param[in] z The z component.
+ * \return The vector.
+ */
+AC_MATH_API ac_vec3 ac_vec3_make(float x, float y, float z);
 /**
  * \ingroup vec3
  * \brief Creates a vector with all components set to zero.
  * \return A vector with all components set to zero.
  */
-ac_vec3 ac_vec3_zero(void);
+AC_MATH_API ac_vec3 ac_vec3_zero(void);
 /**
  * \ingroup vec3
  * \brief Creates a vector with all components set to NaN.
  * \return A vector with all components set to NaN.
  */
-ac_vec3 ac_vec3_nan(void);
+AC_MATH_API ac_vec3 ac_vec3_nan(void);
 /**
  * \ingroup vec3
  * \brief Checks if a vector has zero components.
@@ -65,14 +103,14 @@ ac_vec3 ac_vec3_nan(void);
  * \retval false one or more of the components of the vector are non-zero.
  * \note This function uses \ref AC_EPSILON as the epsilon value for floating point comparisons.
  */
-bool    ac_vec3_is_zero(const ac_vec3* v);
+AC_MATH_API bool    ac_vec3_is_zero(const ac_vec3* v);
 /**
  * \ingroup vec3
  * \brief Checks if a vector has NaN components.
  * \param[in] v The vector.
  * \return True if any of the components of the vector are NaN, false otherwise.
  */
-bool    ac_vec3_is_nan(const ac_vec3* v);
+AC_MATH_API bool    ac_vec3_is_nan(const ac_vec3* v);
 /**
  * \ingroup vec3
  * \brief Checks if two vectors are equal.
@@ -83,7 +121,7 @@ bool    ac_vec3_is_nan(const ac_vec3* v);
  * has NaN components. \note This function uses \ref AC_EPSILON as the epsilon value for floating
  * point comparisons.
  */
-bool    ac_vec3_is_equal(const ac_vec3* a, const ac_vec3* b);
+AC_MATH_API bool    ac_vec3_is_equal(const ac_vec3* a, const ac_vec3* b);
 /**
  * \ingroup vec3
  * \brief Adds two vectors: a + b.
@@ -91,7 +129,7 @@ bool    ac_vec3_is_equal(const ac_vec3* a, const ac_vec3* b);
  * \param[in] b The second vector.
  * \return The sum of the two vectors.
  */
-ac_vec3 ac_vec3_add(const ac_vec3* a, const ac_vec3* b);
+AC_MATH_API ac_vec3 ac_vec3_add(const ac_vec3* a, const ac_vec3* b);
 /**
  * \ingroup vec3
  * \brief Subtracts two vectors: a - b.
@@ -99,14 +137,14 @@ ac_vec3 ac_vec3_add(const ac_vec3* a, const ac_vec3* b);
  * \param[in] b The second vector.
  * \return The difference of the two vectors.
  */
-ac_vec3 ac_vec3_sub(const ac_vec3* a, const ac_vec3* b);
+AC_MATH_API ac_vec3 ac_vec3_sub(const ac_vec3* a, const ac_vec3* b);
 /**
  * \ingroup vec3
  * \brief Negates a vector.
  * \param[in] v The vector to negate.
  * \return The negated vector.
  */
-ac_vec3 ac_vec3_negate(const ac_vec3* v);
+AC_MATH_API ac_vec3 ac_vec3_negate(const ac_vec3* v);
 /**
  * \ingroup vec3
  * \brief Multiplies a vector by a scalar: a * scalar.
@@ -114,7 +152,7 @@ ac_vec3 ac_vec3_negate(const ac_vec3* v);
  * \param[in] scalar The scalar.
  * \return The scaled vector.
  */
-ac_vec3 ac_vec3_scale(const ac_vec3* v, float scalar);
+AC_MATH_API ac_vec3 ac_vec3_scale(const ac_vec3* v, float scalar);
 /**
  * \ingroup vec3
  * \brief Computes the dot product of two vectors.
@@ -122,7 +160,7 @@ ac_vec3 ac_vec3_scale(const ac_vec3* v, float scalar);
  * \param[in] b The second vector.
  * \return The dot product of the two vectors.
  */
-float   ac_vec3_dot(const ac_vec3* a, const ac_vec3* b);
+AC_MATH_API float   ac_vec3_dot(const ac_vec3* a, const ac_vec3* b);
 /**
  * \ingroup vec3
  * \brief Computes the cross product of two vectors: a x b.
@@ -130,14 +168,14 @@ float   ac_vec3_dot(const ac_vec3* a, const ac_vec3* b);
  * \param[in] b The second vector.
  * \return The cross product of the two vectors.
  */
-ac_vec3 ac_vec3_cross(const ac_vec3* a, const ac_vec3* b);
+AC_MATH_API ac_vec3 ac_vec3_cross(const ac_vec3* a, const ac_vec3* b);
 /**
  * \ingroup vec3
  * \brief Computes the length of a vector.
  * \param[in] v The vector.
  * \return The length of the vector.
  */
-float   ac_vec3_magnitude(const ac_vec3* v);
+AC_MATH_API float   ac_vec3_magnitude(const ac_vec3* v);
 /**
  * \ingroup vec3
  * \brief Normalizes a vector.
@@ -146,7 +184,7 @@ float   ac_vec3_magnitude(const ac_vec3* v);
  * \details
  * If the vector is of zero length or NaN, the returned vector will have NaN components.
  */
-ac_vec3 ac_vec3_normalize(const ac_vec3* v);
+AC_MATH_API ac_vec3 ac_vec3_normalize(const ac_vec3* v);
 
 //--------------------------------------------------------------------------------------------------
 // int
@@ -185,14 +223,14 @@ typedef union ac_ivec3
  * \brief Creates a vector with all components set to zero.
  * \return A vector with all components set to zero.
  */
-ac_ivec3 ac_ivec3_zero(void);
+AC_MATH_API ac_ivec3 ac_ivec3_zero(void);
 /**
  * \ingroup ivec3
  * \brief Creates a vector with all components set to an invalid sentinel.
  * \return A vector with all components set to an invalid sentinel.
  * \see INT_INVALID
  */
-ac_ivec3 ac_ivec3_invalid(void);
+AC_MATH_API ac_ivec3 ac_ivec3_invalid(void);
 /**
  * \ingroup ivec3
  * \brief Checks if a vector has zero components.
@@ -200,7 +238,7 @@ ac_ivec3 ac_ivec3_invalid(void);
  * \retval true if all of the components of the vector are zero.
  * \retval false one or more of the components of the vector are non-zero.
  */
-bool     ac_ivec3_is_zero(const ac_ivec3* v);
+AC_MATH_API bool     ac_ivec3_is_zero(const ac_ivec3* v);
 /**
  * \ingroup ivec3
  * \brief Checks if a vector has invalid components.
@@ -209,7 +247,7 @@ bool     ac_ivec3_is_zero(const ac_ivec3* v);
  * \retval false if all of the components of the vector are valid.
  * \see INT_INVALID
  */
-bool     ac_ivec3_is_invalid(const ac_ivec3* v);
+AC_MATH_API bool     ac_ivec3_is_invalid(const ac_ivec3* v);
 /**
  * \ingroup ivec3
  * \brief Checks if two vectors are equal.
@@ -218,7 +256,7 @@ bool     ac_ivec3_is_invalid(const ac_ivec3* v);
  * \retval true if all of the components of the vectors are equal.
  * \retval false if one or more of the components of the vectors are not equal, or invalid.
  */
-bool     ac_ivec3_is_equal(const ac_ivec3* a, const ac_ivec3* b);
+AC_MATH_API bool     ac_ivec3_is_equal(const ac_ivec3* a, const ac_ivec3* b);
 /**
  * \ingroup ivec3
  * \brief Adds two vectors: a + b.
@@ -226,9 +264,10 @@ bool     ac_ivec3_is_equal(const ac_ivec3* a, const ac_ivec3* b);
  * \param[in] b The second vector.
  * \return The sum of the two vectors.
  * \note If either vector has invalid components, the result will be the invalid ac_ivec3.
+ * \note If any component of the result overflows, the result will be the invalid ac_ivec3.
  * \see ac_ivec3_is_invalid
  */
-ac_ivec3 ac_ivec3_add(const ac_ivec3* a, const ac_ivec3* b);
+AC_MATH_API ac_ivec3 ac_ivec3_add(const ac_ivec3* a, const ac_ivec3* b);
 /**
  * \ingroup ivec3
  * \brief Subtracts two vectors: a - b.
@@ -236,9 +275,10 @@ ac_ivec3 ac_ivec3_add(const ac_ivec3* a, const ac_ivec3* b);
  * \param[in] b The second vector.
  * \return The difference of the two vectors.
  * \note If either vector has invalid components, the result will be the invalid ac_ivec3.
+ * \note If any component of the result overflows, the result will be the invalid ac_ivec3.
  * \see ac_ivec3_is_invalid
  */
-ac_ivec3 ac_ivec3_sub(const ac_ivec3* a, const ac_ivec3* b);
+AC_MATH_API ac_ivec3 ac_ivec3_sub(const ac_ivec3* a, const ac_ivec3* b);
 /**
  * \ingroup ivec3
  * \brief Negates a vector.
@@ -247,7 +287,7 @@ ac_ivec3 ac_ivec3_sub(const ac_ivec3* a, const ac_ivec3* b);
  * \note If the vector has invalid components, the result will be the invalid ac_ivec3.
  * \see ac_ivec3_is_invalid
  */
-ac_ivec3 ac_ivec3_negate(const ac_ivec3* v);
+AC_MATH_API ac_ivec3 ac_ivec3_negate(const ac_ivec3* v);
 /**
  * \ingroup ivec3
  * \brief Multiplies a vector by a scalar: a * scalar.
@@ -255,9 +295,10 @@ ac_ivec3 ac_ivec3_negate(const ac_ivec3* v);
  * \param[in] scalar The scalar.
  * \return The scaled vector.
  * \note If the vector has invalid components, the result will be the invalid ac_ivec3.
+ * \note If any component of the result overflows, the result will be the invalid ac_ivec3.
  * \see ac_ivec3_is_invalid
  */
-ac_ivec3 ac_ivec3_scale(const ac_ivec3* v, int scalar);
+AC_MATH_API ac_ivec3 ac_ivec3_scale(const ac_ivec3* v, int scalar);
 /**
  * \ingroup ivec3
  * \brief Divides a vector by a scalar: a / scalar.
@@ -273,7 +314,7 @@ ac_ivec3 ac_ivec3_scale(const ac_ivec3* v, int scalar);
  * floor of the division. If you need a different behavior for this rounding,
  * use \ref ac_ivec3_divide_ext.
  */
-ac_ivec3 ac_ivec3_divide(const ac_ivec3* v, int scalar);
+AC_MATH_API ac_ivec3 ac_ivec3_divide(const ac_ivec3* v, int scalar);
 /**
  * \ingroup ivec3
  * \brief Divides a vector by a scalar: a / scalar.
@@ -290,7 +331,9 @@ ac_ivec3 ac_ivec3_divide(const ac_ivec3* v, int scalar);
  * The result of the division is then rounded using this function.
  * If the result of the standard C integer division is desired, use \ref ac_ivec3_divide.
  */
-ac_ivec3 ac_ivec3_divide_ext(const ac_ivec3* v, int scalar, int (*rounding_func)(float));
+AC_MATH_API ac_ivec3 ac_ivec3_divide_ext(
+    const ac_ivec3* v, int scalar, int (*rounding_func)(float)
+);
 /**
  * \ingroup ivec3
  * \brief Computes the dot product of two vectors.
@@ -299,7 +342,7 @@ ac_ivec3 ac_ivec3_divide_ext(const ac_ivec3* v, int scalar, int (*rounding_func)
  * \return The dot product of the two vectors.
  * \note If either vector has invalid components, the result will be \ref INT_INVALID.
  */
-int      ac_ivec3_dot(const ac_ivec3* a, const ac_ivec3* b);
+AC_MATH_API int      ac_ivec3_dot(const ac_ivec3* a, const ac_ivec3* b);
 /**
  * \ingroup ivec3
  * \brief Computes the cross product of two vectors: a x b.
@@ -309,8 +352,12 @@ int      ac_ivec3_dot(const ac_ivec3* a, const ac_ivec3* b);
  * \note If either vector has invalid components, the result will be the invalid ac_ivec3.
  * \see ac_ivec3_is_invalid
  */
-ac_ivec3 ac_ivec3_cross(const ac_ivec3* a, const ac_ivec3* b);
+AC_MATH_API ac_ivec3 ac_ivec3_cross(const ac_ivec3* a, const ac_ivec3* b);
 
 #ifdef __cplusplus
 }
 #endif
+
+#ifdef AC_MATH_INLINE
+    #include "vec3.inl"
+#endif
@@ -0,0 +1,266 @@
+/**
+ * \file
+ * \brief 3-component vector function definitions.
+ * \details
+ * Included by vec3.h to provide static inline definitions when \ref AC_MATH_INLINE is defined, and
+ * by vec3.c to provide the exported definitions otherwise.
+ */
+#pragma once
+#include "vec3.h"
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//--------------------------------------------------------------------------------------------------
+// float
+//--------------------------------------------------------------------------------------------------
+
+AC_MATH_API ac_vec3 ac_vec3_make(float x, float y, float z)
+{
+    return AC_VEC3_LITERAL(x, y, z);
+}
+
+AC_MATH_API ac_vec3 ac_vec3_zero(void)
+{
+    return AC_VEC3_ZERO;
+}
+
+AC_MATH_API ac_vec3 ac_vec3_nan(void)
+{
+    return AC_VEC3_NAN;
+}
+
+AC_MATH_API bool ac_vec3_is_zero(const ac_vec3* v)
+{
+    return ac_vec3_magnitude(v) <= AC_EPSILON;
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+AC_MATH_API bool ac_vec3_is_nan(const ac_vec3* v)
+{
+    return (isnan(v->x) || isnan(v->y) || isnan(v->z));
+}
+
+AC_MATH_API bool ac_vec3_is_equal(const ac_vec3* a, const ac_vec3* b)
+{
+    ac_vec3 diff = ac_vec3_sub(a, b);
+    return ac_vec3_is_zero(&diff);
+}
+
+AC_MATH_API ac_vec3 ac_vec3_add(const ac_vec3* a, const ac_vec3* b)
+{
+    ac_vec3 result = { { a->x + b->x, a->y + b->y, a->z + b->z } };
+    return result;
+}
+
+AC_MATH_API ac_vec3 ac_vec3_sub(const ac_vec3* a, const ac_vec3* b)
+{
+    ac_vec3 result = { { a->x - b->x, a->y - b->y, a->z - b->z } };
+    return result;
+}
+
+AC_MATH_API ac_vec3 ac_vec3_negate(const ac_vec3* v)
+{
+    ac_vec3 result = { { -v->x, -v->y, -v->z } };
+    return result;
+}
+
+AC_MATH_API ac_vec3 ac_vec3_scale(const ac_vec3* v, float scalar)
+{
+    ac_vec3 result = { { v->x * scalar, v->y * scalar, v->z * scalar } };
+    return result;
+}
+
+AC_MATH_API float ac_vec3_dot(const ac_vec3* a, const ac_vec3* b)
+{
+    return (a->x * b->x + a->y * b->y + a->z * b->z);
+}
+
+AC_MATH_API ac_vec3 ac_vec3_cross(const ac_vec3* a, const ac_vec3* b)
+{
+    ac_vec3 result = {
+        { a->y * b->z - a->z * b->y, a->z * b->x - a->x * b->z, a->x * b->y - a->y * b->x }
+    };
+    return result;
+}
+
+AC_MATH_API float ac_vec3_magnitude(const ac_vec3* v)
+{
+    return sqrtf(ac_vec3_dot(v, v));
+}
+
+AC_MATH_API ac_vec3 ac_vec3_normalize(const ac_vec3* v)
+{
+    float magnitude = ac_vec3_magnitude(v);
+    if ( magnitude <= AC_EPSILON )
+    {
+        return ac_vec3_nan();
+    }
+
+    // calculate the inverse magnitude and scale the vector
+    float inv_magnitude = 1.0f / magnitude;
+    return ac_vec3_scale(v, inv_magnitude);
+}
+
+//--------------------------------------------------------------------------------------------------
+// int
+//--------------------------------------------------------------------------------------------------
+
+AC_MATH_API ac_ivec3 ac_ivec3_zero(void)
+{
+    ac_ivec3 result = { { 0, 0, 0 } };
+    return result;
+}
+
+AC_MATH_API ac_ivec3 ac_ivec3_invalid(void)
+{
+    ac_ivec3 result = { { INT_INVALID, INT_INVALID, INT_INVALID } };
+    return result;
+}
+
+AC_MATH_API bool ac_ivec3_is_zero(const ac_ivec3* v)
+{
+    return (v->x == 0 && v->y == 0 && v->z == 0);
+}
+
+AC_MATH_API bool ac_ivec3_is_invalid(const ac_ivec3* v)
+{
+    return (v->x == INT_INVALID || v->y == INT_INVALID || v->z == INT_INVALID);
+}
+
+AC_MATH_API bool ac_ivec3_is_equal(const ac_ivec3* a, const ac_ivec3* b)
+{
+    if ( ac_ivec3_is_invalid(a) || ac_ivec3_is_invalid(b) )
+    {
+        return false;
+    }
+
+    return (a->x == b->x && a->y == b->y && a->z == b->z);
+}
+
+AC_MATH_API ac_ivec3 ac_ivec3_add(const ac_ivec3* a, const ac_ivec3* b)
+{
+    // widened to 64 bits so that overflow is detectable, and the tests are combined without
+    // branches so that the compiler can keep the whole vector in registers
+    ac_ivec3 result;
+    bool     invalid = false;
+    for ( int i = 0; i < 3; i++ )
+    {
+        int64_t sum    = (int64_t) a->data[i] + b->data[i];
+        invalid        = invalid | (a->data[i] == INT_INVALID) | (b->data[i] == INT_INVALID)
+                | (sum < -INT_MAX) | (sum > INT_MAX);
+        result.data[i] = (int) sum;
+    }
+    for ( int i = 0; i < 3; i++ )
+    {
+        result.data[i] = invalid ? INT_INVALID : result.data[i];
+    }
+    return result;
+}
+
+AC_MATH_API ac_ivec3 ac_ivec3_sub(const ac_ivec3* a, const ac_ivec3* b)
+{
+    ac_ivec3 result;
+    bool     invalid = false;
+    for ( int i = 0; i < 3; i++ )
+    {
+        int64_t diff   = (int64_t) a->data[i] - b->data[i];
+        invalid        = invalid | (a->data[i] == INT_INVALID) | (b->data[i] == INT_INVALID)
+                | (diff < -INT_MAX) | (diff > INT_MAX);
+        result.data[i] = (int) diff;
+    }
+    for ( int i = 0; i < 3; i++ )
+    {
+        result.data[i] = invalid ? INT_INVALID : result.data[i];
+    }
+    return result;
+}
+
+AC_MATH_API ac_ivec3 ac_ivec3_negate(const ac_ivec3* v)
+{
+    if ( ac_ivec3_is_invalid(v) )
+    {
+        return ac_ivec3_invalid();
+    }
+
+    ac_ivec3 result = { { -v->x, -v->y, -v->z } };
+    return result;
+}
+
+AC_MATH_API ac_ivec3 ac_ivec3_scale(const ac_ivec3* v, int scalar)
+{
+    ac_ivec3 result;
+    bool     invalid = false;
+    for ( int i = 0; i < 3; i++ )
+    {
+        int64_t product = (int64_t) v->data[i] * scalar;
+        invalid         = invalid | (v->data[i] == INT_INVALID) | (product < -INT_MAX)
+                | (product > INT_MAX);
+        result.data[i]  = (int) product;
+    }
+    for ( int i = 0; i < 3; i++ )
+    {
+        result.data[i] = invalid ? INT_INVALID : result.data[i];
+    }
+    return result;
+}
+
+AC_MATH_API ac_ivec3 ac_ivec3_divide(const ac_ivec3* v, int scalar)
+{
+    if ( ac_ivec3_is_invalid(v) || scalar == 0 )
+    {
+        return ac_ivec3_invalid();
+    }
+
+    ac_ivec3 result = { { v->x / scalar, v->y / scalar, v->z / scalar } };
+    return result;
+}
+
+AC_MATH_API ac_ivec3 ac_ivec3_divide_ext(const ac_ivec3* v, int scalar, int (*rounding_func)(float))
+{
+    if ( ac_ivec3_is_invalid(v) || scalar == 0 )
+    {
+        return ac_ivec3_invalid();
+    }
+
+    // convert to float
+    float scalarf = (float) scalar;
+    float xf      = (float) v->x;
+    float yf      = (float) v->y;
+    float zf      = (float) v->z;
+
+    // divide and round
+    ac_ivec3 result = {
+        { rounding_func(xf / scalarf), rounding_func(yf / scalarf), rounding_func(zf / scalarf) }
+    };
+    return result;
+}
+
+AC_MATH_API int ac_ivec3_dot(const ac_ivec3* a, const ac_ivec3* b)
+{
+    if ( ac_ivec3_is_invalid(a) || ac_ivec3_is_invalid(b) )
+    {
+        return INT_INVALID;
+    }
+
+    return (a->x * b->x + a->y * b->y + a->z * b->z);
+}
+
+AC_MATH_API ac_ivec3 ac_ivec3_cross(const ac_ivec3* a, const ac_ivec3* b)
+{
+    if ( ac_ivec3_is_invalid(a) || ac_ivec3_is_invalid(b) )
+    {
+        return ac_ivec3_invalid();
+    }
+
+    ac_ivec3 result = {
+        { a->y * b->z - a->z * b->y, a->z * b->x - a->x * b->z, a->x * b->y - a->y * b->x }
+    };
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif
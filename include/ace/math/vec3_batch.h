@@ -0,0 +1,208 @@
+/**
+ * \file
+ * \brief Batch functions for arrays of 3-component vectors.
+ * \details
+ * Each function applies one of the single vector functions to every element of its arrays, and
+ * gives the same results as calling that function in a loop. The arrays can be stored as an array
+ * of \ref ac_vec3, or as separate x, y, and z float arrays described by an \ref ac_vec3_soa. The
+ * integer functions take arrays of \ref ac_ivec3, such as the cell coordinates of a spatial grid.
+ *
+ * The loops are vectorised by the compiler. On x86-64 Linux they are also built for AVX2, and the
+ * version used is chosen for the processor when the program loads.
+ *
+ * An output array may be the same array as one of the inputs, but must not partially overlap one.
+ */
+#pragma once
+#include "vec3.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \ingroup vec3
+ * \struct ac_vec3_soa
+ * \brief An array of 3-component vectors stored as one float array per component.
+ * \details
+ * Element i of the array is { x[i], y[i], z[i] }. The three arrays must each hold at least as
+ * many elements as are passed to the functions.
+ */
+typedef struct ac_vec3_soa
+{
+    float* x;
+    float* y;
+    float* z;
+} ac_vec3_soa;
+
+/**
+ * \ingroup vec3
+ * \brief Adds two arrays of vectors: out[i] = a[i] + b[i].
+ * \param[out] out The sums.
+ * \param[in] a The first vectors.
+ * \param[in] b The second vectors.
+ * \param[in] count The number of vectors in each array.
+ */
+void ac_vec3_add_n(ac_vec3* out, const ac_vec3* a, const ac_vec3* b, size_t count);
+/**
+ * \ingroup vec3
+ * \brief Scales an array of vectors and adds a second: out[i] = x[i] * scalar + y[i].
+ * \param[out] out The results.
+ * \param[in] x The vectors to scale.
+ * \param[in] scalar The scalar.
+ * \param[in] y The vectors to add.
+ * \param[in] count The number of vectors in each array.
+ * \details
+ * Passing \p y as \p out accumulates in place, for example integrating positions with
+ * velocities and a time step.
+ */
+void ac_vec3_scale_add_n(
+    ac_vec3* out, const ac_vec3* x, float scalar, const ac_vec3* y, size_t count
+);
+/**
+ * \ingroup vec3
+ * \brief Computes the dot products of two arrays of vectors: out[i] = a[i] . b[i].
+ * \param[out] out The dot products.
+ * \param[in] a The first vectors.
+ * \param[in] b The second vectors.
+ * \param[in] count The number of vectors in each array.
+ */
+void ac_vec3_dot_n(float* out, const ac_vec3* a, const ac_vec3* b, size_t count);
+/**
+ * \ingroup vec3
+ * \brief Computes the squared lengths of an array of vectors.
+ * \param[out] out The squared lengths.
+ * \param[in] v The vectors.
+ * \param[in] count The number of vectors.
+ */
+void ac_vec3_length_sq_n(float* out, const ac_vec3* v, size_t count);
+/**
+ * \ingroup vec3
+ * \brief Normalizes an array of vectors.
+ * \param[out] out The normalized vectors.
+ * \param[in] v The vectors.
+ * \param[in] count The number of vectors.
+ * \details
+ * As with \ref ac_vec3_normalize, vectors of zero length or NaN give vectors with NaN components.
+ */
+void ac_vec3_normalize_n(ac_vec3* out, const ac_vec3* v, size_t count);
+/**
+ * \ingroup vec3
+ * \brief Linearly interpolates between two arrays of vectors.
+ * \param[out] out The interpolated vectors.
+ * \param[in] a The first vectors.
+ * \param[in] b The second vectors.
+ * \param[in] interpolation_factor The amount to interpolate, clamped between 0 and 1.
+ * \param[in] count The number of vectors in each array.
+ */
+void ac_vec3_lerp_n(
+    ac_vec3* out, const ac_vec3* a, const ac_vec3* b, float interpolation_factor, size_t count
+);
+
+/**
+ * \ingroup vec3
+ * \brief Adds two arrays of vectors: out[i] = a[i] + b[i].
+ * \param[out] out The sums.
+ * \param[in] a The first vectors.
+ * \param[in] b The second vectors.
+ * \param[in] count The number of vectors in each array.
+ */
+void ac_vec3_soa_add_n(
+    const ac_vec3_soa* out, const ac_vec3_soa* a, const ac_vec3_soa* b, size_t count
+);
+/**
+ * \ingroup vec3
+ * \brief Scales an array of vectors and adds a second: out[i] = x[i] * scalar + y[i].
+ * \param[out] out The results.
+ * \param[in] x The vectors to scale.
+ * \param[in] scalar The scalar.
+ * \param[in] y The vectors to add.
+ * \param[in] count The number of vectors in each array.
+ */
+void ac_vec3_soa_scale_add_n(
+    const ac_vec3_soa* out, const ac_vec3_soa* x, float scalar, const ac_vec3_soa* y, size_t count
+);
+/**
+ * \ingroup vec3
+ * \brief Computes the dot products of two arrays of vectors: out[i] = a[i] . b[i].
+ * \param[out] out The dot products.
+ * \param[in] a The first vectors.
+ * \param[in] b The second vectors.
+ * \param[in] count The number of vectors in each array.
+ */
+void ac_vec3_soa_dot_n(float* out, const ac_vec3_soa* a, const ac_vec3_soa* b, size_t count);
+/**
+ * \ingroup vec3
+ * \brief Computes the squared lengths of an array of vectors.
+ * \param[out] out The squared lengths.
+ * \param[in] v The vectors.
+ * \param[in] count The number of vectors.
+ */
+void ac_vec3_soa_length_sq_n(float* out, const ac_vec3_soa* v, size_t count);
+/**
+ * \ingroup vec3
+ * \brief Normalizes an array of vectors.
+ * \param[out] out The normalized vectors.
+ * \param[in] v The vectors.
+ * \param[in] count The number of vectors.
+ * \details
+ * As with \ref ac_vec3_normalize, vectors of zero length or NaN give vectors with NaN components.
+ */
+void ac_vec3_soa_normalize_n(const ac_vec3_soa* out, const ac_vec3_soa* v, size_t count);
+/**
+ * \ingroup vec3
+ * \brief Linearly interpolates between two arrays of vectors.
+ * \param[out] out The interpolated vectors.
+ * \param[in] a The first vectors.
+ * \param[in] b The second vectors.
+ * \param[in] interpolation_factor The amount to interpolate, clamped between 0 and 1.
+ * \param[in] count The number of vectors in each array.
+ */
+void ac_vec3_soa_lerp_n(
+    const ac_vec3_soa* out,
+    const ac_vec3_soa* a,
+    const ac_vec3_soa* b,
+    float              interpolation_factor,
+    size_t             count
+);
+
+/**
+ * \ingroup ivec3
+ * \brief Adds two arrays of vectors: out[i] = a[i] + b[i].
+ * \param[out] out The sums.
+ * \param[in] a The first vectors.
+ * \param[in] b The second vectors.
+ * \param[in] count The number of vectors in each array.
+ * \details
+ * As with \ref ac_ivec3_add, a sum with invalid inputs or an overflowing component is the invalid
+ * ac_ivec3.
+ */
+void ac_ivec3_add_n(ac_ivec3* out, const ac_ivec3* a, const ac_ivec3* b, size_t count);
+/**
+ * \ingroup ivec3
+ * \brief Subtracts two arrays of vectors: out[i] = a[i] - b[i].
+ * \param[out] out The differences.
+ * \param[in] a The first vectors.
+ * \param[in] b The second vectors.
+ * \param[in] count The number of vectors in each array.
+ * \details
+ * As with \ref ac_ivec3_sub, a difference with invalid inputs or an overflowing component is the
+ * invalid ac_ivec3.
+ */
+void ac_ivec3_sub_n(ac_ivec3* out, const ac_ivec3* a, const ac_ivec3* b, size_t count);
+/**
+ * \ingroup ivec3
+ * \brief Multiplies an array of vectors by a scalar: out[i] = v[i] * scalar.
+ * \param[out] out The scaled vectors.
+ * \param[in] v The vectors.
+ * \param[in] scalar The scalar.
+ * \param[in] count The number of vectors.
+ * \details
+ * As with \ref ac_ivec3_scale, a product with invalid inputs or an overflowing component is the
+ * invalid ac_ivec3.
+ */
+void ac_ivec3_scale_n(ac_ivec3* out, const ac_ivec3* v, int scalar, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
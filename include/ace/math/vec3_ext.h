@@ -26,6 +26,16 @@ extern "C" {
  * If either vector is of zero length or NaN, the returned angle will be NaN.
  */
 float   ac_vec3_angle(const ac_vec3* a, const ac_vec3* b);
+/**
+ * \ingroup vec3
+ * \brief Calculate the angle between two vectors without validating them.
+ * \param[in] a The first vector, which must not be of zero length or NaN.
+ * \param[in] b The second vector, which must not be of zero length or NaN.
+ * \return The angle between the two vectors in radians.
+ * \details
+ * The inputs are only checked in builds that define AC_DEBUG, which abort if they are invalid.
+ */
+float   ac_vec3_angle_unchecked(const ac_vec3* a, const ac_vec3* b);
 /**
  * \ingroup vec3
  * \brief Calculate the Euclidean distance between two vectors.
@@ -55,6 +65,16 @@ ac_vec3 ac_vec3_lerp(const ac_vec3* a, const ac_vec3* b, float interpolation_fac
  * If either vector is of zero length or NaN, the returned vector will have NaN components.
  */
 ac_vec3 ac_vec3_project(const ac_vec3* a, const ac_vec3* b);
+/**
+ * \ingroup vec3
+ * \brief Project a vector onto another vector without validating them.
+ * \param[in] a The vector to project, which must not be of zero length or NaN.
+ * \param[in] b The vector to project onto, which must not be of zero length or NaN.
+ * \return The projected vector, a onto b.
+ * \details
+ * The inputs are only checked in builds that define AC_DEBUG, which abort if they are invalid.
+ */
+ac_vec3 ac_vec3_project_unchecked(const ac_vec3* a, const ac_vec3* b);
 /**
  * \ingroup vec3
  * \brief Calculate the reflected vector about a normal.
@@ -65,6 +85,17 @@ ac_vec3 ac_vec3_project(const ac_vec3* a, const ac_vec3* b);
  * If either vector is of zero length or NaN, the returned vector will have NaN components.
  */
 ac_vec3 ac_vec3_reflect(const ac_vec3* incoming, const ac_vec3* normal);
+/**
+ * \ingroup vec3
+ * \brief Calculate the reflected vector about a unit normal without validating them.
+ * \param[in] incoming The vector to reflect, which must not be of zero length or NaN.
+ * \param[in] normal The normal vector, which must already be of unit length.
+ * \return The reflected vector.
+ * \details
+ * Unlike \ref ac_vec3_reflect the normal is not normalized. The inputs are only checked in
+ * builds that define AC_DEBUG, which abort if they are invalid.
+ */
+ac_vec3 ac_vec3_reflect_unchecked(const ac_vec3* incoming, const ac_vec3* normal);
 
 #ifdef __cplusplus
 }
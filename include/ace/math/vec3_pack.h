@@ -0,0 +1,222 @@
+/**
+ * \file
+ * \brief Packed storage formats for 3-component vectors.
+ * \details
+ * An \ref ac_vec3 is always 12 bytes. These formats store a vector in fewer bytes for snapshots,
+ * replays, and network messages, at the cost of precision:
+ * - \ref ac_half_vec3 stores each component as an IEEE 754 half-precision float, 6 bytes, with
+ *   11 significant bits and a range of +-65504.
+ * - \ref ac_unorm16_vec3 stores each component as a 16-bit fraction of the way between a lower
+ *   and an upper bound, 6 bytes, with a step of 1/65535 of the bounds on that axis.
+ * - \ref ac_oct_normal stores a unit vector as two 16-bit coordinates on the octahedron that
+ *   encloses the unit sphere, 4 bytes, within about 0.0001 radians of the original direction.
+ *
+ * Each format has a single vector encode and decode, and a batch version of each for arrays. The
+ * batch loops are vectorised by the compiler in the same way as the \ref vec3_batch.h functions,
+ * and give the same results as the single vector functions. An output array must not overlap its
+ * input.
+ *
+ * The half-precision conversions are integer operations on the bits of the floats, so they give
+ * the same bytes on every platform.
+ */
+#pragma once
+#include "vec3.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup pack pack
+ * \brief Packed storage formats for vectors.
+ */
+
+/**
+ * \ingroup pack
+ * \union ac_half_vec3
+ * \brief A 3-component vector of IEEE 754 half-precision floats.
+ */
+typedef union ac_half_vec3
+{
+    struct
+    {
+        uint16_t x, y, z;
+    };
+    uint16_t data[3];
+} ac_half_vec3;
+
+/**
+ * \ingroup pack
+ * \union ac_unorm16_vec3
+ * \brief A 3-component vector of 16-bit fractions between a lower and an upper bound.
+ * \details
+ * A component of 0 is the lower bound and 65535 is the upper bound. The bounds are not stored,
+ * the same bounds must be passed to encode and decode.
+ */
+typedef union ac_unorm16_vec3
+{
+    struct
+    {
+        uint16_t x, y, z;
+    };
+    uint16_t data[3];
+} ac_unorm16_vec3;
+
+/**
+ * \ingroup pack
+ * \union ac_oct_normal
+ * \brief A unit vector encoded as two signed 16-bit octahedral coordinates.
+ */
+typedef union ac_oct_normal
+{
+    struct
+    {
+        int16_t x, y;
+    };
+    int16_t data[2];
+} ac_oct_normal;
+
+//--------------------------------------------------------------------------------------------------
+// half-precision
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \ingroup pack
+ * \brief Converts a float to half-precision.
+ * \param[in] value The float.
+ * \return The half-precision bits, rounded to the nearest value with ties to even.
+ * \details
+ * Values beyond the half-precision range become infinity and NaN stays NaN.
+ */
+uint16_t     ac_float_to_half(float value);
+/**
+ * \ingroup pack
+ * \brief Converts half-precision to a float.
+ * \param[in] half The half-precision bits.
+ * \return The float, which is exact.
+ */
+float        ac_half_to_float(uint16_t half);
+/**
+ * \ingroup pack
+ * \brief Converts a float vector to half-precision.
+ * \param[in] v The float vector.
+ * \return The half-precision vector.
+ */
+ac_half_vec3 ac_half_vec3_from_vec3(const ac_vec3* v);
+/**
+ * \ingroup pack
+ * \brief Converts a half-precision vector to a float vector.
+ * \param[in] v The half-precision vector.
+ * \return The float vector.
+ */
+ac_vec3      ac_half_vec3_to_vec3(const ac_half_vec3* v);
+/**
+ * \ingroup pack
+ * \brief Converts an array of float vectors to half-precision.
+ * \param[out] out The half-precision vectors.
+ * \param[in] v The float vectors.
+ * \param[in] count The number of vectors.
+ */
+void         ac_half_vec3_from_vec3_n(ac_half_vec3* out, const ac_vec3* v, size_t count);
+/**
+ * \ingroup pack
+ * \brief Converts an array of half-precision vectors to float vectors.
+ * \param[out] out The float vectors.
+ * \param[in] v The half-precision vectors.
+ * \param[in] count The number of vectors.
+ */
+void         ac_half_vec3_to_vec3_n(ac_vec3* out, const ac_half_vec3* v, size_t count);
+
+//--------------------------------------------------------------------------------------------------
+// bounded 16-bit
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \ingroup pack
+ * \brief Encodes a vector as 16-bit fractions between two bounds.
+ * \param[in] v The vector.
+ * \param[in] min The lower bound of each component.
+ * \param[in] max The upper bound of each component, which must be greater than \p min.
+ * \return The encoded vector, rounded to the nearest step.
+ * \details
+ * Components outside the bounds are clamped to them, and NaN components encode as the lower bound.
+ */
+ac_unorm16_vec3 ac_unorm16_vec3_from_vec3(
+    const ac_vec3* v, const ac_vec3* min, const ac_vec3* max
+);
+/**
+ * \ingroup pack
+ * \brief Decodes a vector stored as 16-bit fractions between two bounds.
+ * \param[in] v The encoded vector.
+ * \param[in] min The lower bound it was encoded with.
+ * \param[in] max The upper bound it was encoded with.
+ * \return The vector, within about half a step of the encoded one when it was inside the bounds.
+ */
+ac_vec3 ac_unorm16_vec3_to_vec3(const ac_unorm16_vec3* v, const ac_vec3* min, const ac_vec3* max);
+/**
+ * \ingroup pack
+ * \brief Encodes an array of vectors as 16-bit fractions between two bounds.
+ * \param[out] out The encoded vectors.
+ * \param[in] v The vectors.
+ * \param[in] min The lower bound of each component.
+ * \param[in] max The upper bound of each component, which must be greater than \p min.
+ * \param[in] count The number of vectors.
+ */
+void    ac_unorm16_vec3_from_vec3_n(
+    ac_unorm16_vec3* out, const ac_vec3* v, const ac_vec3* min, const ac_vec3* max, size_t count
+);
+/**
+ * \ingroup pack
+ * \brief Decodes an array of vectors stored as 16-bit fractions between two bounds.
+ * \param[out] out The vectors.
+ * \param[in] v The encoded vectors.
+ * \param[in] min The lower bound they were encoded with.
+ * \param[in] max The upper bound they were encoded with.
+ * \param[in] count The number of vectors.
+ */
+void    ac_unorm16_vec3_to_vec3_n(
+    ac_vec3* out, const ac_unorm16_vec3* v, const ac_vec3* min, const ac_vec3* max, size_t count
+);
+
+//--------------------------------------------------------------------------------------------------
+// octahedral
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \ingroup pack
+ * \brief Encodes a unit vector with octahedral coordinates.
+ * \param[in] n The vector, which is projected onto the unit sphere so need not be normalized.
+ * \return The encoded vector.
+ * \details
+ * A vector of zero length or with NaN components encodes as { 0, 0, 1 }.
+ */
+ac_oct_normal ac_oct_normal_from_vec3(const ac_vec3* n);
+/**
+ * \ingroup pack
+ * \brief Decodes a unit vector stored with octahedral coordinates.
+ * \param[in] n The encoded vector.
+ * \return The unit vector.
+ */
+ac_vec3       ac_oct_normal_to_vec3(const ac_oct_normal* n);
+/**
+ * \ingroup pack
+ * \brief Encodes an array of unit vectors with octahedral coordinates.
+ * \param[out] out The encoded vectors.
+ * \param[in] n The vectors.
+ * \param[in] count The number of vectors.
+ */
+void          ac_oct_normal_from_vec3_n(ac_oct_normal* out, const ac_vec3* n, size_t count);
+/**
+ * \ingroup pack
+ * \brief Decodes an array of unit vectors stored with octahedral coordinates.
+ * \param[out] out The unit vectors.
+ * \param[in] n The encoded vectors.
+ * \param[in] count The number of vectors.
+ */
+void          ac_oct_normal_to_vec3_n(ac_vec3* out, const ac_oct_normal* n, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
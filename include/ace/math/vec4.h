@@ -0,0 +1,216 @@
+/**
+ * \file
+ * \brief Aligned 4-component vector types and functions.
+ * \details
+ * An \ref ac_vec4 occupies a whole 16 byte SIMD register, so its functions load and store it
+ * without the shuffles an \ref ac_vec3 needs. The functions use SSE on x86 and NEON on ARM, and
+ * plain C elsewhere. A vector converted from an \ref ac_vec3 with a w of zero gives the same
+ * results as the \ref ac_vec3 functions, which lets code keep its data as \ref ac_vec3 and switch
+ * to \ref ac_vec4 only in its inner loops.
+ */
+#pragma once
+#include "math.h"
+#include "vec3.h"
+#include <stdbool.h>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #define AC_VEC4_SSE
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define AC_VEC4_NEON
+#endif
+
+#ifdef __cplusplus
+    #define AC_ALIGN(bytes) alignas(bytes)
+#else
+    #define AC_ALIGN(bytes) _Alignas(bytes)
+#endif
+
+/**
+ * \def AC_VEC4_SSE
+ * \brief Defined when the \ref ac_vec4 functions are implemented with SSE.
+ */
+/**
+ * \def AC_VEC4_NEON
+ * \brief Defined when the \ref ac_vec4 functions are implemented with NEON.
+ */
+/**
+ * \def AC_ALIGN
+ * \brief Aligns a declaration to a number of bytes in both C and C++.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup vec4 vec4
+ * \brief Aligned 4-component float vector and functions.
+ */
+
+/**
+ * \ingroup vec4
+ * \union ac_vec4
+ * \brief A 4-component vector of type float, aligned to 16 bytes.
+ * \details
+ * A standard 4-component vector of type float which provides 'aliases' for
+ * axes, colors, and elements.
+ */
+typedef union ac_vec4
+{
+    struct
+    {
+        float x, y, z, w;
+    };
+    struct
+    {
+        float r, g, b, a;
+    };
+    AC_ALIGN(16) float data[4];
+} ac_vec4;
+
+/**
+ * \ingroup vec4
+ * \brief Creates a vector with all components set to zero.
+ * \return A vector with all components set to zero.
+ */
+AC_MATH_API ac_vec4 ac_vec4_zero(void);
+/**
+ * \ingroup vec4
+ * \brief Creates a vector with all components set to NaN.
+ * \return A vector with all components set to NaN.
+ */
+AC_MATH_API ac_vec4 ac_vec4_nan(void);
+/**
+ * \ingroup vec4
+ * \brief Widens a 3-component vector.
+ * \param[in] v The vector.
+ * \param[in] w The fourth component, 0 for directions and 1 for points.
+ * \return The widened vector.
+ */
+AC_MATH_API ac_vec4 ac_vec4_from_vec3(const ac_vec3* v, float w);
+/**
+ * \ingroup vec4
+ * \brief Narrows a vector to its first three components.
+ * \param[in] v The vector.
+ * \return The x, y, and z components of the vector.
+ */
+AC_MATH_API ac_vec3 ac_vec4_to_vec3(const ac_vec4* v);
+/**
+ * \ingroup vec4
+ * \brief Checks if a vector has zero components.
+ * \param[in] v The vector.
+ * \retval true if all of the components of the vector are zero, false otherwise.
+ * \retval false one or more of the components of the vector are non-zero.
+ * \note This function uses \ref AC_EPSILON as the epsilon value for floating point comparisons.
+ */
+AC_MATH_API bool    ac_vec4_is_zero(const ac_vec4* v);
+/**
+ * \ingroup vec4
+ * \brief Checks if a vector has NaN components.
+ * \param[in] v The vector.
+ * \return True if any of the components of the vector are NaN, false otherwise.
+ */
+AC_MATH_API bool    ac_vec4_is_nan(const ac_vec4* v);
+/**
+ * \ingroup vec4
+ * \brief Checks if two vectors are equal.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \retval true if all of the components of the vectors are equal, false otherwise.
+ * \retval false if one or more of the components of the vectors are not equal, or if either vector
+ * has NaN components.
+ * \note This function uses \ref AC_EPSILON as the epsilon value for floating point comparisons.
+ */
+AC_MATH_API bool    ac_vec4_is_equal(const ac_vec4* a, const ac_vec4* b);
+/**
+ * \ingroup vec4
+ * \brief Adds two vectors: a + b.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The sum of the two vectors.
+ */
+AC_MATH_API ac_vec4 ac_vec4_add(const ac_vec4* a, const ac_vec4* b);
+/**
+ * \ingroup vec4
+ * \brief Subtracts two vectors: a - b.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The difference of the two vectors.
+ */
+AC_MATH_API ac_vec4 ac_vec4_sub(const ac_vec4* a, const ac_vec4* b);
+/**
+ * \ingroup vec4
+ * \brief Negates a vector.
+ * \param[in] v The vector to negate.
+ * \return The negated vector.
+ */
+AC_MATH_API ac_vec4 ac_vec4_negate(const ac_vec4* v);
+/**
+ * \ingroup vec4
+ * \brief Multiplies a vector by a scalar: a * scalar.
+ * \param[in] v The vector.
+ * \param[in] scalar The scalar.
+ * \return The scaled vector.
+ */
+AC_MATH_API ac_vec4 ac_vec4_scale(const ac_vec4* v, float scalar);
+/**
+ * \ingroup vec4
+ * \brief Computes the dot product of two vectors.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The dot product of the two vectors.
+ * \details
+ * The products are summed as (x + z) + (y + w) on every platform so that the result does not
+ * depend on the instruction set.
+ */
+AC_MATH_API float   ac_vec4_dot(const ac_vec4* a, const ac_vec4* b);
+/**
+ * \ingroup vec4
+ * \brief Computes the cross product of the first three components of two vectors: a x b.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The cross product of the two vectors, with a w of zero for finite inputs.
+ */
+AC_MATH_API ac_vec4 ac_vec4_cross(const ac_vec4* a, const ac_vec4* b);
+/**
+ * \ingroup vec4
+ * \brief Computes the length of a vector.
+ * \param[in] v The vector.
+ * \return The length of the vector.
+ */
+AC_MATH_API float   ac_vec4_magnitude(const ac_vec4* v);
+/**
+ * \ingroup vec4
+ * \brief Normalizes a vector.
+ * \param[in] v The vector.
+ * \return The normalized vector.
+ * \details
+ * If the vector is of zero length or NaN, the returned vector will have NaN components.
+ */
+AC_MATH_API ac_vec4 ac_vec4_normalize(const ac_vec4* v);
+/**
+ * \ingroup vec4
+ * \brief Computes the componentwise minimum of two vectors.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The smaller of each pair of components.
+ * \note The result for NaN components depends on the platform.
+ */
+AC_MATH_API ac_vec4 ac_vec4_min(const ac_vec4* a, const ac_vec4* b);
+/**
+ * \ingroup vec4
+ * \brief Computes the componentwise maximum of two vectors.
+ * \param[in] a The first vector.
+ * \param[in] b The second vector.
+ * \return The larger of each pair of components.
+ * \note The result for NaN components depends on the platform.
+ */
+AC_MATH_API ac_vec4 ac_vec4_max(const ac_vec4* a, const ac_vec4* b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef AC_MATH_INLINE
+    #include "vec4.inl"
+#endif
@@ -0,0 +1,216 @@
+/**
+ * \file
+ * \brief Aligned 4-component vector function definitions.
+ * \details
+ * Included by vec4.h to provide static inline definitions when \ref AC_MATH_INLINE is defined, and
+ * by vec4.c to provide the exported definitions otherwise.
+ */
+#pragma once
+#include "vec4.h"
+#include <math.h>
+
+#if defined(AC_VEC4_SSE)
+    #include <xmmintrin.h>
+#elif defined(AC_VEC4_NEON)
+    #include <arm_neon.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+AC_MATH_API ac_vec4 ac_vec4_zero(void)
+{
+    ac_vec4 result = { { 0.0f, 0.0f, 0.0f, 0.0f } };
+    return result;
+}
+
+AC_MATH_API ac_vec4 ac_vec4_nan(void)
+{
+    ac_vec4 result = { { NAN, NAN, NAN, NAN } };
+    return result;
+}
+
+AC_MATH_API ac_vec4 ac_vec4_from_vec3(const ac_vec3* v, float w)
+{
+    ac_vec4 result = { { v->x, v->y, v->z, w } };
+    return result;
+}
+
+AC_MATH_API ac_vec3 ac_vec4_to_vec3(const ac_vec4* v)
+{
+    ac_vec3 result = { { v->x, v->y, v->z } };
+    return result;
+}
+
+AC_MATH_API bool ac_vec4_is_zero(const ac_vec4* v)
+{
+    return ac_vec4_magnitude(v) <= AC_EPSILON;
+}
+
+AC_MATH_API bool ac_vec4_is_nan(const ac_vec4* v)
+{
+    return (isnan(v->x) || isnan(v->y) || isnan(v->z) || isnan(v->w));
+}
+
+AC_MATH_API bool ac_vec4_is_equal(const ac_vec4* a, const ac_vec4* b)
+{
+    ac_vec4 diff = ac_vec4_sub(a, b);
+    return ac_vec4_is_zero(&diff);
+}
+
+AC_MATH_API ac_vec4 ac_vec4_add(const ac_vec4* a, const ac_vec4* b)
+{
+    ac_vec4 result;
+#if defined(AC_VEC4_SSE)
+    _mm_store_ps(result.data, _mm_add_ps(_mm_load_ps(a->data), _mm_load_ps(b->data)));
+#elif defined(AC_VEC4_NEON)
+    vst1q_f32(result.data, vaddq_f32(vld1q_f32(a->data), vld1q_f32(b->data)));
+#else
+    for ( int i = 0; i < 4; i++ )
+    {
+        result.data[i] = a->data[i] + b->data[i];
+    }
+#endif
+    return result;
+}
+
+AC_MATH_API ac_vec4 ac_vec4_sub(const ac_vec4* a, const ac_vec4* b)
+{
+    ac_vec4 result;
+#if defined(AC_VEC4_SSE)
+    _mm_store_ps(result.data, _mm_sub_ps(_mm_load_ps(a->data), _mm_load_ps(b->data)));
+#elif defined(AC_VEC4_NEON)
+    vst1q_f32(result.data, vsubq_f32(vld1q_f32(a->data), vld1q_f32(b->data)));
+#else
+    for ( int i = 0; i < 4; i++ )
+    {
+        result.data[i] = a->data[i] - b->data[i];
+    }
+#endif
+    return result;
+}
+
+AC_MATH_API ac_vec4 ac_vec4_negate(const ac_vec4* v)
+{
+    ac_vec4 result;
+#if defined(AC_VEC4_SSE)
+    // flip the sign bits so that zero becomes negative zero, as with the unary minus
+    _mm_store_ps(result.data, _mm_xor_ps(_mm_load_ps(v->data), _mm_set1_ps(-0.0f)));
+#elif defined(AC_VEC4_NEON)
+    vst1q_f32(result.data, vnegq_f32(vld1q_f32(v->data)));
+#else
+    for ( int i = 0; i < 4; i++ )
+    {
+        result.data[i] = -v->data[i];
+    }
+#endif
+    return result;
+}
+
+AC_MATH_API ac_vec4 ac_vec4_scale(const ac_vec4* v, float scalar)
+{
+    ac_vec4 result;
+#if defined(AC_VEC4_SSE)
+    _mm_store_ps(result.data, _mm_mul_ps(_mm_load_ps(v->data), _mm_set1_ps(scalar)));
+#elif defined(AC_VEC4_NEON)
+    vst1q_f32(result.data, vmulq_n_f32(vld1q_f32(v->data), scalar));
+#else
+    for ( int i = 0; i < 4; i++ )
+    {
+        result.data[i] = v->data[i] * scalar;
+    }
+#endif
+    return result;
+}
+
+AC_MATH_API float ac_vec4_dot(const ac_vec4* a, const ac_vec4* b)
+{
+    // the high half is folded onto the low half, then the two remaining lanes are added
+#if defined(AC_VEC4_SSE)
+    __m128 products = _mm_mul_ps(_mm_load_ps(a->data), _mm_load_ps(b->data));
+    __m128 pairs    = _mm_add_ps(products, _mm_movehl_ps(products, products));
+    __m128 sum      = _mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(sum);
+#elif defined(AC_VEC4_NEON)
+    float32x4_t products = vmulq_f32(vld1q_f32(a->data), vld1q_f32(b->data));
+    float32x2_t pairs    = vadd_f32(vget_low_f32(products), vget_high_f32(products));
+    return vget_lane_f32(vpadd_f32(pairs, pairs), 0);
+#else
+    return (a->x * b->x + a->z * b->z) + (a->y * b->y + a->w * b->w);
+#endif
+}
+
+AC_MATH_API ac_vec4 ac_vec4_cross(const ac_vec4* a, const ac_vec4* b)
+{
+    ac_vec4 result;
+#if defined(AC_VEC4_SSE)
+    // a * b.yzx - a.yzx * b gives the cross product in zxy order
+    __m128 va    = _mm_load_ps(a->data);
+    __m128 vb    = _mm_load_ps(b->data);
+    __m128 a_yzx = _mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 b_yzx = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 c     = _mm_sub_ps(_mm_mul_ps(va, b_yzx), _mm_mul_ps(a_yzx, vb));
+    _mm_store_ps(result.data, _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+#else
+    result.x = a->y * b->z - a->z * b->y;
+    result.y = a->z * b->x - a->x * b->z;
+    result.z = a->x * b->y - a->y * b->x;
+    result.w = 0.0f;
+#endif
+    return result;
+}
+
+AC_MATH_API float ac_vec4_magnitude(const ac_vec4* v)
+{
+    return sqrtf(ac_vec4_dot(v, v));
+}
+
+AC_MATH_API ac_vec4 ac_vec4_normalize(const ac_vec4* v)
+{
+    float magnitude = ac_vec4_magnitude(v);
+    if ( magnitude <= AC_EPSILON )
+    {
+        return ac_vec4_nan();
+    }
+
+    // calculate the inverse magnitude and scale the vector
+    float inv_magnitude = 1.0f / magnitude;
+    return ac_vec4_scale(v, inv_magnitude);
+}
+
+AC_MATH_API ac_vec4 ac_vec4_min(const ac_vec4* a, const ac_vec4* b)
+{
+    ac_vec4 result;
+#if defined(AC_VEC4_SSE)
+    _mm_store_ps(result.data, _mm_min_ps(_mm_load_ps(a->data), _mm_load_ps(b->data)));
+#elif defined(AC_VEC4_NEON)
+    vst1q_f32(result.data, vminq_f32(vld1q_f32(a->data), vld1q_f32(b->data)));
+#else
+    for ( int i = 0; i < 4; i++ )
+    {
+        result.data[i] = a->data[i] < b->data[i] ? a->data[i] : b->data[i];
+    }
+#endif
+    return result;
+}
+
+AC_MATH_API ac_vec4 ac_vec4_max(const ac_vec4* a, const ac_vec4* b)
+{
+    ac_vec4 result;
+#if defined(AC_VEC4_SSE)
+    _mm_store_ps(result.data, _mm_max_ps(_mm_load_ps(a->data), _mm_load_ps(b->data)));
+#elif defined(AC_VEC4_NEON)
+    vst1q_f32(result.data, vmaxq_f32(vld1q_f32(a->data), vld1q_f32(b->data)));
+#else
+    for ( int i = 0; i < 4; i++ )
+    {
+        result.data[i] = a->data[i] > b->data[i] ? a->data[i] : b->data[i];
+    }
+#endif
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif
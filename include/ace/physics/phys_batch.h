@@ -0,0 +1,97 @@
+/**
+ * \file
+ * \brief Steps many independent physics worlds across a pool of worker threads.
+ * \details
+ * A batch owns a fixed pool of worker threads which are reused for every call to
+ * \ref phys_batch_step. Worlds are partitioned statically between the workers, so a world is always
+ * stepped by the same worker. Worlds allocated with \ref phys_batch_clone_worlds are first written
+ * by the worker that will step them, which places their pages on that worker's NUMA node under a
+ * first-touch allocation policy.
+ *
+ * Worlds stepped by a batch must not share mutable state. Collision callbacks should be registered
+ * with \ref phys_add_world_collision_callback and reach their state through
+ * \ref PhysWorld::userData rather than through globals.
+ */
+#pragma once
+#include "phys_world.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \struct PhysBatch
+ * \brief An opaque pool of worker threads used to step worlds in parallel.
+ */
+typedef struct PhysBatch PhysBatch;
+
+/**
+ * \struct PhysBatchStats
+ * \brief Throughput statistics for a call to \ref phys_batch_step.
+ */
+typedef struct PhysBatchStats
+{
+    unsigned long long worldSteps;           ///< The number of world steps performed.
+    double             seconds;              ///< The wall-clock time taken, in seconds.
+    double             worldStepsPerSecond;  ///< The throughput, in world-steps per second.
+} PhysBatchStats;
+
+/**
+ * \brief Creates a batch with a pool of worker threads.
+ * \param numThreads The total number of threads to step worlds on, including the calling thread.
+ * \return A pointer to the batch, or NULL if it could not be created.
+ * \details
+ * A value of 0 or 1 steps every world on the calling thread. If the platform does not provide C11
+ * threads the batch always runs on the calling thread.
+ */
+PhysBatch*     phys_batch_create(unsigned numThreads);
+/**
+ * \brief Stops the worker threads and destroys the batch.
+ * \param batch The batch to destroy.
+ */
+void           phys_batch_destroy(PhysBatch* batch);
+/**
+ * \brief Returns the number of threads the batch steps worlds on.
+ * \param batch The batch.
+ * \return The number of threads, including the calling thread.
+ */
+unsigned       phys_batch_num_threads(const PhysBatch* batch);
+/**
+ * \brief Allocates an array of worlds, each a copy of \p source.
+ * \param batch The batch that will step the worlds.
+ * \param source The world to copy.
+ * \param numWorlds The number of worlds to allocate.
+ * \return A cache-line aligned array of worlds, or NULL if the allocation failed.
+ * \details
+ * Each copy is written by the worker which later steps it in \ref phys_batch_step, provided the
+ * same \p numWorlds is used. The returned array must be freed with \ref phys_batch_free_worlds.
+ *
+ * \ref PhysWorld::userData is not copied, it is NULL in every copy. Callbacks that use it need each
+ * world to be given its own state before calling \ref phys_batch_step.
+ */
+PhysWorld*     phys_batch_clone_worlds(
+        PhysBatch* batch, const PhysWorld* source, unsigned numWorlds
+    );
+/**
+ * \brief Frees an array of worlds allocated by \ref phys_batch_clone_worlds.
+ * \param worlds The worlds to free.
+ */
+void           phys_batch_free_worlds(PhysWorld* worlds);
+/**
+ * \brief Steps every world by a fixed number of time steps.
+ * \param batch The batch to step the worlds with.
+ * \param worlds The worlds to step.
+ * \param numWorlds The number of worlds.
+ * \param numSteps The number of time steps to advance each world by.
+ * \return The throughput of the call.
+ * \details
+ * Each world is advanced with \ref phys_step, using its own time step. The call returns once every
+ * world has been stepped.
+ */
+PhysBatchStats phys_batch_step(
+    PhysBatch* batch, PhysWorld* worlds, unsigned numWorlds, unsigned numSteps
+);
+
+#ifdef __cplusplus
+}
+#endif
@@ -5,12 +5,36 @@
  */
 #pragma once
 #include "phys_components.h"
+#include <ace/geometry/convex.h>
 #include <ace/geometry/intersection.h>
+#include <ace/geometry/manifold.h>
+#include <ace/math/quat.h>
+
+/**
+ * \def AC_PHYS_RESTITUTION_THRESHOLD
+ * \brief The approach speed below which \ref resolve_manifold does not bounce.
+ */
+#define AC_PHYS_RESTITUTION_THRESHOLD 0.2f
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * \struct PhysContactBody
+ * \brief One side of a contact, pointing into the state of an entity.
+ */
+typedef struct PhysContactBody
+{
+    ac_vec3*       position;         ///< The position of the body.
+    ac_vec3*       velocity;         ///< The velocity of the body.
+    ac_vec3*       angularVelocity;  ///< The angular velocity of the body in world space.
+    const ac_quat* orientation;      ///< The orientation of the body.
+    ac_vec3        inverseInertia;   ///< The body space inverse inertia for a mass of 1.
+    float          mass;             ///< The mass of the body.
+    bool           isStatic;         ///< Static bodies are not changed by the contact.
+} PhysContactBody;
+
 /**
  * \brief Checks for collision between two colliders.
  * \param c1 The first collider.
@@ -23,28 +47,127 @@ IntersectionResult check_collision(
     Collider* c1, ac_vec3* const p1, Collider* c2, ac_vec3* const p2
 );
 
+/**
+ * \brief Checks for collision between two colliders, warm-starting convex pairs.
+ * \param c1 The first collider.
+ * \param p1 The position of the first collider.
+ * \param c2 The second collider.
+ * \param p2 The position of the second collider.
+ * \param cache The cache of this pair's last convex query, or NULL.
+ * \return The result of the collision check.
+ * \details
+ * Pairs handled by \ref convex_convex are passed to \ref convex_intersect with \p cache, every
+ * other pair is passed to \ref check_collision.
+ */
+IntersectionResult check_collision_cached(
+    Collider* c1, ac_vec3* const p1, Collider* c2, ac_vec3* const p2, ConvexCache* cache
+);
+
+/**
+ * \brief Checks whether a pair of colliders is resolved with a contact manifold.
+ * \param c1 The first collider.
+ * \param c2 The second collider.
+ * \return True for pairs of AABBs and for AABBs against planes.
+ */
+bool uses_contact_manifold(const Collider* c1, const Collider* c2);
+
+/**
+ * \brief Finds the contact manifold between two colliders.
+ * \param c1 The first collider.
+ * \param p1 The position of the first collider.
+ * \param c2 The second collider.
+ * \param p2 The position of the second collider.
+ * \param[out] manifold The manifold, its normal points from \p c1 towards \p c2.
+ * \return True if the colliders intersect, false if they are apart or
+ * \ref uses_contact_manifold is false for them.
+ */
+bool check_manifold(
+    Collider* c1, ac_vec3* const p1, Collider* c2, ac_vec3* const p2, ContactManifold* manifold
+);
+
+/**
+ * \brief Checks for collision between a sphere and a baked static sphere.
+ * \param p1 The position of the sphere.
+ * \param radius The radius of the sphere.
+ * \param baked The baked static sphere.
+ * \return The result of the collision check, identical to \ref sphere_sphere.
+ */
+IntersectionResult sphere_baked_sphere(
+    const ac_vec3* p1, float radius, const PhysBakedStatic* baked
+);
+
+/**
+ * \brief Checks for collision between a sphere and a baked static AABB.
+ * \param p1 The position of the sphere.
+ * \param radius The radius of the sphere.
+ * \param baked The baked static AABB.
+ * \return The result of the collision check, identical to \ref sphere_AABB.
+ */
+IntersectionResult sphere_baked_AABB(const ac_vec3* p1, float radius, const PhysBakedStatic* baked);
+
+/**
+ * \brief Applies the world space inverse inertia tensor of a body to a vector.
+ * \param body The body.
+ * \param v The vector, such as a torque or an angular impulse.
+ * \return The change in angular velocity caused by \p v, zero for static bodies.
+ */
+ac_vec3 apply_inverse_inertia(const PhysContactBody* body, const ac_vec3* v);
+
 /**
  * \brief Resolves a collision between two objects.
  * \param info The result of the collision check.
- * \param pos1 The position of the first object.
- * \param v1 The velocity of the first object.
- * \param m1 The mass of the first object.
- * \param s1 The static flag of the first object.
- * \param pos2 The position of the second object.
- * \param v2 The velocity of the second object.
- * \param m2 The mass of the second object.
- * \param s2 The static flag of the second object.
+ * \param body1 The first object.
+ * \param body2 The second object.
+ * \param friction The sliding friction coefficient.
+ * \param rollingFriction The rolling friction coefficient.
+ * \details
+ * The impulses are applied at \ref IntersectionResult::contactPoint, so an off-centre contact
+ * spins the objects. Sliding friction opposes the tangential velocity of the contact point with
+ * an impulse of at most \p friction times the normal impulse. Rolling friction opposes the
+ * relative spin of the objects with an angular impulse of at most \p rollingFriction times the
+ * normal impulse times the radius of each object that can spin.
  */
 void resolve_collision(
     IntersectionResult* info,
-    ac_vec3*            pos1,
-    ac_vec3*            v1,
-    float               m1,
-    bool                s1,
-    ac_vec3*            pos2,
-    ac_vec3*            v2,
-    float               m2,
-    bool                s2
+    PhysContactBody*    body1,
+    PhysContactBody*    body2,
+    float               friction,
+    float               rollingFriction
+);
+
+/**
+ * \brief Resolves a collision whose contact is known to be valid.
+ * \param info The result of the collision check, its normal and point must not be NaN.
+ * \param body1 The first object.
+ * \param body2 The second object.
+ * \param friction The sliding friction coefficient.
+ * \param rollingFriction The rolling friction coefficient.
+ * \details
+ * Behaves as \ref resolve_collision without first skipping contacts that have a NaN normal or
+ * point. These are only checked in builds that define AC_DEBUG, which abort if either is NaN.
+ */
+void resolve_collision_unchecked(
+    IntersectionResult* info,
+    PhysContactBody*    body1,
+    PhysContactBody*    body2,
+    float               friction,
+    float               rollingFriction
+);
+
+/**
+ * \brief Resolves a collision described by a contact manifold.
+ * \param manifold The manifold, the impulses of its points are accumulated.
+ * \param body1 The first object.
+ * \param body2 The second object.
+ * \param warmStart Whether to first apply the impulses carried over from the last step.
+ * \details
+ * Each point is solved in turn with the total impulse at a point clamped to push only, so
+ * impulses carried over from the last step are removed if they are no longer needed. Contacts
+ * approaching slower than \ref AC_PHYS_RESTITUTION_THRESHOLD do not bounce, which lets stacked
+ * boxes come to rest. Friction is not yet applied to manifold contacts.
+ */
+void resolve_manifold(
+    ContactManifold* manifold, PhysContactBody* body1, PhysContactBody* body2, bool warmStart
 );
 
 #ifdef __cplusplus
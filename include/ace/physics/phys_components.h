@@ -4,19 +4,26 @@
  * \brief Contains the definitions for physics components.
  */
 #pragma once
+#include <ace/math/vec3.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+struct PhysWorld;
+
 /**
  * \enum ColliderType
  * \brief Enumeration for the types of colliders.
  */
 enum ColliderType
 {
-    SPHERE_C, /**< \brief Sphere collider type. */
-    AABB_C,   /**< \brief Axis-aligned bounding box collider type. */
+    SPHERE_C,      /**< \brief Sphere collider type. */
+    AABB_C,        /**< \brief Axis-aligned bounding box collider type. */
+    MESH_C,        /**< \brief Static triangle mesh collider type. */
+    HEIGHTFIELD_C, /**< \brief Static heightfield collider type. */
+    CONVEX_C,      /**< \brief Convex collider type described by a support function. */
+    PLANE_C,       /**< \brief Infinite plane collider type. */
 };
 
 /**
@@ -29,12 +36,38 @@ typedef struct
     void*             data; /**< \brief The data of the collider. */
 } Collider;
 
+/**
+ * \struct PhysBakedStatic
+ * \brief A static collider frozen by \ref phys_bake_static.
+ * \details
+ * The shape is stored by value so contacts against it need no indirection. Spheres store their
+ * radius in every component of the half extents, meshes and heightfields store their bounds and
+ * are tested through their collider. The struct is 32 bytes so two fit in a cache line.
+ */
+typedef struct PhysBakedStatic
+{
+    ac_vec3           center;      ///< The position of the static entity.
+    ac_vec3           halfExtents; ///< The half extents of the collider.
+    unsigned          entity;      ///< The slot index of the static entity.
+    enum ColliderType type;        ///< The type of the collider.
+} PhysBakedStatic;
+
 /**
  * \typedef PhysCallBack
  * \brief Typedef for a callback function.
  */
 typedef void (*PhysCallBack)(unsigned, unsigned);
 
+/**
+ * \typedef PhysWorldCallBack
+ * \brief Typedef for a callback function that receives the world that raised it.
+ * \details
+ * Unlike \ref PhysCallBack this callback is passed the world the contact occurred in, so any
+ * state the callback needs can be reached through \ref PhysWorld::userData rather than globals.
+ * This is required for worlds that are stepped concurrently, see \ref phys_batch_step.
+ */
+typedef void (*PhysWorldCallBack)(struct PhysWorld*, unsigned, unsigned);
+
 #ifdef __cplusplus
 }
 #endif
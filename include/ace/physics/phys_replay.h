@@ -0,0 +1,155 @@
+/**
+ * \file
+ * \brief Records the state of a physics world every step and plays it back.
+ * \details
+ * A recording stores the positions, velocities, orientations, angular velocities and sleeping flags
+ * of every entity once per step.
+ * Each frame is encoded against the previous one: the bits of every float are XORed with the bits
+ * of the same float in the previous frame and written as a variable length integer, so entities
+ * that did not move cost a single byte per component. Every
+ * \ref PhysRecorderConfig::keyframeInterval frames a keyframe is written which does not depend on
+ * earlier frames, allowing a player to seek.
+ *
+ * The recorder encodes each frame on the calling thread into a ring buffer which is written to the
+ * file in large blocks by a background thread, so the simulation only waits on the disk if the
+ * buffer fills. If the platform does not provide C11 threads frames are written directly.
+ *
+ * Collider data and callbacks are not recorded, a replay is played back into a world holding the
+ * same entities as the recorded one.
+ */
+#pragma once
+#include "phys_world.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \def AC_PHYS_REPLAY_VERSION
+ * \brief The version of the replay format written by \ref phys_recorder_open.
+ */
+#define AC_PHYS_REPLAY_VERSION 2
+
+/**
+ * \struct PhysRecorderConfig
+ * \brief Options for a recording.
+ */
+typedef struct PhysRecorderConfig
+{
+    unsigned keyframeInterval;  ///< The number of frames between keyframes, 0 uses a default.
+    unsigned quantizeBits;      ///< Low mantissa bits to round away (0 - 16), 0 is lossless.
+    size_t   bufferSize;        ///< The size of the ring buffer in bytes, 0 uses a default.
+} PhysRecorderConfig;
+
+/**
+ * \struct PhysRecorderStats
+ * \brief Statistics for a recording.
+ */
+typedef struct PhysRecorderStats
+{
+    unsigned long long frames;        ///< The number of frames recorded.
+    unsigned long long keyframes;     ///< The number of keyframes recorded.
+    unsigned long long rawBytes;      ///< The size the frames would take unencoded.
+    unsigned long long encodedBytes;  ///< The size of the encoded frames.
+    unsigned long long stalls;        ///< The number of times the ring buffer was full.
+} PhysRecorderStats;
+
+/**
+ * \struct PhysRecorder
+ * \brief An opaque recorder writing frames to a file.
+ */
+typedef struct PhysRecorder PhysRecorder;
+
+/**
+ * \struct PhysReplay
+ * \brief An opaque player for a recorded file.
+ */
+typedef struct PhysReplay PhysReplay;
+
+/**
+ * \brief Starts recording a world to a file.
+ * \param path The path of the file to write.
+ * \param world The world that will be recorded, only its entity count is read.
+ * \param config The recording options, or NULL for the defaults.
+ * \return The recorder, or NULL if the file could not be opened or the options are invalid.
+ */
+PhysRecorder*     phys_recorder_open(
+        const char* path, const PhysWorld* world, const PhysRecorderConfig* config
+    );
+/**
+ * \brief Records the current state of a world as the next frame.
+ * \param recorder The recorder.
+ * \param world The world to record, it must have the entity count it was opened with.
+ * \retval true the frame was recorded.
+ * \retval false the entity count changed or an earlier write failed.
+ * \details
+ * This is intended to be called after every \ref phys_step, or with the sub-step count reported
+ * in \ref PhysWorld::stats after \ref phys_update.
+ */
+bool              phys_recorder_record(PhysRecorder* recorder, const PhysWorld* world);
+/**
+ * \brief Returns the statistics of a recording so far.
+ * \param recorder The recorder.
+ * \return The statistics.
+ */
+PhysRecorderStats phys_recorder_stats(const PhysRecorder* recorder);
+/**
+ * \brief Flushes the remaining frames, closes the file and frees the recorder.
+ * \param recorder The recorder to close.
+ * \retval true every frame was written.
+ * \retval false a write failed.
+ */
+bool              phys_recorder_close(PhysRecorder* recorder);
+
+/**
+ * \brief Opens a recorded file for playback.
+ * \param path The path of the file to read.
+ * \return The player, or NULL if the file could not be read or is not a valid recording.
+ * \details
+ * The file is read and indexed once, recordings that were cut short are played back up to the
+ * last complete frame.
+ */
+PhysReplay*       phys_replay_open(const char* path);
+/**
+ * \brief Returns the number of frames in a recording.
+ * \param replay The player.
+ * \return The number of frames.
+ */
+unsigned          phys_replay_num_frames(const PhysReplay* replay);
+/**
+ * \brief Returns the number of entities in a recording.
+ * \param replay The player.
+ * \return The number of entities.
+ */
+unsigned          phys_replay_num_entities(const PhysReplay* replay);
+/**
+ * \brief Moves the player so that the next call to \ref phys_replay_next applies \p frame.
+ * \param replay The player.
+ * \param frame The frame to seek to.
+ * \retval true the player was moved.
+ * \retval false \p frame is past the end of the recording.
+ * \details
+ * The player decodes forward from the closest keyframe before \p frame.
+ */
+bool              phys_replay_seek(PhysReplay* replay, unsigned frame);
+/**
+ * \brief Applies the next frame of a recording to a world.
+ * \param replay The player.
+ * \param world The world to update, it must have the recorded entity count.
+ * \retval true the frame was applied.
+ * \retval false the recording has ended or the entity count does not match.
+ * \details
+ * The positions of the world before the call are kept as its previous positions, so the frames can
+ * be rendered with \ref phys_get_interpolated_position.
+ */
+bool              phys_replay_next(PhysReplay* replay, PhysWorld* world);
+/**
+ * \brief Frees a player.
+ * \param replay The player to free.
+ */
+void              phys_replay_close(PhysReplay* replay);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,120 @@
+/**
+ * \file
+ * \brief A compact binary file format for physics world scenes.
+ * \details
+ * A scene file stores the entities of a \ref PhysWorld as flat arrays so that loading is a single
+ * read, or a memory mapping, followed by one bulk copy per array. All values are little-endian
+ * 32-bit words, apart from the sleeping flags which are bytes. The file is laid out as follows:
+ *
+ * | Section            | Contents                                                   |
+ * |--------------------|------------------------------------------------------------|
+ * | Header             | \ref PhysSceneHeader                                       |
+ * | Positions          | numEnts x 3 float                                          |
+ * | Velocities         | numEnts x 3 float                                          |
+ * | Masses             | numEnts float                                              |
+ * | Sleeping           | numEnts byte, padded to a multiple of 4 bytes              |
+ * | Colliders          | numEnts x (uint32 type, uint32 shape index)                |
+ * | Static entities    | numStaticEntities uint32                                   |
+ * | Dynamic entities   | numDynamicEntities uint32                                  |
+ * | Spheres            | numSpheres float radius                                    |
+ * | AABBs              | numAABBs x 3 float half extents                            |
+ * | Generations        | numEnts uint32, version 2 onwards                          |
+ * | Alive              | numEnts byte, padded to a multiple of 4 bytes, version 2   |
+ * | Orientations       | numEnts x 4 float, version 3 onwards                       |
+ * | Angular velocities | numEnts x 3 float, version 3 onwards                       |
+ * | Inverse inertias   | numEnts x 3 float, version 3 onwards                       |
+ * | Friction           | 2 float friction and rolling friction, version 3 onwards   |
+ *
+ * Collider shapes are stored once and referenced by index, entities without a collider use the
+ * type \ref AC_PHYS_SCENE_NO_COLLIDER. The slot generations and alive flags keep entity IDs valid
+ * across a save and load, version 1 files are loaded with every slot alive at generation 0.
+ * Entities from files before version 3 are loaded unrotated and at rest, with the default inertia
+ * of their collider and no friction.
+ * Collision callbacks and user data cannot be stored and must be registered again after loading.
+ */
+#pragma once
+#include "phys_world.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \def AC_PHYS_SCENE_VERSION
+ * \brief The version of the scene format written by \ref phys_scene_save.
+ */
+#define AC_PHYS_SCENE_VERSION     3
+/**
+ * \def AC_PHYS_SCENE_NO_COLLIDER
+ * \brief The collider type stored for entities without a collider.
+ */
+#define AC_PHYS_SCENE_NO_COLLIDER 0xFFFFFFFFu
+
+/**
+ * \struct PhysSceneHeader
+ * \brief The header at the start of a scene file.
+ */
+typedef struct PhysSceneHeader
+{
+    char     magic[4];            ///< The characters "ACEW".
+    uint32_t version;             ///< The version of the format, see \ref AC_PHYS_SCENE_VERSION.
+    uint32_t headerSize;          ///< The size of the header in bytes.
+    uint32_t numEnts;             ///< The number of entities.
+    uint32_t numStaticEntities;   ///< The number of static entities.
+    uint32_t numDynamicEntities;  ///< The number of dynamic entities.
+    uint32_t numSpheres;          ///< The number of sphere shapes.
+    uint32_t numAABBs;            ///< The number of AABB shapes.
+    float    gravity[3];          ///< The gravity of the world.
+    float    airResistance;       ///< The air resistance of the world.
+    float    velocityThreshhold;  ///< The velocity threshold of the world.
+    float    timeStep;            ///< The time step of the world.
+} PhysSceneHeader;
+
+/**
+ * \struct PhysScene
+ * \brief Owns the collider shapes of a loaded scene.
+ * \details
+ * The colliders of a world loaded from a scene point into the scene, so it must outlive any use of
+ * the world's colliders.
+ */
+typedef struct PhysScene PhysScene;
+
+/**
+ * \brief Writes the entities of a world to a scene file.
+ * \param world The world to save.
+ * \param path The path of the file to write.
+ * \retval true the scene was written.
+ * \retval false the file could not be written, or an entity has a collider type the format cannot
+ * store.
+ */
+bool       phys_scene_save(const PhysWorld* world, const char* path);
+/**
+ * \brief Loads a scene file into a world.
+ * \param[out] world The world to load into, it is reinitialised before loading.
+ * \param path The path of the file to read.
+ * \return The scene owning the loaded collider shapes, or NULL if the file could not be read, is
+ * not a valid scene, or has more entities than \ref AC_MAX_PHYS_ENTS.
+ * \details
+ * The file is memory mapped where the platform supports it, otherwise it is read with a single
+ * call. The mapping is released before returning.
+ */
+PhysScene* phys_scene_load(PhysWorld* world, const char* path);
+/**
+ * \brief Loads a scene held in memory into a world.
+ * \param[out] world The world to load into, it is reinitialised before loading.
+ * \param data The contents of a scene file.
+ * \param size The size of \p data in bytes.
+ * \return The scene owning the loaded collider shapes, or NULL if \p data is not a valid scene.
+ * \see phys_scene_load
+ */
+PhysScene* phys_scene_load_memory(PhysWorld* world, const void* data, size_t size);
+/**
+ * \brief Frees a scene and its collider shapes.
+ * \param scene The scene to free.
+ */
+void       phys_scene_free(PhysScene* scene);
+
+#ifdef __cplusplus
+}
+#endif
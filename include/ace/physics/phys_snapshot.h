@@ -0,0 +1,53 @@
+/**
+ * \file
+ * \brief Saves and restores the simulated state of a physics world.
+ * \details
+ * A snapshot holds only the state that changes while the world is stepped: the positions,
+ * previous positions, velocities, orientations, angular velocities, pending forces and torques,
+ * and sleeping flags of each entity, plus the accumulator, the warm starts of convex pairs, and the
+ * contact manifolds.
+ * Colliders, callbacks, and configuration are not copied, so a snapshot is self-contained and can
+ * be kept in any caller-owned buffer. Restoring a snapshot is a handful of memcpy calls, which
+ * makes it suitable for rollback and for previewing shots many times per frame.
+ *
+ * Snapshots use the native layout of the machine and are not intended to be stored or sent to
+ * other machines.
+ */
+#pragma once
+#include "phys_world.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Returns the size of a snapshot of the world.
+ * \param world The world.
+ * \return The number of bytes required by \ref phys_world_snapshot.
+ */
+size_t phys_world_snapshot_size(const PhysWorld* world);
+/**
+ * \brief Copies the simulated state of the world into a buffer.
+ * \param world The world to save.
+ * \param[out] buffer The buffer to write the snapshot to, aligned to at least 4 bytes.
+ * \param bufferSize The size of \p buffer in bytes.
+ * \return The number of bytes written, or 0 if \p buffer is too small.
+ * \see phys_world_snapshot_size
+ */
+size_t phys_world_snapshot(const PhysWorld* world, void* buffer, size_t bufferSize);
+/**
+ * \brief Restores the simulated state of the world from a snapshot.
+ * \param[in,out] world The world to restore.
+ * \param buffer The snapshot written by \ref phys_world_snapshot.
+ * \param bufferSize The size of \p buffer in bytes.
+ * \retval true the snapshot was restored.
+ * \retval false the buffer is not a valid snapshot, or was taken of a world with different
+ * entities. Adding or removing an entity after taking a snapshot invalidates it. The world is
+ * unchanged.
+ */
+bool   phys_world_restore(PhysWorld* world, const void* buffer, size_t bufferSize);
+
+#ifdef __cplusplus
+}
+#endif
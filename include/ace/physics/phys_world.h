@@ -5,41 +5,216 @@
  */
 #pragma once
 #include "phys_components.h"
+#include <ace/geometry/convex.h>
+#include <ace/geometry/manifold.h>
+#include <ace/math/quat.h>
 #include <ace/math/vec3.h>
 #include <stdbool.h>
+#include <stdint.h>
 
-#define AC_MAX_PHYS_ENTS  100  // should be vectors instead
-#define AC_PHYS_ERROR_ENT 2147483646
+#ifndef AC_MAX_PHYS_ENTS
+    #define AC_MAX_PHYS_ENTS 100  // should be vectors instead
+#endif
+#define AC_PHYS_ERROR_ENT           2147483646
+#define AC_PHYS_CONVEX_CACHE_SIZE   64
+#define AC_PHYS_MANIFOLD_CACHE_SIZE 64
+
+#define AC_PHYS_ENT_INDEX_BITS      20
+#define AC_PHYS_ENT_INDEX_MASK      ((1u << AC_PHYS_ENT_INDEX_BITS) - 1)
+#define AC_PHYS_ENT_GENERATION_MASK (0xFFFFFFFFu >> AC_PHYS_ENT_INDEX_BITS)
+#define AC_PHYS_NO_INDEX            0xFFFFFFFFu
+
+/**
+ * \def AC_MAX_PHYS_ENTS
+ * \brief The capacity of each \ref PhysWorld.
+ * \details
+ * Set with the AC_MAX_PHYS_ENTS CMake cache variable, which defines it for the library and its
+ * consumers so the layout of \ref PhysWorld agrees between them.
+ */
+
+/**
+ * \def AC_PHYS_CONVEX_CACHE_SIZE
+ * \brief The number of entries in \ref PhysWorld::convexPairs.
+ * \details
+ * The table is direct mapped, so pairs whose entries collide still work but lose their warm start.
+ */
+
+/**
+ * \def AC_PHYS_MANIFOLD_CACHE_SIZE
+ * \brief The number of entries in \ref PhysWorld::manifolds.
+ * \details
+ * Direct mapped as \ref AC_PHYS_CONVEX_CACHE_SIZE, a pair that loses its entry is solved without
+ * the impulses of the last step.
+ */
+
+/**
+ * \def AC_PHYS_ENT_INDEX_BITS
+ * \brief The number of low bits of an entity handle holding its slot index.
+ * \details
+ * The IDs returned by \ref phys_add_entity are handles: the low bits are the index of the entity's
+ * slot in the per-entity arrays of \ref PhysWorld and the high bits are the generation of the slot.
+ * Removing an entity increments the generation of its slot, so handles to removed entities are
+ * rejected even once the slot is reused. A slot's first entity has generation 0, so its handle is
+ * equal to its index. Otherwise use \ref phys_entity_index before indexing the arrays directly.
+ */
+
+/**
+ * \def AC_PHYS_NO_INDEX
+ * \brief Marks an entity that is not in \ref PhysWorld::staticEntities or
+ * \ref PhysWorld::dynamicEntities.
+ */
+
+/**
+ * \def AC_DETERMINISTIC
+ * \brief Defined when the library is configured with the AC_DETERMINISTIC CMake option.
+ * \details
+ * The library and its consumers are compiled with strict floating point semantics, with no fused
+ * multiply-add contraction or excess precision. Each step visits entities, and therefore contact
+ * pairs, in ascending ID order regardless of the order they were made static or dynamic. Together
+ * this makes the results of \ref phys_update bit-identical across conforming platforms given the
+ * same inputs, which can be checked with \ref phys_world_hash.
+ */
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * \struct PhysUpdateStats
+ * \brief Statistics describing the work done by \ref phys_update.
+ */
+typedef struct PhysUpdateStats
+{
+    unsigned subSteps;          ///<  The number of steps taken by the last update.
+    unsigned solverIterations;  ///<  The solver iterations used per step by the last update.
+    float    droppedTime;       ///<  The time discarded by the last update.
+    float    totalDroppedTime;  ///<  The time discarded since the world was initialised.
+    unsigned droppedUpdates;    ///<  The number of updates that discarded time.
+} PhysUpdateStats;
+
+/**
+ * \struct PhysConvexPair
+ * \brief The warm-start data of a pair of colliders handled by \ref convex_intersect.
+ */
+typedef struct PhysConvexPair
+{
+    unsigned    entity1;  ///<  The handle of the first entity, or \ref AC_PHYS_ERROR_ENT if unused.
+    unsigned    entity2;  ///<  The handle of the second entity.
+    ConvexCache cache;    ///<  The simplex of the pair's last query.
+} PhysConvexPair;
+
+/**
+ * \struct PhysManifoldPair
+ * \brief The persistent contact manifold of a pair of colliders resolved with
+ * \ref resolve_manifold.
+ */
+typedef struct PhysManifoldPair
+{
+    unsigned        entity1;   ///<  The handle of the first entity, or \ref AC_PHYS_ERROR_ENT.
+    unsigned        entity2;   ///<  The handle of the second entity.
+    ContactManifold manifold;  ///<  The pair's manifold with its accumulated impulses.
+} PhysManifoldPair;
+
+/**
+ * \enum PhysEntityFlags
+ * \brief Flags describing how an entity is added by \ref phys_add_entities.
+ */
+enum PhysEntityFlags
+{
+    AC_PHYS_ENT_DYNAMIC  = 1u << 0, /**< \brief Make the entity dynamic. */
+    AC_PHYS_ENT_STATIC   = 1u << 1, /**< \brief Make the entity static. */
+    AC_PHYS_ENT_SLEEPING = 1u << 2, /**< \brief Add the entity asleep. */
+};
+
+/**
+ * \struct PhysEntityDesc
+ * \brief Describes an entity to add with \ref phys_add_entities.
+ */
+typedef struct PhysEntityDesc
+{
+    ac_vec3           position;       ///<  The position of the entity.
+    ac_vec3           velocity;       ///<  The initial velocity of the entity.
+    float             mass;           ///<  The mass of the entity, 0 for the default.
+    Collider          collider;       ///<  The collider of the entity, NULL data for none.
+    unsigned          flags;          ///<  A combination of \ref PhysEntityFlags.
+    PhysCallBack      callback;       ///<  The contact callback, may be NULL.
+    PhysWorldCallBack worldCallback;  ///<  The contact callback with world, may be NULL.
+} PhysEntityDesc;
+
+/**
+ * \struct PhysEntityStreams
+ * \brief Describes entities to add with \ref phys_add_entities_soa as one array per property.
+ * \details
+ * Only the positions are required, any other array may be NULL to use the defaults of
+ * \ref PhysEntityDesc for every entity.
+ */
+typedef struct PhysEntityStreams
+{
+    const ac_vec3*           positions;       ///<  The positions of the entities.
+    const ac_vec3*           velocities;      ///<  The initial velocities of the entities.
+    const float*             masses;          ///<  The masses of the entities, 0 for the default.
+    const Collider*          colliders;       ///<  The colliders of the entities.
+    const unsigned*          flags;           ///<  The \ref PhysEntityFlags of the entities.
+    const PhysCallBack*      callbacks;       ///<  The contact callbacks.
+    const PhysWorldCallBack* worldCallbacks;  ///<  The contact callbacks with world.
+} PhysEntityStreams;
+
 /**
  * \struct PhysWorld
  * \brief Structure to hold the physics world.
  */
 typedef struct PhysWorld
 {
-    ac_vec3      positions[AC_MAX_PHYS_ENTS];   ///<  The positions of the entities.
-    ac_vec3      velocities[AC_MAX_PHYS_ENTS];  ///<  The velocities of the entities.
-    float        masses[AC_MAX_PHYS_ENTS];      ///<  The masses of the entities.
-    Collider     colliders[AC_MAX_PHYS_ENTS];   ///<  The colliders of the entities.
-    unsigned     numColliders;                  ///<  The number of colliders.
-    bool         sleeping[AC_MAX_PHYS_ENTS];    ///<  Bool used to sleep entities. (Stop updates)
-    PhysCallBack callbacks[AC_MAX_PHYS_ENTS];   ///<  The on contact callbacks of the entities.
-
-    unsigned staticEntities[AC_MAX_PHYS_ENTS];   ///<  The static entities ids.
-    unsigned dynamicEntities[AC_MAX_PHYS_ENTS];  ///<  The dynamic entities ids.
-    unsigned numEnts;                            ///<  The number of entities.
+    ac_vec3           positions[AC_MAX_PHYS_ENTS];          ///<  The positions of the entities.
+    ac_vec3           previousPositions[AC_MAX_PHYS_ENTS];  ///<  Positions before the last step.
+    ac_vec3           velocities[AC_MAX_PHYS_ENTS];         ///<  The velocities of the entities.
+    ac_quat           orientations[AC_MAX_PHYS_ENTS];       ///<  The orientations of the entities.
+    ac_vec3           angularVelocities[AC_MAX_PHYS_ENTS];  ///<  World space spin, radians/s.
+    ac_vec3           inverseInertias[AC_MAX_PHYS_ENTS];    ///<  Body space, per unit of mass.
+    ac_vec3           forces[AC_MAX_PHYS_ENTS];             ///<  Force accumulated for next step.
+    ac_vec3           torques[AC_MAX_PHYS_ENTS];            ///<  Torque accumulated for next step.
+    float             masses[AC_MAX_PHYS_ENTS];             ///<  The masses of the entities.
+    Collider          colliders[AC_MAX_PHYS_ENTS];          ///<  The colliders of the entities.
+    unsigned          numColliders;                         ///<  The number of colliders.
+    bool              sleeping[AC_MAX_PHYS_ENTS];           ///<  Sleeps entities. (Stop updates)
+    PhysCallBack      callbacks[AC_MAX_PHYS_ENTS];          ///<  On contact callbacks.
+    PhysWorldCallBack worldCallbacks[AC_MAX_PHYS_ENTS];     ///<  On contact callbacks with world.
+    uint32_t          generations[AC_MAX_PHYS_ENTS];        ///<  The generation of each slot.
+    bool              alive[AC_MAX_PHYS_ENTS];              ///<  Whether each slot is in use.
+
+    unsigned staticEntities[AC_MAX_PHYS_ENTS];   ///<  The static entities indices.
+    unsigned dynamicEntities[AC_MAX_PHYS_ENTS];  ///<  The dynamic entities indices.
+    unsigned staticIndices[AC_MAX_PHYS_ENTS];    ///<  Each slot's place in staticEntities.
+    unsigned dynamicIndices[AC_MAX_PHYS_ENTS];   ///<  Each slot's place in dynamicEntities.
+    unsigned freeEntities[AC_MAX_PHYS_ENTS];     ///<  The slots of removed entities.
+    unsigned numEnts;                            ///<  The number of slots ever used.
     unsigned numStaticEntities;                  ///<  The number of static entities.
     unsigned numDynamicEntities;                 ///<  The number of dynamic entities.
+    unsigned numFreeEntities;                    ///<  The number of reusable slots.
+
+    PhysBakedStatic bakedStatics[AC_MAX_PHYS_ENTS];  ///<  Static colliders sorted by minimum x.
+    unsigned        numBakedStatics;                 ///<  The number of baked static colliders.
+    float           bakedMaxWidth;                   ///<  The widest baked collider along x.
+    bool            staticBaked;                     ///<  Whether the baked statics are in use.
+
+    PhysConvexPair   convexPairs[AC_PHYS_CONVEX_CACHE_SIZE];  ///<  Warm starts for convex pairs.
+    PhysManifoldPair manifolds[AC_PHYS_MANIFOLD_CACHE_SIZE];  ///<  Manifolds of box contacts.
 
     ac_vec3 gravity;             ///<  The gravity of the world.
     float   airResistance;       ///<  The air resistance of the world.
+    float   friction;            ///<  The sliding friction coefficient of contacts.
+    float   rollingFriction;     ///<  The rolling friction coefficient of contacts.
     float   velocityThreshhold;  ///<  The velocity threshold of the world
     float   accumulator;         ///<  The accumulator for the world.
     float   timeStep;            ///<  The time step for the world.
+    void*   userData;            ///<  User data made available to \ref PhysWorldCallBack.
+
+    unsigned maxSubSteps;          ///<  The max steps per update, 0 for no limit.
+    unsigned solverIterations;     ///<  The collision solver passes per step.
+    unsigned minSolverIterations;  ///<  The fewest solver passes per step in adaptive mode.
+    bool     adaptiveSolver;       ///<  Lowers the solver passes when the world falls behind.
+
+    PhysUpdateStats stats;  ///<  Statistics for the last update.
 } PhysWorld;
 
 /**
@@ -51,16 +226,118 @@ void     phys_init_world(PhysWorld* world);
  * \brief Adds an entity to the world.
  * \param world The world to add the entity to.
  * \param position The position of the entity.
- * \return The ID of the added entity.
+ * \return The ID of the added entity, or \ref AC_PHYS_ERROR_ENT if the world is full.
+ * \details
+ * The slot of the most recently removed entity is reused if there is one, otherwise a new slot is
+ * taken. Either way this is O(1).
+ * \see AC_PHYS_ENT_INDEX_BITS
  */
 unsigned phys_add_entity(PhysWorld* world, const ac_vec3* position);
+/**
+ * \brief Adds many entities to the world at once.
+ * \param world The world to add the entities to.
+ * \param descs The descriptions of the entities.
+ * \param count The number of entities to add.
+ * \param[out] ids The IDs of the added entities, may be NULL.
+ * \return The number of entities added, either \p count or 0 if the world does not have room for
+ * all of them.
+ * \details
+ * This is equivalent to calling \ref phys_add_entity followed by the per-entity setup functions for
+ * each description, but every property is written in a single pass.
+ */
+unsigned phys_add_entities(
+    PhysWorld* world, const PhysEntityDesc* descs, unsigned count, unsigned* ids
+);
+/**
+ * \brief Adds many entities to the world at once, reading each property from its own array.
+ * \param world The world to add the entities to.
+ * \param streams The properties of the entities.
+ * \param count The number of entities to add.
+ * \param[out] ids The IDs of the added entities, may be NULL.
+ * \return The number of entities added, either \p count or 0 if the world does not have room for
+ * all of them.
+ * \see phys_add_entities
+ */
+unsigned phys_add_entities_soa(
+    PhysWorld* world, const PhysEntityStreams* streams, unsigned count, unsigned* ids
+);
+/**
+ * \brief Removes an entity from the world.
+ * \param world The world where the entity resides.
+ * \param entity The ID of the entity.
+ * \retval true the entity was removed.
+ * \retval false the ID does not refer to an entity in the world.
+ * \details
+ * The entity is swapped out of the static and dynamic lists so they stay densely packed, and its
+ * slot is cleared and queued for reuse. This is O(1). Any collider data is owned by the caller and
+ * is not freed. Removing entities from within a collision callback reorders the lists while they
+ * are being iterated, so removals should be deferred until \ref phys_update returns.
+ */
+bool     phys_remove_entity(PhysWorld* world, unsigned entity);
+/**
+ * \brief Checks whether an ID refers to an entity in the world.
+ * \param world The world.
+ * \param entity The ID of the entity.
+ * \return true if the entity has been added and not removed since.
+ * \details
+ * The functions that take an entity ID do nothing when it is not valid, so an ID kept after its
+ * entity was removed never changes the entity that reuses the slot.
+ */
+bool     phys_is_entity_valid(const PhysWorld* world, unsigned entity);
+/**
+ * \brief Returns the slot index of an entity, for use with the per-entity arrays of the world.
+ * \param entity The ID of the entity.
+ * \return The index of the entity's slot.
+ */
+unsigned phys_entity_index(unsigned entity);
+/**
+ * \brief Returns the ID of the entity in a slot.
+ * \param world The world.
+ * \param index The index of the slot, such as an entry of \ref PhysWorld::dynamicEntities.
+ * \return The ID of the entity currently occupying the slot.
+ */
+unsigned phys_entity_handle(const PhysWorld* world, unsigned index);
+/**
+ * \brief Moves an entity without it being interpolated from its previous position.
+ * \param world The world where the entity resides.
+ * \param entity The ID of the entity.
+ * \param position The new position of the entity.
+ * \details
+ * Writing to \ref PhysWorld::positions directly is still valid, but the entity will be rendered
+ * between its old and new position until the next step when using interpolated positions.
+ */
+void     phys_set_entity_position(PhysWorld* world, unsigned entity, const ac_vec3* position);
 /**
  * \brief Adds a collider to an entity in the world.
  * \param world The world where the entity resides.
  * \param collider The collider to add to the entity.
  * \param entity The ID of the entity.
+ * \details
+ * The entity's inverse inertia is set to \ref phys_collider_inverse_inertia of the collider.
  */
 void     phys_add_entity_collider(PhysWorld* world, Collider collider, unsigned entity);
+/**
+ * \brief Returns the default inverse inertia of a collider.
+ * \param collider The collider.
+ * \return The diagonal of the inverse inertia tensor in body space for a mass of 1.
+ * \details
+ * Spheres are treated as solid. Every other collider type is tested for contacts without its
+ * orientation, so it returns zero, which stops the entity from rotating. Use
+ * \ref phys_set_entity_inverse_inertia to let such an entity spin regardless.
+ */
+ac_vec3  phys_collider_inverse_inertia(const Collider* collider);
+/**
+ * \brief Sets the inverse inertia of an entity.
+ * \param world The world where the entity resides.
+ * \param entity The ID of the entity.
+ * \param inverseInertia The diagonal of the inverse inertia tensor in body space for a mass of 1,
+ * zero on an axis prevents rotation about it.
+ * \details
+ * The inertia is stored per unit of mass so it follows changes to \ref PhysWorld::masses.
+ */
+void     phys_set_entity_inverse_inertia(
+    PhysWorld* world, unsigned entity, const ac_vec3* inverseInertia
+);
 /**
  * \brief Makes an entity dynamic.
  * \param world The world where the entity resides.
@@ -78,8 +355,22 @@ void     phys_make_entity_static(PhysWorld* world, unsigned entity);
  * \param world Pointer to the PhysWorld structure representing the physics world.
  * \param entity The ID of the entity to associate the collision callback with.
  * \param callback The callback function to be invoked when the entity collides with another entity.
+ * \details
+ * The callback is passed the IDs of both entities in the contact.
  */
 void     phys_add_collision_callback(PhysWorld* world, unsigned entity, PhysCallBack callback);
+/**
+ * \brief Adds a collision callback that receives the world for an entity.
+ * \param world Pointer to the PhysWorld structure representing the physics world.
+ * \param entity The ID of the entity to associate the collision callback with.
+ * \param callback The callback function to be invoked when the entity collides with another entity.
+ * \details
+ * The callback is invoked after any \ref PhysCallBack registered for the same entity. State should
+ * be reached through \ref PhysWorld::userData so that copies of the world remain independent.
+ */
+void phys_add_world_collision_callback(
+    PhysWorld* world, unsigned entity, PhysWorldCallBack callback
+);
 /**
  * \brief Sets an entity's sleeping state. Will reset velocity.
  * \param world Pointer to the PhysWorld structure representing the physics world.
@@ -87,12 +378,155 @@ void     phys_add_collision_callback(PhysWorld* world, unsigned entity, PhysCall
  * \param sleep What you want to set the entity's sleep state to.
  */
 void     phys_sleep_entity(PhysWorld* world, unsigned entity, bool sleep);
+/**
+ * \brief Applies a force through the centre of an entity for the next step.
+ * \param world The world where the entity resides.
+ * \param entity The ID of the entity.
+ * \param force The force in newtons.
+ * \details
+ * The force is added to \ref PhysWorld::forces, which is integrated with gravity by the next step
+ * and then cleared, so a continuous force must be applied before every step. The entity is woken.
+ * Entities that are not dynamic are unaffected.
+ */
+void     phys_apply_force(PhysWorld* world, unsigned entity, const ac_vec3* force);
+/**
+ * \brief Applies a force at a point on an entity for the next step.
+ * \param world The world where the entity resides.
+ * \param entity The ID of the entity.
+ * \param force The force in newtons.
+ * \param point The world space point the force acts at.
+ * \details
+ * As \ref phys_apply_force, with the torque about the entity's position also added to
+ * \ref PhysWorld::torques.
+ */
+void     phys_apply_force_at_point(
+    PhysWorld* world, unsigned entity, const ac_vec3* force, const ac_vec3* point
+);
+/**
+ * \brief Applies an impulse through the centre of an entity.
+ * \param world The world where the entity resides.
+ * \param entity The ID of the entity.
+ * \param impulse The impulse in newton seconds.
+ * \details
+ * The velocity changes immediately by \p impulse divided by the mass, and the entity is woken.
+ * Entities that are not dynamic are unaffected.
+ */
+void     phys_apply_impulse(PhysWorld* world, unsigned entity, const ac_vec3* impulse);
+/**
+ * \brief Applies an impulse at a point on an entity.
+ * \param world The world where the entity resides.
+ * \param entity The ID of the entity.
+ * \param impulse The impulse in newton seconds.
+ * \param point The world space point the impulse acts at.
+ * \details
+ * As \ref phys_apply_impulse, the angular velocity also changes by the angular impulse about the
+ * entity's position.
+ */
+void     phys_apply_impulse_at_point(
+    PhysWorld* world, unsigned entity, const ac_vec3* impulse, const ac_vec3* point
+);
+/**
+ * \brief Applies a force through the centre of many entities for the next step.
+ * \param world The world where the entities reside.
+ * \param entities The IDs of the entities.
+ * \param forces The force to apply to each entity.
+ * \param count The number of entities.
+ * \see phys_apply_force
+ */
+void     phys_apply_forces(
+    PhysWorld* world, const unsigned* entities, const ac_vec3* forces, unsigned count
+);
+/**
+ * \brief Applies an impulse through the centre of many entities.
+ * \param world The world where the entities reside.
+ * \param entities The IDs of the entities.
+ * \param impulses The impulse to apply to each entity.
+ * \param count The number of entities.
+ * \see phys_apply_impulse
+ */
+void     phys_apply_impulses(
+    PhysWorld* world, const unsigned* entities, const ac_vec3* impulses, unsigned count
+);
+/**
+ * \brief Freezes the static colliders of the world into a packed array for faster contacts.
+ * \param world The world to bake.
+ * \retval true the static colliders were baked.
+ * \retval false a static entity has a collider type that cannot be baked, such as an unbounded
+ * \ref PLANE_C, the world is unbaked.
+ * \details
+ * The position and shape of every static collider are copied into
+ * \ref PhysWorld::bakedStatics, sorted along the x axis. Each step then only visits the statics
+ * whose x range overlaps a dynamic sphere, using kernels that read the copied shapes directly
+ * rather than dispatching on the collider types. Contacts for other dynamic colliders still use
+ * \ref check_collision.
+ *
+ * Adding, removing, or moving a static entity through the world functions, or giving one a new
+ * collider, discards the bake. The world then falls back to testing every static entity until it is
+ * baked again. Writing to the positions or collider data of static entities directly is not
+ * detected, so bake again after doing so.
+ */
+bool     phys_bake_static(PhysWorld* world);
 /**
  * \brief Updates the physics world.
  * \param world The world to update.
  * \param deltaTime The time elapsed since the last update.
+ * \details
+ * The elapsed time is consumed in fixed \ref PhysWorld::timeStep increments. At most
+ * \ref PhysWorld::maxSubSteps steps are taken, any whole steps beyond that are discarded from the
+ * accumulator so a slow frame cannot cause every following frame to be slower still. When
+ * \ref PhysWorld::adaptiveSolver is set the solver passes per step are reduced, down to
+ * \ref PhysWorld::minSolverIterations, in proportion to the number of steps that are due. The
+ * outcome is recorded in \ref PhysWorld::stats.
  */
 void     phys_update(PhysWorld* world, float deltaTime);
+/**
+ * \brief Advances the physics world by exactly one time step.
+ * \param world The world to step.
+ * \details
+ * The accumulator is left untouched, which makes this suitable for offline simulation where the
+ * number of steps is known up front. \ref PhysWorld::solverIterations solver passes are used.
+ */
+void     phys_step(PhysWorld* world);
+/**
+ * \brief Returns how far the world is between its previous and current step.
+ * \param world The world.
+ * \return The interpolation factor in the range [0, 1].
+ * \details
+ * This is the time left in the accumulator by \ref phys_update as a fraction of the time step. It
+ * is used to blend between the previous and current positions when rendering at a higher rate than
+ * the world is stepped at.
+ */
+float    phys_get_interpolation_alpha(const PhysWorld* world);
+/**
+ * \brief Returns the position of an entity interpolated between the last two steps.
+ * \param world The world where the entity resides.
+ * \param entity The ID of the entity.
+ * \return The interpolated position of the entity, with NaN components if the ID is not valid.
+ * \see phys_get_interpolation_alpha
+ */
+ac_vec3  phys_get_interpolated_position(const PhysWorld* world, unsigned entity);
+/**
+ * \brief Writes the interpolated position of every entity in the world.
+ * \param world The world.
+ * \param[out] positions The interpolated positions, must hold at least \ref PhysWorld::numEnts
+ * entries.
+ * \see phys_get_interpolation_alpha
+ */
+void     phys_get_interpolated_positions(const PhysWorld* world, ac_vec3* positions);
+
+/**
+ * \brief Computes a hash of the simulated state of the world.
+ * \param world The world to hash.
+ * \return A 64-bit hash of the positions, velocities, orientations, angular velocities, and
+ * sleeping state of every entity.
+ * \details
+ * The hash is computed from the bit patterns of the state rather than its bytes, so it is
+ * independent of the byte order of the machine. Comparing hashes each frame is a cheap way to
+ * detect divergence between lockstep peers or against a replay. Configuration and timing state,
+ * such as the accumulator, is not included.
+ * \see AC_DETERMINISTIC
+ */
+uint64_t phys_world_hash(const PhysWorld* world);
 
 #ifdef __cplusplus
 }
@@ -3,6 +3,7 @@
  * \brief A camera class for rendering.
  */
 #pragma once
+#include "../math/mat4.h"
 #include "../math/vec3.h"
 
 #ifdef __cplusplus
@@ -100,6 +101,13 @@ ac_vec3    ac_camera_get_right(const ac_camera* cam);
  * \return The up vector.
  */
 ac_vec3    ac_camera_get_up(const ac_camera* cam);
+/**
+ * \ingroup camera
+ * \brief Get the view matrix of the camera.
+ * \param[in] cam The camera.
+ * \return The view matrix, built from the current position and orientation.
+ */
+ac_mat4    ac_camera_get_view_matrix(const ac_camera* cam);
 /**
  * \ingroup camera
  * \brief Get the yaw of the camera.
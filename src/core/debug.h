@@ -0,0 +1,29 @@
+/**
+ * \file
+ * \brief Checks of internal preconditions in debug builds.
+ */
+#pragma once
+
+#ifdef AC_DEBUG
+    #include <stdio.h>
+    #include <stdlib.h>
+
+    /**
+     * \def AC_DEBUG_CHECK
+     * \brief Reports the failed condition and its location, then aborts, if \p condition is false.
+     * \details
+     * Unlike assert this does not depend on NDEBUG, so the check is made in every build that
+     * defines AC_DEBUG, including RelWithDebInfo.
+     */
+    #define AC_DEBUG_CHECK(condition)                                                              \
+        do                                                                                         \
+        {                                                                                          \
+            if ( !(condition) )                                                                    \
+            {                                                                                      \
+                fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);      \
+                abort();                                                                           \
+            }                                                                                      \
+        } while ( 0 )
+#else
+    #define AC_DEBUG_CHECK(condition) ((void) 0)
+#endif
@@ -0,0 +1,618 @@
+/**
+ * \file
+ * \brief Implements GJK and EPA collision detection between convex shapes.
+ */
+#include <ace/geometry/convex.h>
+#include <ace/math/math.h>
+#include <math.h>
+#include <stddef.h>
+
+#define AC_CONVEX_TOLERANCE    1e-5f
+#define AC_CONVEX_MAX_VERTICES (AC_CONVEX_MAX_ITERATIONS + 4)
+#define AC_CONVEX_MAX_FACES    (2 * AC_CONVEX_MAX_VERTICES)
+#define AC_CONVEX_MAX_EDGES    (3 * AC_CONVEX_MAX_FACES)
+
+/**
+ * \brief A point of the Minkowski difference with the points of each shape that produced it.
+ */
+typedef struct
+{
+    ac_vec3 w;          ///< The point of the difference, a - b.
+    ac_vec3 a;          ///< The support point of the first shape.
+    ac_vec3 direction;  ///< The direction the point was found along.
+} ConvexVertex;
+
+typedef struct
+{
+    ConvexVertex vertices[4];
+    float        weights[4];  ///< The barycentric weights of the closest point to the origin.
+    unsigned     count;
+} ConvexSimplex;
+
+typedef struct
+{
+    const Collider* c1;
+    const ac_vec3*  p1;
+    const Collider* c2;
+    const ac_vec3*  p2;
+} ConvexPair;
+
+typedef struct
+{
+    unsigned v[3];
+    ac_vec3  normal;
+    float    distance;
+} EpaFace;
+
+static ConvexVertex pair_support(const ConvexPair* pair, const ac_vec3* direction)
+{
+    ac_vec3      opposite = ac_vec3_negate(direction);
+    ac_vec3      b        = collider_support(pair->c2, pair->p2, &opposite);
+    ConvexVertex vertex;
+    vertex.a         = collider_support(pair->c1, pair->p1, direction);
+    vertex.w         = ac_vec3_sub(&vertex.a, &b);
+    vertex.direction = *direction;
+    return vertex;
+}
+
+static ac_vec3 simplex_point(const ConvexSimplex* simplex, bool witness)
+{
+    ac_vec3 point = ac_vec3_zero();
+    for ( unsigned i = 0; i < simplex->count; i++ )
+    {
+        const ac_vec3* v      = witness ? &simplex->vertices[i].a : &simplex->vertices[i].w;
+        ac_vec3        scaled = ac_vec3_scale(v, simplex->weights[i]);
+        point                 = ac_vec3_add(&point, &scaled);
+    }
+    return point;
+}
+
+static void simplex_keep(
+    ConvexSimplex* simplex, const unsigned* keep, const float* weights, unsigned n
+)
+{
+    ConvexSimplex reduced;
+    reduced.count = n;
+    for ( unsigned i = 0; i < n; i++ )
+    {
+        reduced.vertices[i] = simplex->vertices[keep[i]];
+        reduced.weights[i]  = weights[i];
+    }
+    *simplex = reduced;
+}
+
+static void solve_segment(ConvexSimplex* simplex, unsigned i, unsigned j)
+{
+    const ac_vec3* a      = &simplex->vertices[i].w;
+    ac_vec3        ab     = ac_vec3_sub(&simplex->vertices[j].w, a);
+    float          length = ac_vec3_dot(&ab, &ab);
+    float          t      = length > 0.0f ? -ac_vec3_dot(a, &ab) / length : 0.0f;
+    t                     = ac_clamp(t, 0.0f, 1.0f);
+
+    unsigned keep[2]    = { i, j };
+    float    weights[2] = { 1.0f - t, t };
+    if ( t <= 0.0f )
+    {
+        simplex_keep(simplex, keep, weights, 1);
+    }
+    else if ( t >= 1.0f )
+    {
+        weights[0] = 1.0f;
+        simplex_keep(simplex, &keep[1], weights, 1);
+    }
+    else
+    {
+        simplex_keep(simplex, keep, weights, 2);
+    }
+}
+
+static void solve_triangle(ConvexSimplex* simplex, unsigned i, unsigned j, unsigned k)
+{
+    // Real-Time Collision Detection, Ericson, 5.1.5, with the origin as the query point
+    const ac_vec3* a  = &simplex->vertices[i].w;
+    const ac_vec3* b  = &simplex->vertices[j].w;
+    const ac_vec3* c  = &simplex->vertices[k].w;
+    ac_vec3        ab = ac_vec3_sub(b, a);
+    ac_vec3        ac = ac_vec3_sub(c, a);
+    float          d1 = -ac_vec3_dot(&ab, a);
+    float          d2 = -ac_vec3_dot(&ac, a);
+    float          d3 = -ac_vec3_dot(&ab, b);
+    float          d4 = -ac_vec3_dot(&ac, b);
+    float          d5 = -ac_vec3_dot(&ab, c);
+    float          d6 = -ac_vec3_dot(&ac, c);
+    float          va = d3 * d6 - d5 * d4;
+    float          vb = d5 * d2 - d1 * d6;
+    float          vc = d1 * d4 - d3 * d2;
+
+    unsigned keep[3];
+    float    weights[3];
+    if ( d1 <= 0.0f && d2 <= 0.0f )
+    {
+        keep[0] = i, weights[0] = 1.0f;
+        simplex_keep(simplex, keep, weights, 1);
+    }
+    else if ( d3 >= 0.0f && d4 <= d3 )
+    {
+        keep[0] = j, weights[0] = 1.0f;
+        simplex_keep(simplex, keep, weights, 1);
+    }
+    else if ( vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f )
+    {
+        solve_segment(simplex, i, j);
+    }
+    else if ( d6 >= 0.0f && d5 <= d6 )
+    {
+        keep[0] = k, weights[0] = 1.0f;
+        simplex_keep(simplex, keep, weights, 1);
+    }
+    else if ( vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f )
+    {
+        solve_segment(simplex, i, k);
+    }
+    else if ( va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f )
+    {
+        solve_segment(simplex, j, k);
+    }
+    else if ( va + vb + vc <= 0.0f )
+    {
+        // a degenerate triangle, fall back to one of its edges
+        solve_segment(simplex, i, j);
+    }
+    else
+    {
+        float denom = 1.0f / (va + vb + vc);
+        keep[0] = i, keep[1] = j, keep[2] = k;
+        weights[1] = vb * denom;
+        weights[2] = vc * denom;
+        weights[0] = 1.0f - weights[1] - weights[2];
+        simplex_keep(simplex, keep, weights, 3);
+    }
+}
+
+/**
+ * \brief Reduces the simplex to the smallest subset containing its closest point to the origin.
+ * \return true if the simplex is a tetrahedron containing the origin.
+ */
+static bool solve_simplex(ConvexSimplex* simplex)
+{
+    switch ( simplex->count )
+    {
+    case 1:
+        simplex->weights[0] = 1.0f;
+        return false;
+    case 2:
+        solve_segment(simplex, 0, 1);
+        return false;
+    case 3:
+        solve_triangle(simplex, 0, 1, 2);
+        return false;
+    default:
+        break;
+    }
+
+    // Ericson 5.1.6, the origin is outside every face it lies on the far side of from the fourth
+    // vertex, the closest point is then the closest of those faces
+    static const unsigned faces[4][4] = {
+        { 0, 1, 2, 3 },
+        { 0, 2, 3, 1 },
+        { 0, 3, 1, 2 },
+        { 1, 3, 2, 0 }
+    };
+    ConvexSimplex best;
+    float         bestDistSquared = INFINITY;
+    bool          inside          = true;
+    for ( int f = 0; f < 4; f++ )
+    {
+        const ac_vec3* a      = &simplex->vertices[faces[f][0]].w;
+        const ac_vec3* b      = &simplex->vertices[faces[f][1]].w;
+        const ac_vec3* c      = &simplex->vertices[faces[f][2]].w;
+        const ac_vec3* d      = &simplex->vertices[faces[f][3]].w;
+        ac_vec3        ab     = ac_vec3_sub(b, a);
+        ac_vec3        ac     = ac_vec3_sub(c, a);
+        ac_vec3        ad     = ac_vec3_sub(d, a);
+        ac_vec3        normal = ac_vec3_cross(&ab, &ac);
+        float          origin = -ac_vec3_dot(&normal, a);
+        float          other  = ac_vec3_dot(&normal, &ad);
+        if ( origin * other > 0.0f )
+        {
+            continue;
+        }
+
+        inside                = false;
+        ConvexSimplex face    = *simplex;
+        solve_triangle(&face, faces[f][0], faces[f][1], faces[f][2]);
+        ac_vec3 closest       = simplex_point(&face, false);
+        float   distSquared   = ac_vec3_dot(&closest, &closest);
+        if ( distSquared < bestDistSquared )
+        {
+            bestDistSquared = distSquared;
+            best            = face;
+        }
+    }
+
+    if ( !inside )
+    {
+        *simplex = best;
+    }
+    return inside;
+}
+
+static bool epa_add_face(
+    EpaFace*            faces,
+    unsigned*           numFaces,
+    const ConvexVertex* vertices,
+    const ac_vec3*      interior,
+    unsigned            a,
+    unsigned            b,
+    unsigned            c
+)
+{
+    if ( *numFaces == AC_CONVEX_MAX_FACES )
+    {
+        return false;
+    }
+
+    ac_vec3 ab     = ac_vec3_sub(&vertices[b].w, &vertices[a].w);
+    ac_vec3 ac     = ac_vec3_sub(&vertices[c].w, &vertices[a].w);
+    ac_vec3 normal = ac_vec3_cross(&ab, &ac);
+    float   length = ac_vec3_magnitude(&normal);
+    if ( length <= 0.0f )
+    {
+        return false;
+    }
+
+    // wind the face so its normal points away from a point inside the polytope
+    ac_vec3  outward = ac_vec3_sub(&vertices[a].w, interior);
+    EpaFace* face    = &faces[(*numFaces)++];
+    face->normal     = ac_vec3_scale(&normal, 1.0f / length);
+    face->v[0]       = a;
+    face->v[1]       = b;
+    face->v[2]       = c;
+    if ( ac_vec3_dot(&face->normal, &outward) < 0.0f )
+    {
+        face->normal = ac_vec3_negate(&face->normal);
+        face->v[1]   = c;
+        face->v[2]   = b;
+    }
+    face->distance = ac_vec3_dot(&face->normal, &vertices[a].w);
+    return true;
+}
+
+static unsigned epa_closest_face(const EpaFace* faces, unsigned numFaces)
+{
+    unsigned closest = 0;
+    for ( unsigned f = 1; f < numFaces; f++ )
+    {
+        if ( faces[f].distance < faces[closest].distance )
+        {
+            closest = f;
+        }
+    }
+    return closest;
+}
+
+/**
+ * \brief Grows a simplex containing the origin into a tetrahedron.
+ * \return false if the Minkowski difference is flat, so the shapes only touch.
+ */
+static bool blow_up_simplex(ConvexSimplex* simplex, const ConvexPair* pair)
+{
+    static const ac_vec3 axes[6] = {
+        { { 1.0f, 0.0f, 0.0f } },
+        { { -1.0f, 0.0f, 0.0f } },
+        { { 0.0f, 1.0f, 0.0f } },
+        { { 0.0f, -1.0f, 0.0f } },
+        { { 0.0f, 0.0f, 1.0f } },
+        { { 0.0f, 0.0f, -1.0f } }
+    };
+
+    if ( simplex->count == 1 )
+    {
+        for ( int i = 0; i < 6 && simplex->count == 1; i++ )
+        {
+            ConvexVertex vertex = pair_support(pair, &axes[i]);
+            ac_vec3      offset = ac_vec3_sub(&vertex.w, &simplex->vertices[0].w);
+            if ( ac_vec3_dot(&offset, &offset) > AC_CONVEX_TOLERANCE )
+            {
+                simplex->vertices[simplex->count++] = vertex;
+            }
+        }
+    }
+    if ( simplex->count == 2 )
+    {
+        ac_vec3 line = ac_vec3_sub(&simplex->vertices[1].w, &simplex->vertices[0].w);
+        for ( int i = 0; i < 6 && simplex->count == 2; i++ )
+        {
+            ac_vec3 direction = ac_vec3_cross(&line, &axes[i]);
+            if ( ac_vec3_dot(&direction, &direction) <= 0.0f )
+            {
+                continue;
+            }
+            ConvexVertex vertex = pair_support(pair, &direction);
+            ac_vec3      offset = ac_vec3_sub(&vertex.w, &simplex->vertices[0].w);
+            ac_vec3      area   = ac_vec3_cross(&line, &offset);
+            if ( ac_vec3_dot(&area, &area) > AC_CONVEX_TOLERANCE )
+            {
+                simplex->vertices[simplex->count++] = vertex;
+            }
+        }
+    }
+    if ( simplex->count == 3 )
+    {
+        ac_vec3 ab     = ac_vec3_sub(&simplex->vertices[1].w, &simplex->vertices[0].w);
+        ac_vec3 ac     = ac_vec3_sub(&simplex->vertices[2].w, &simplex->vertices[0].w);
+        ac_vec3 normal = ac_vec3_cross(&ab, &ac);
+        for ( int side = 0; side < 2 && simplex->count == 3; side++ )
+        {
+            ConvexVertex vertex = pair_support(pair, &normal);
+            ac_vec3      offset = ac_vec3_sub(&vertex.w, &simplex->vertices[0].w);
+            float        height = ac_vec3_dot(&normal, &offset);
+            if ( height * height > AC_CONVEX_TOLERANCE * ac_vec3_dot(&normal, &normal) )
+            {
+                simplex->vertices[simplex->count++] = vertex;
+            }
+            normal = ac_vec3_negate(&normal);
+        }
+    }
+    return simplex->count == 4;
+}
+
+static IntersectionResult epa(const ConvexSimplex* simplex, const ConvexPair* pair)
+{
+    IntersectionResult ret = { .intersected = false };
+    ConvexVertex       vertices[AC_CONVEX_MAX_VERTICES];
+    EpaFace            faces[AC_CONVEX_MAX_FACES];
+    unsigned           edges[AC_CONVEX_MAX_EDGES][2];
+    unsigned           numVertices = 4, numFaces = 0;
+    ac_vec3            interior    = ac_vec3_zero();
+    for ( unsigned i = 0; i < 4; i++ )
+    {
+        vertices[i] = simplex->vertices[i];
+        interior    = ac_vec3_add(&interior, &vertices[i].w);
+    }
+    interior = ac_vec3_scale(&interior, 0.25f);
+    if ( !epa_add_face(faces, &numFaces, vertices, &interior, 0, 1, 2)
+         || !epa_add_face(faces, &numFaces, vertices, &interior, 0, 3, 1)
+         || !epa_add_face(faces, &numFaces, vertices, &interior, 0, 2, 3)
+         || !epa_add_face(faces, &numFaces, vertices, &interior, 1, 3, 2) )
+    {
+        return ret;
+    }
+
+    for ( int iteration = 0; iteration < AC_CONVEX_MAX_ITERATIONS; iteration++ )
+    {
+        const EpaFace* closest  = &faces[epa_closest_face(faces, numFaces)];
+        ConvexVertex   vertex   = pair_support(pair, &closest->normal);
+        float          progress = ac_vec3_dot(&vertex.w, &closest->normal) - closest->distance;
+        if ( progress <= AC_CONVEX_TOLERANCE * fmaxf(1.0f, closest->distance)
+             || numVertices == AC_CONVEX_MAX_VERTICES )
+        {
+            break;
+        }
+
+        // remove every face the new vertex can see, keeping the edges of the hole they leave
+        unsigned newVertex      = numVertices;
+        unsigned numEdges       = 0;
+        vertices[numVertices++] = vertex;
+        for ( unsigned f = 0; f < numFaces; )
+        {
+            ac_vec3 offset = ac_vec3_sub(&vertex.w, &vertices[faces[f].v[0]].w);
+            if ( ac_vec3_dot(&faces[f].normal, &offset) <= 0.0f )
+            {
+                f++;
+                continue;
+            }
+
+            for ( int e = 0; e < 3; e++ )
+            {
+                unsigned from = faces[f].v[e], to = faces[f].v[(e + 1) % 3];
+                bool     shared = false;
+                for ( unsigned k = 0; k < numEdges; k++ )
+                {
+                    if ( edges[k][0] == to && edges[k][1] == from )
+                    {
+                        edges[k][0] = edges[numEdges - 1][0];
+                        edges[k][1] = edges[numEdges - 1][1];
+                        numEdges--;
+                        shared = true;
+                        break;
+                    }
+                }
+                if ( !shared && numEdges < AC_CONVEX_MAX_EDGES )
+                {
+                    edges[numEdges][0] = from;
+                    edges[numEdges][1] = to;
+                    numEdges++;
+                }
+            }
+            faces[f] = faces[--numFaces];
+        }
+
+        // degenerate faces are skipped, they have no area to hold the closest point
+        for ( unsigned e = 0; e < numEdges; e++ )
+        {
+            epa_add_face(
+                faces, &numFaces, vertices, &interior, edges[e][0], edges[e][1], newVertex
+            );
+        }
+        if ( numFaces == 0 )
+        {
+            return ret;
+        }
+    }
+
+    // the contact lies where the origin projects onto the closest face
+    const EpaFace* face = &faces[epa_closest_face(faces, numFaces)];
+    ConvexSimplex  triangle;
+    triangle.count       = 3;
+    triangle.vertices[0] = vertices[face->v[0]];
+    triangle.vertices[1] = vertices[face->v[1]];
+    triangle.vertices[2] = vertices[face->v[2]];
+    for ( int i = 0; i < 3; i++ )
+    {
+        // shift the face onto the origin so the triangle solver returns the projection
+        ac_vec3 shift          = ac_vec3_scale(&face->normal, face->distance);
+        triangle.vertices[i].w = ac_vec3_sub(&triangle.vertices[i].w, &shift);
+    }
+    solve_triangle(&triangle, 0, 1, 2);
+
+    ret.intersected      = face->distance > 0.0f;
+    ret.contactNormal    = face->normal;
+    ret.penetrationDepth = face->distance;
+    ret.contactPoint     = simplex_point(&triangle, true);
+    return ret;
+}
+
+ac_vec3 collider_support(
+    const Collider* collider, const ac_vec3* position, const ac_vec3* direction
+)
+{
+    ac_vec3 point = ac_vec3_zero();
+    switch ( collider->type )
+    {
+    case SPHERE_C: {
+        float radius    = ((const Sphere*) collider->data)->radius;
+        float magnitude = ac_vec3_magnitude(direction);
+        point           = magnitude > 0.0f ? ac_vec3_scale(direction, radius / magnitude)
+                                           : (ac_vec3){ radius, 0.0f, 0.0f };
+        break;
+    }
+    case AABB_C: {
+        const ac_vec3* halfExtents = &((const AABB*) collider->data)->half_extents;
+        for ( int i = 0; i < 3; i++ )
+        {
+            float extent  = halfExtents->data[i];
+            point.data[i] = direction->data[i] < 0.0f ? -extent : extent;
+        }
+        break;
+    }
+    case CONVEX_C: {
+        const Convex* convex = (const Convex*) collider->data;
+        point                = convex->support(convex->shape, direction);
+        break;
+    }
+    default:
+        break;
+    }
+    return ac_vec3_add(&point, position);
+}
+
+IntersectionResult convex_intersect(
+    const Collider* c1,
+    const ac_vec3*  p1,
+    const Collider* c2,
+    const ac_vec3*  p2,
+    ConvexCache*    cache
+)
+{
+    ConvexPair    pair    = { c1, p1, c2, p2 };
+    ConvexSimplex simplex = { .count = 0 };
+    bool          inside  = false;
+
+    // rebuild last frame's simplex at the new positions
+    if ( cache != NULL )
+    {
+        for ( unsigned i = 0; i < cache->count && i < 4; i++ )
+        {
+            simplex.vertices[simplex.count++] = pair_support(&pair, &cache->directions[i]);
+        }
+    }
+    if ( simplex.count == 0 )
+    {
+        ac_vec3 direction = ac_vec3_sub(p1, p2);
+        if ( ac_vec3_dot(&direction, &direction) <= 0.0f )
+        {
+            direction = (ac_vec3){ 1.0f, 0.0f, 0.0f };
+        }
+        simplex.vertices[simplex.count++] = pair_support(&pair, &direction);
+    }
+    inside = solve_simplex(&simplex);
+
+    unsigned iterations = 0;
+    bool     separated  = false;
+    while ( !inside && iterations < AC_CONVEX_MAX_ITERATIONS )
+    {
+        ac_vec3 v           = simplex_point(&simplex, false);
+        float   distSquared = ac_vec3_dot(&v, &v);
+        if ( distSquared <= AC_CONVEX_TOLERANCE * AC_CONVEX_TOLERANCE )
+        {
+            break;  // the origin is on the simplex
+        }
+
+        ac_vec3      direction = ac_vec3_negate(&v);
+        ConvexVertex vertex    = pair_support(&pair, &direction);
+        iterations++;
+        if ( distSquared - ac_vec3_dot(&v, &vertex.w) <= AC_CONVEX_TOLERANCE * distSquared )
+        {
+            separated = true;  // no point of the difference is closer to the origin
+            break;
+        }
+
+        simplex.vertices[simplex.count++] = vertex;
+        inside                            = solve_simplex(&simplex);
+    }
+
+    if ( cache != NULL )
+    {
+        cache->count      = simplex.count;
+        cache->iterations = iterations;
+        for ( unsigned i = 0; i < simplex.count; i++ )
+        {
+            cache->directions[i] = simplex.vertices[i].direction;
+        }
+    }
+
+    if ( separated || (!inside && iterations == AC_CONVEX_MAX_ITERATIONS) )
+    {
+        return (IntersectionResult){ .intersected = false };
+    }
+    if ( !inside && !blow_up_simplex(&simplex, &pair) )
+    {
+        return (IntersectionResult){ .intersected = false };
+    }
+    return epa(&simplex, &pair);
+}
+
+ac_vec3 convex_hull_support(const void* shape, const ac_vec3* direction)
+{
+    const ConvexHull* hull    = (const ConvexHull*) shape;
+    unsigned          best    = 0;
+    float             bestDot = -INFINITY;
+    for ( unsigned i = 0; i < hull->numPoints; i++ )
+    {
+        float dot = ac_vec3_dot(&hull->points[i], direction);
+        if ( dot > bestDot )
+        {
+            bestDot = dot;
+            best    = i;
+        }
+    }
+    return hull->numPoints > 0 ? hull->points[best] : ac_vec3_zero();
+}
+
+ac_vec3 cylinder_support(const void* shape, const ac_vec3* direction)
+{
+    const Cylinder* cylinder = (const Cylinder*) shape;
+    float           radial   = sqrtf(direction->x * direction->x + direction->z * direction->z);
+    float           scale    = radial > 0.0f ? cylinder->radius / radial : 0.0f;
+    return (ac_vec3){ direction->x * scale,
+                      direction->y < 0.0f ? -cylinder->halfHeight : cylinder->halfHeight,
+                      direction->z * scale };
+}
+
+ac_vec3 cone_support(const void* shape, const ac_vec3* direction)
+{
+    // the apex is furthest unless the direction is below the cone's side
+    const Cone* cone      = (const Cone*) shape;
+    float       height    = 2.0f * cone->halfHeight;
+    float       slant     = sqrtf(cone->radius * cone->radius + height * height);
+    float       magnitude = ac_vec3_magnitude(direction);
+    if ( direction->y > magnitude * cone->radius / slant )
+    {
+        return (ac_vec3){ 0.0f, cone->halfHeight, 0.0f };
+    }
+
+    float radial = sqrtf(direction->x * direction->x + direction->z * direction->z);
+    float scale  = radial > 0.0f ? cone->radius / radial : 0.0f;
+    return (ac_vec3){ direction->x * scale, -cone->halfHeight, direction->z * scale };
+}
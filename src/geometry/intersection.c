@@ -3,8 +3,13 @@
  * \author Blake Caldwell
  * \brief Implements intersection functions for various shapes.
  */
+#include <ace/geometry/convex.h>
 #include <ace/geometry/intersection.h>
+#include <ace/geometry/manifold.h>
+#include <ace/geometry/mesh.h>
+#include <ace/math/math.h>
 #include <math.h>
+#include <stddef.h>
 
 IntersectionResult sphere_sphere(
     const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
@@ -32,17 +37,10 @@ IntersectionResult sphere_sphere(
         // pen depth
         ret.penetrationDepth = rT - dist;
 
-        // contact point
-        float ratio = ret.penetrationDepth / rT;
-
-        // get contact of each sphere then set final as mid point between
-        ac_vec3 contact1, contact2;
-
-        contact1 = ac_vec3_scale(&ret.contactNormal, (sphere1->radius * ratio));
-        contact2 = ac_vec3_scale(&ret.contactNormal, (sphere2->radius * ratio));
-
-        ret.contactPoint = ac_vec3_add(&contact1, &contact2);
-        ret.contactPoint = ac_vec3_scale(&ret.contactPoint, 0.5f);  // get middle point with / 2
+        // contact point, the middle of the overlap along the normal
+        ret.contactPoint =
+            ac_vec3_scale(&ret.contactNormal, sphere1->radius - ret.penetrationDepth * 0.5f);
+        ret.contactPoint = ac_vec3_add(&ret.contactPoint, p1);
     }
     return ret;
 }
@@ -67,7 +65,7 @@ IntersectionResult sphere_AABB(
     ac_vec3 closestPoint;
     for ( int i = 0; i < 3; i++ )
     {
-        closestPoint.data[i] = fmaxf(Bmin.data[i], fminf(p1->data[i], Bmax.data[i]));
+        closestPoint.data[i] = ac_clamp(p1->data[i], Bmin.data[i], Bmax.data[i]);
     }
 
     ac_vec3 diffVec = ac_vec3_sub(&closestPoint, p1);
@@ -95,3 +93,176 @@ IntersectionResult AABB_sphere(
 {
     return sphere_AABB(c2, p2, c1, p1);
 }
+
+static IntersectionResult sphere_closest_point_contact(
+    float radius, const ac_vec3* center, const ac_vec3* closest, const ac_vec3* faceNormal
+)
+{
+    // mirrors sphere_AABB, the closest point is in world space
+    IntersectionResult ret;
+    ret.intersected = true;
+
+    ac_vec3 diffVec = ac_vec3_sub(closest, center);
+    float   dist    = ac_vec3_magnitude(&diffVec);
+    if ( dist > 0.0f )
+    {
+        ret.contactNormal = ac_vec3_scale(&diffVec, 1.0f / dist);
+    }
+    else
+    {
+        // the centre is on the surface, push it out along the face normal
+        ret.contactNormal = ac_vec3_negate(faceNormal);
+    }
+    ret.penetrationDepth = radius - dist;
+    ret.contactPoint     = ac_vec3_scale(&ret.contactNormal, ret.penetrationDepth);
+    ret.contactPoint     = ac_vec3_add(&ret.contactPoint, closest);
+    return ret;
+}
+
+IntersectionResult sphere_mesh(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+)
+{
+    Sphere*       sphere = (Sphere*) c1->data;
+    TriangleMesh* mesh   = (TriangleMesh*) c2->data;
+
+    // the mesh is queried in its own space so it can be shared between entities
+    ac_vec3 local = ac_vec3_sub(p1, p2);
+    ac_vec3 closest, normal;
+    if ( !triangle_mesh_closest_point(mesh, &local, sphere->radius, &closest, &normal) )
+    {
+        return (IntersectionResult){ .intersected = false };
+    }
+
+    closest = ac_vec3_add(&closest, p2);
+    return sphere_closest_point_contact(sphere->radius, p1, &closest, &normal);
+}
+
+IntersectionResult mesh_sphere(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+)
+{
+    IntersectionResult ret = sphere_mesh(c2, p2, c1, p1);
+    ret.contactNormal      = ac_vec3_negate(&ret.contactNormal);
+    return ret;
+}
+
+IntersectionResult sphere_heightfield(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+)
+{
+    Sphere*      sphere      = (Sphere*) c1->data;
+    Heightfield* heightfield = (Heightfield*) c2->data;
+
+    ac_vec3 local = ac_vec3_sub(p1, p2);
+    ac_vec3 closest, normal;
+    if ( !heightfield_closest_point(heightfield, &local, sphere->radius, &closest, &normal) )
+    {
+        return (IntersectionResult){ .intersected = false };
+    }
+
+    closest = ac_vec3_add(&closest, p2);
+    return sphere_closest_point_contact(sphere->radius, p1, &closest, &normal);
+}
+
+IntersectionResult heightfield_sphere(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+)
+{
+    IntersectionResult ret = sphere_heightfield(c2, p2, c1, p1);
+    ret.contactNormal      = ac_vec3_negate(&ret.contactNormal);
+    return ret;
+}
+
+IntersectionResult convex_convex(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+)
+{
+    return convex_intersect(c1, p1, c2, p2, NULL);
+}
+
+static const ac_vec3 identityAxes[3] = {
+    { { 1.0f, 0.0f, 0.0f } },
+    { { 0.0f, 1.0f, 0.0f } },
+    { { 0.0f, 0.0f, 1.0f } }
+};
+
+static IntersectionResult manifold_deepest_contact(const ContactManifold* manifold)
+{
+    unsigned deepest = contact_manifold_deepest(manifold);
+    return (IntersectionResult){ .intersected      = true,
+                                 .contactNormal    = manifold->normal,
+                                 .penetrationDepth = manifold->points[deepest].penetrationDepth,
+                                 .contactPoint     = manifold->points[deepest].position };
+}
+
+IntersectionResult AABB_AABB(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+)
+{
+    AABB*           box1 = (AABB*) c1->data;
+    AABB*           box2 = (AABB*) c2->data;
+    ContactManifold manifold;
+    if ( !box_box_manifold(
+             p1, identityAxes, &box1->half_extents, p2, identityAxes, &box2->half_extents, &manifold
+         ) )
+    {
+        return (IntersectionResult){ .intersected = false };
+    }
+    return manifold_deepest_contact(&manifold);
+}
+
+IntersectionResult AABB_plane(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+)
+{
+    AABB*           box   = (AABB*) c1->data;
+    Plane*          plane = (Plane*) c2->data;
+    ContactManifold manifold;
+    if ( !box_plane_manifold(p1, identityAxes, &box->half_extents, p2, &plane->normal, &manifold) )
+    {
+        return (IntersectionResult){ .intersected = false };
+    }
+    return manifold_deepest_contact(&manifold);
+}
+
+IntersectionResult plane_AABB(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+)
+{
+    IntersectionResult ret = AABB_plane(c2, p2, c1, p1);
+    ret.contactNormal      = ac_vec3_negate(&ret.contactNormal);
+    return ret;
+}
+
+IntersectionResult sphere_plane(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+)
+{
+    Sphere* sphere = (Sphere*) c1->data;
+    Plane*  plane  = (Plane*) c2->data;
+
+    IntersectionResult ret;
+    ac_vec3            offset   = ac_vec3_sub(p1, p2);
+    float              distance = ac_vec3_dot(&plane->normal, &offset);
+
+    ret.intersected = distance < sphere->radius;
+    if ( ret.intersected )
+    {
+        // the deepest point of the sphere, as sphere_AABB
+        ret.contactNormal    = ac_vec3_negate(&plane->normal);
+        ret.penetrationDepth = sphere->radius - distance;
+        ret.contactPoint     = ac_vec3_scale(&ret.contactNormal, sphere->radius);
+        ret.contactPoint     = ac_vec3_add(&ret.contactPoint, p1);
+    }
+    return ret;
+}
+
+IntersectionResult plane_sphere(
+    const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
+)
+{
+    IntersectionResult ret = sphere_plane(c2, p2, c1, p1);
+    ret.contactNormal      = ac_vec3_negate(&ret.contactNormal);
+    return ret;
+}
@@ -0,0 +1,463 @@
+/**
+ * \file
+ * \brief Implements contact manifold generation for boxes and planes.
+ */
+#include <ace/geometry/manifold.h>
+#include <math.h>
+
+#define AC_MANIFOLD_MAX_CLIP        16
+#define AC_MANIFOLD_EDGE_EPSILON    1e-4f
+#define AC_MANIFOLD_RELATIVE_BIAS   0.98f
+#define AC_MANIFOLD_ABSOLUTE_BIAS   0.001f
+#define AC_MANIFOLD_FEATURE_EDGE    0x10000u
+#define AC_MANIFOLD_FEATURE_FLIPPED 0x8000u
+
+typedef struct
+{
+    ac_vec3  position;
+    uint32_t feature;
+} ClipVertex;
+
+static float project_box(const ac_vec3 axes[3], const ac_vec3* halfExtents, const ac_vec3* axis)
+{
+    return halfExtents->x * fabsf(ac_vec3_dot(&axes[0], axis))
+         + halfExtents->y * fabsf(ac_vec3_dot(&axes[1], axis))
+         + halfExtents->z * fabsf(ac_vec3_dot(&axes[2], axis));
+}
+
+static ac_vec3 add_scaled(const ac_vec3* point, const ac_vec3* direction, float scale)
+{
+    ac_vec3 offset = ac_vec3_scale(direction, scale);
+    return ac_vec3_add(point, &offset);
+}
+
+static float triangle_area(
+    const ac_vec3* a, const ac_vec3* b, const ac_vec3* c, const ac_vec3* normal
+)
+{
+    ac_vec3 ab    = ac_vec3_sub(b, a);
+    ac_vec3 ac    = ac_vec3_sub(c, a);
+    ac_vec3 cross = ac_vec3_cross(&ab, &ac);
+    return ac_vec3_dot(&cross, normal);
+}
+
+/**
+ * \brief Keeps the deepest point and the three others that span the largest area with it.
+ */
+static void reduce_points(
+    ContactManifold* manifold, const ContactPoint* candidates, unsigned count
+)
+{
+    manifold->numPoints = 0;
+    if ( count <= AC_MANIFOLD_MAX_POINTS )
+    {
+        for ( unsigned i = 0; i < count; i++ )
+        {
+            manifold->points[manifold->numPoints++] = candidates[i];
+        }
+        return;
+    }
+
+    unsigned deepest = 0;
+    for ( unsigned i = 1; i < count; i++ )
+    {
+        if ( candidates[i].penetrationDepth > candidates[deepest].penetrationDepth )
+        {
+            deepest = i;
+        }
+    }
+
+    unsigned furthest     = deepest;
+    float    furthestDist = -1.0f;
+    for ( unsigned i = 0; i < count; i++ )
+    {
+        ac_vec3 offset = ac_vec3_sub(&candidates[i].position, &candidates[deepest].position);
+        float   dist   = ac_vec3_dot(&offset, &offset);
+        if ( dist > furthestDist )
+        {
+            furthestDist = dist;
+            furthest     = i;
+        }
+    }
+
+    // the points either side of the first edge that form the largest triangles with it
+    unsigned left = count, right = count;
+    float    leftArea = 0.0f, rightArea = 0.0f;
+    for ( unsigned i = 0; i < count; i++ )
+    {
+        float area = triangle_area(
+            &candidates[deepest].position,
+            &candidates[furthest].position,
+            &candidates[i].position,
+            &manifold->normal
+        );
+        if ( area > leftArea )
+        {
+            leftArea = area;
+            left     = i;
+        }
+        if ( area < rightArea )
+        {
+            rightArea = area;
+            right     = i;
+        }
+    }
+
+    manifold->points[manifold->numPoints++] = candidates[deepest];
+    if ( furthest != deepest )
+    {
+        manifold->points[manifold->numPoints++] = candidates[furthest];
+    }
+    if ( left != count )
+    {
+        manifold->points[manifold->numPoints++] = candidates[left];
+    }
+    if ( right != count )
+    {
+        manifold->points[manifold->numPoints++] = candidates[right];
+    }
+}
+
+/**
+ * \brief Clips a polygon to the half space dot(normal, x) <= offset.
+ */
+static unsigned clip_polygon(
+    const ClipVertex* in,
+    unsigned          count,
+    const ac_vec3*    normal,
+    float             offset,
+    uint32_t          plane,
+    ClipVertex*       out
+)
+{
+    unsigned numOut = 0;
+    for ( unsigned i = 0; i < count && numOut + 2 <= AC_MANIFOLD_MAX_CLIP; i++ )
+    {
+        const ClipVertex* a         = &in[i];
+        const ClipVertex* b         = &in[(i + 1) % count];
+        float             distanceA = ac_vec3_dot(normal, &a->position) - offset;
+        float             distanceB = ac_vec3_dot(normal, &b->position) - offset;
+        if ( distanceA <= 0.0f )
+        {
+            out[numOut++] = *a;
+        }
+        if ( (distanceA <= 0.0f) != (distanceB <= 0.0f) )
+        {
+            // a new vertex where the edge leaving a crosses the plane
+            ac_vec3 edge  = ac_vec3_sub(&b->position, &a->position);
+            float   t     = distanceA / (distanceA - distanceB);
+            out[numOut++] = (ClipVertex){ add_scaled(&a->position, &edge, t),
+                                          (a->feature & 0x3u) | ((plane + 1) << 2) };
+        }
+    }
+    return numOut;
+}
+
+static void face_manifold(
+    const ac_vec3*   refCentre,
+    const ac_vec3    refAxes[3],
+    const ac_vec3*   refHalfExtents,
+    unsigned         refAxis,
+    const ac_vec3*   incCentre,
+    const ac_vec3    incAxes[3],
+    const ac_vec3*   incHalfExtents,
+    const ac_vec3*   refNormal,
+    uint32_t         flipped,
+    ContactManifold* manifold
+)
+{
+    // the incident face is the face of the other box most opposed to the reference face
+    unsigned incAxis = 0;
+    float    best    = -1.0f;
+    for ( unsigned i = 0; i < 3; i++ )
+    {
+        float alignment = fabsf(ac_vec3_dot(&incAxes[i], refNormal));
+        if ( alignment > best )
+        {
+            best    = alignment;
+            incAxis = i;
+        }
+    }
+    float    incSign = ac_vec3_dot(&incAxes[incAxis], refNormal) > 0.0f ? -1.0f : 1.0f;
+    float    extent  = incHalfExtents->data[incAxis] * incSign;
+    ac_vec3  centre  = add_scaled(incCentre, &incAxes[incAxis], extent);
+    unsigned u = (incAxis + 1) % 3, v = (incAxis + 2) % 3;
+    float    extentU = incHalfExtents->data[u];
+    float    extentV = incHalfExtents->data[v];
+    ClipVertex polygon[AC_MANIFOLD_MAX_CLIP], clipped[AC_MANIFOLD_MAX_CLIP];
+    static const float corners[4][2] = {
+        {  1.0f,  1.0f },
+        { -1.0f,  1.0f },
+        { -1.0f, -1.0f },
+        {  1.0f, -1.0f }
+    };
+    for ( uint32_t i = 0; i < 4; i++ )
+    {
+        ac_vec3 corner      = add_scaled(&centre, &incAxes[u], extentU * corners[i][0]);
+        polygon[i].position = add_scaled(&corner, &incAxes[v], extentV * corners[i][1]);
+        polygon[i].feature  = i;
+    }
+
+    // clip against the four side planes of the reference face
+    unsigned count = 4;
+    for ( uint32_t plane = 0; plane < 4 && count > 0; plane++ )
+    {
+        unsigned axis   = (refAxis + 1 + plane / 2) % 3;
+        float    sign   = (plane % 2) ? -1.0f : 1.0f;
+        ac_vec3  normal = ac_vec3_scale(&refAxes[axis], sign);
+        float    offset = ac_vec3_dot(&normal, refCentre) + refHalfExtents->data[axis];
+        count           = clip_polygon(polygon, count, &normal, offset, plane, clipped);
+        for ( unsigned i = 0; i < count; i++ )
+        {
+            polygon[i] = clipped[i];
+        }
+    }
+
+    // keep the points below the reference face
+    float        refOffset = ac_vec3_dot(refNormal, refCentre) + refHalfExtents->data[refAxis];
+    uint32_t     refFace   = refAxis * 2 + (ac_vec3_dot(&refAxes[refAxis], refNormal) < 0.0f);
+    uint32_t     incFace   = incAxis * 2 + (incSign < 0.0f);
+    ContactPoint candidates[AC_MANIFOLD_MAX_CLIP];
+    unsigned     numCandidates = 0;
+    for ( unsigned i = 0; i < count; i++ )
+    {
+        float separation = ac_vec3_dot(refNormal, &polygon[i].position) - refOffset;
+        if ( separation <= 0.0f )
+        {
+            candidates[numCandidates++] = (ContactPoint){
+                .position         = polygon[i].position,
+                .penetrationDepth = -separation,
+                .feature = flipped | (refFace << 10) | (incFace << 6) | polygon[i].feature,
+                .normalImpulse    = 0.0f,
+            };
+        }
+    }
+    reduce_points(manifold, candidates, numCandidates);
+}
+
+static void edge_manifold(
+    const ac_vec3*   p1,
+    const ac_vec3    axes1[3],
+    const ac_vec3*   halfExtents1,
+    unsigned         edge1,
+    const ac_vec3*   p2,
+    const ac_vec3    axes2[3],
+    const ac_vec3*   halfExtents2,
+    unsigned         edge2,
+    float            depth,
+    ContactManifold* manifold
+)
+{
+    // the edge of each box nearest the other, found from the signs of the other axes
+    uint32_t signs = 0;
+    ac_vec3  a = *p1, b = *p2;
+    for ( unsigned k = 0; k < 3; k++ )
+    {
+        if ( k != edge1 )
+        {
+            bool  negative = ac_vec3_dot(&axes1[k], &manifold->normal) < 0.0f;
+            float extent   = halfExtents1->data[k];
+            a              = add_scaled(&a, &axes1[k], negative ? -extent : extent);
+            signs         |= (uint32_t) negative << k;
+        }
+        if ( k != edge2 )
+        {
+            bool  negative = ac_vec3_dot(&axes2[k], &manifold->normal) > 0.0f;
+            float extent   = halfExtents2->data[k];
+            b              = add_scaled(&b, &axes2[k], negative ? -extent : extent);
+            signs         |= (uint32_t) negative << (k + 3);
+        }
+    }
+
+    // closest points between the two edges, Ericson 5.1.9 with segments centred on a and b
+    const ac_vec3* directionA = &axes1[edge1];
+    const ac_vec3* directionB = &axes2[edge2];
+    float          lengthA    = halfExtents1->data[edge1];
+    float          lengthB    = halfExtents2->data[edge2];
+    ac_vec3        r          = ac_vec3_sub(&a, &b);
+    float          cosine     = ac_vec3_dot(directionA, directionB);
+    float          c          = ac_vec3_dot(directionA, &r);
+    float          f          = ac_vec3_dot(directionB, &r);
+    float          denom      = 1.0f - cosine * cosine;
+    float          s = denom > AC_MANIFOLD_EDGE_EPSILON ? (cosine * f - c) / denom : 0.0f;
+    s                = fmaxf(-lengthA, fminf(lengthA, s));
+    float t          = fmaxf(-lengthB, fminf(lengthB, cosine * s + f));
+    s                = fmaxf(-lengthA, fminf(lengthA, cosine * t - c));
+
+    ac_vec3 closestA = add_scaled(&a, directionA, s);
+    ac_vec3 closestB = add_scaled(&b, directionB, t);
+    ac_vec3 midpoint = ac_vec3_add(&closestA, &closestB);
+
+    manifold->numPoints = 1;
+    manifold->points[0] = (ContactPoint){
+        .position         = ac_vec3_scale(&midpoint, 0.5f),
+        .penetrationDepth = depth,
+        .feature          = AC_MANIFOLD_FEATURE_EDGE | (edge1 << 12) | (edge2 << 8) | signs,
+        .normalImpulse    = 0.0f,
+    };
+}
+
+bool box_box_manifold(
+    const ac_vec3*   p1,
+    const ac_vec3    axes1[3],
+    const ac_vec3*   halfExtents1,
+    const ac_vec3*   p2,
+    const ac_vec3    axes2[3],
+    const ac_vec3*   halfExtents2,
+    ContactManifold* manifold
+)
+{
+    manifold->numPoints = 0;
+    ac_vec3 offset      = ac_vec3_sub(p2, p1);
+
+    // separating axis test, face axes of each box then the cross products of their edges
+    float    bestOverlap[3] = { INFINITY, INFINITY, INFINITY };
+    ac_vec3  bestAxis[3];
+    unsigned bestIndex[3] = { 0, 0, 0 };
+    for ( unsigned index = 0; index < 15; index++ )
+    {
+        unsigned kind = index < 3 ? 0 : (index < 6 ? 1 : 2);
+        ac_vec3  axis;
+        if ( kind == 0 )
+        {
+            axis = axes1[index];
+        }
+        else if ( kind == 1 )
+        {
+            axis = axes2[index - 3];
+        }
+        else
+        {
+            axis         = ac_vec3_cross(&axes1[(index - 6) / 3], &axes2[(index - 6) % 3]);
+            float length = ac_vec3_magnitude(&axis);
+            if ( length < AC_MANIFOLD_EDGE_EPSILON )
+            {
+                continue;  // parallel edges, covered by the face axes
+            }
+            axis = ac_vec3_scale(&axis, 1.0f / length);
+        }
+
+        float distance = ac_vec3_dot(&offset, &axis);
+        float overlap  = project_box(axes1, halfExtents1, &axis)
+                      + project_box(axes2, halfExtents2, &axis) - fabsf(distance);
+        if ( overlap < 0.0f )
+        {
+            return false;
+        }
+        if ( overlap < bestOverlap[kind] )
+        {
+            bestOverlap[kind] = overlap;
+            bestAxis[kind]    = distance < 0.0f ? ac_vec3_negate(&axis) : axis;
+            bestIndex[kind]   = index;
+        }
+    }
+
+    // prefer the first box's faces, then either box's faces, over edges unless clearly shallower
+    unsigned kind = 0;
+    if ( bestOverlap[1] < AC_MANIFOLD_RELATIVE_BIAS * bestOverlap[0] - AC_MANIFOLD_ABSOLUTE_BIAS )
+    {
+        kind = 1;
+    }
+    if ( bestOverlap[2]
+         < AC_MANIFOLD_RELATIVE_BIAS * bestOverlap[kind] - AC_MANIFOLD_ABSOLUTE_BIAS )
+    {
+        kind = 2;
+    }
+    manifold->normal = bestAxis[kind];
+
+    if ( kind == 0 )
+    {
+        face_manifold(
+            p1, axes1, halfExtents1, bestIndex[0], p2, axes2, halfExtents2, &manifold->normal, 0,
+            manifold
+        );
+    }
+    else if ( kind == 1 )
+    {
+        ac_vec3 refNormal = ac_vec3_negate(&manifold->normal);
+        face_manifold(
+            p2, axes2, halfExtents2, bestIndex[1] - 3, p1, axes1, halfExtents1, &refNormal,
+            AC_MANIFOLD_FEATURE_FLIPPED, manifold
+        );
+    }
+    else
+    {
+        unsigned edge = bestIndex[2] - 6;
+        edge_manifold(
+            p1, axes1, halfExtents1, edge / 3, p2, axes2, halfExtents2, edge % 3, bestOverlap[2],
+            manifold
+        );
+    }
+    return manifold->numPoints > 0;
+}
+
+bool box_plane_manifold(
+    const ac_vec3*   p1,
+    const ac_vec3    axes1[3],
+    const ac_vec3*   halfExtents1,
+    const ac_vec3*   planePoint,
+    const ac_vec3*   planeNormal,
+    ContactManifold* manifold
+)
+{
+    ContactPoint candidates[8];
+    unsigned     count = 0;
+    for ( uint32_t corner = 0; corner < 8; corner++ )
+    {
+        ac_vec3 position = *p1;
+        for ( unsigned axis = 0; axis < 3; axis++ )
+        {
+            float extent = halfExtents1->data[axis];
+            extent       = (corner >> axis) & 1 ? extent : -extent;
+            position     = add_scaled(&position, &axes1[axis], extent);
+        }
+
+        ac_vec3 offset     = ac_vec3_sub(&position, planePoint);
+        float   separation = ac_vec3_dot(planeNormal, &offset);
+        if ( separation < 0.0f )
+        {
+            candidates[count++] = (ContactPoint){ .position         = position,
+                                                  .penetrationDepth = -separation,
+                                                  .feature          = corner,
+                                                  .normalImpulse    = 0.0f };
+        }
+    }
+
+    manifold->normal = ac_vec3_negate(planeNormal);
+    reduce_points(manifold, candidates, count);
+    return manifold->numPoints > 0;
+}
+
+void contact_manifold_merge(ContactManifold* persistent, const ContactManifold* fresh)
+{
+    // cos(18 degrees), past this the old impulses push in the wrong direction
+    bool            coherent = persistent->numPoints > 0
+                       && ac_vec3_dot(&persistent->normal, &fresh->normal) >= 0.95f;
+    ContactManifold merged   = *fresh;
+    for ( unsigned i = 0; i < merged.numPoints; i++ )
+    {
+        merged.points[i].normalImpulse = 0.0f;
+        for ( unsigned j = 0; coherent && j < persistent->numPoints; j++ )
+        {
+            if ( persistent->points[j].feature == merged.points[i].feature )
+            {
+                merged.points[i].normalImpulse = persistent->points[j].normalImpulse;
+                break;
+            }
+        }
+    }
+    *persistent = merged;
+}
+
+unsigned contact_manifold_deepest(const ContactManifold* manifold)
+{
+    unsigned deepest = 0;
+    for ( unsigned i = 1; i < manifold->numPoints; i++ )
+    {
+        if ( manifold->points[i].penetrationDepth > manifold->points[deepest].penetrationDepth )
+        {
+            deepest = i;
+        }
+    }
+    return deepest;
+}
@@ -0,0 +1,434 @@
+/**
+ * \file
+ * \brief Implements triangle mesh and heightfield construction and queries.
+ */
+#include <ace/geometry/mesh.h>
+#include <ace/math/math.h>
+#include <math.h>
+#include <stdlib.h>
+
+#define AC_MESH_QUANTIZE_MAX 65535.0f
+#define AC_MESH_STACK_SIZE   64
+#define AC_MESH_COUNT_SHIFT  29
+#define AC_MESH_FIRST_MASK   ((1u << AC_MESH_COUNT_SHIFT) - 1u)
+
+static void triangle_vertices(
+    const TriangleMesh* mesh, uint32_t triangle, ac_vec3* a, ac_vec3* b, ac_vec3* c
+)
+{
+    const uint32_t* index = &mesh->indices[3 * (size_t) triangle];
+    *a                    = mesh->vertices[index[0]];
+    *b                    = mesh->vertices[index[1]];
+    *c                    = mesh->vertices[index[2]];
+}
+
+static ac_vec3 triangle_normal(const ac_vec3* a, const ac_vec3* b, const ac_vec3* c)
+{
+    ac_vec3 ab     = ac_vec3_sub(b, a);
+    ac_vec3 ac     = ac_vec3_sub(c, a);
+    ac_vec3 normal = ac_vec3_cross(&ab, &ac);
+    return ac_vec3_normalize(&normal);
+}
+
+static uint16_t quantize(const TriangleMesh* mesh, float value, int axis, bool roundUp)
+{
+    float scaled = (value - mesh->boundsMin.data[axis]) * mesh->quantizeScale.data[axis];
+    // one step of slack either way so float rounding can never shrink a node
+    scaled = roundUp ? ceilf(scaled) + 1.0f : floorf(scaled) - 1.0f;
+    return (uint16_t) ac_clamp(scaled, 0.0f, AC_MESH_QUANTIZE_MAX);
+}
+
+static void select_median(
+    uint32_t* triangles, const ac_vec3* centroids, unsigned count, unsigned k, int axis
+)
+{
+    // quickselect, leaves the k smallest centroids along axis before index k
+    unsigned low = 0, high = count - 1;
+    while ( low < high )
+    {
+        float    pivot = centroids[triangles[low + (high - low) / 2]].data[axis];
+        unsigned i = low, j = high;
+        while ( i <= j )
+        {
+            while ( centroids[triangles[i]].data[axis] < pivot )
+                i++;
+            while ( centroids[triangles[j]].data[axis] > pivot )
+                j--;
+            if ( i <= j )
+            {
+                uint32_t swap = triangles[i];
+                triangles[i]  = triangles[j];
+                triangles[j]  = swap;
+                i++;
+                if ( j == 0 )
+                    break;
+                j--;
+            }
+        }
+        if ( k <= j )
+            high = j;
+        else if ( k >= i )
+            low = i;
+        else
+            break;
+    }
+}
+
+static unsigned build_node(
+    TriangleMesh* mesh, const ac_vec3* centroids, unsigned first, unsigned count
+)
+{
+    unsigned          nodeIndex = mesh->numNodes++;
+    TriangleMeshNode* node      = &mesh->nodes[nodeIndex];
+
+    ac_vec3 min = { INFINITY, INFINITY, INFINITY }, max = { -INFINITY, -INFINITY, -INFINITY };
+    ac_vec3 centroidMin = min, centroidMax = max;
+    for ( unsigned i = first; i < first + count; i++ )
+    {
+        ac_vec3 v[3];
+        triangle_vertices(mesh, mesh->triangles[i], &v[0], &v[1], &v[2]);
+        for ( int axis = 0; axis < 3; axis++ )
+        {
+            for ( int corner = 0; corner < 3; corner++ )
+            {
+                min.data[axis] = fminf(min.data[axis], v[corner].data[axis]);
+                max.data[axis] = fmaxf(max.data[axis], v[corner].data[axis]);
+            }
+            float centroid         = centroids[mesh->triangles[i]].data[axis];
+            centroidMin.data[axis] = fminf(centroidMin.data[axis], centroid);
+            centroidMax.data[axis] = fmaxf(centroidMax.data[axis], centroid);
+        }
+    }
+    for ( int axis = 0; axis < 3; axis++ )
+    {
+        node->min[axis] = quantize(mesh, min.data[axis], axis, false);
+        node->max[axis] = quantize(mesh, max.data[axis], axis, true);
+    }
+
+    if ( count <= AC_MESH_MAX_LEAF_TRIANGLES )
+    {
+        node->data = ((uint32_t) count << AC_MESH_COUNT_SHIFT) | first;
+        return nodeIndex;
+    }
+
+    int axis = 0;
+    for ( int i = 1; i < 3; i++ )
+    {
+        if ( centroidMax.data[i] - centroidMin.data[i]
+             > centroidMax.data[axis] - centroidMin.data[axis] )
+        {
+            axis = i;
+        }
+    }
+
+    unsigned half = count / 2;
+    select_median(&mesh->triangles[first], centroids, count, half, axis);
+    build_node(mesh, centroids, first, half);
+    // the node array is not reallocated while building, so node is still valid
+    node->data = build_node(mesh, centroids, first + half, count - half);
+    return nodeIndex;
+}
+
+bool triangle_mesh_build(
+    TriangleMesh*   mesh,
+    const ac_vec3*  vertices,
+    unsigned        numVertices,
+    const uint32_t* indices,
+    unsigned        numTriangles
+)
+{
+    *mesh = (TriangleMesh){ .vertices     = vertices,
+                            .indices      = indices,
+                            .numVertices  = numVertices,
+                            .numTriangles = numTriangles };
+    if ( numTriangles == 0 || numTriangles > AC_MESH_FIRST_MASK )
+    {
+        return false;
+    }
+    for ( size_t i = 0; i < 3 * (size_t) numTriangles; i++ )
+    {
+        if ( indices[i] >= numVertices )
+        {
+            return false;
+        }
+    }
+
+    mesh->boundsMin = (ac_vec3){ INFINITY, INFINITY, INFINITY };
+    mesh->boundsMax = (ac_vec3){ -INFINITY, -INFINITY, -INFINITY };
+    for ( unsigned i = 0; i < numVertices; i++ )
+    {
+        for ( int axis = 0; axis < 3; axis++ )
+        {
+            mesh->boundsMin.data[axis] = fminf(mesh->boundsMin.data[axis], vertices[i].data[axis]);
+            mesh->boundsMax.data[axis] = fmaxf(mesh->boundsMax.data[axis], vertices[i].data[axis]);
+        }
+    }
+    for ( int axis = 0; axis < 3; axis++ )
+    {
+        float extent                   = mesh->boundsMax.data[axis] - mesh->boundsMin.data[axis];
+        mesh->quantizeScale.data[axis] = extent > 0.0f ? AC_MESH_QUANTIZE_MAX / extent : 0.0f;
+    }
+
+    // a binary tree with at most one leaf per triangle
+    ac_vec3* centroids = malloc(sizeof(ac_vec3) * numTriangles);
+    mesh->nodes        = malloc(sizeof(TriangleMeshNode) * (2 * (size_t) numTriangles - 1));
+    mesh->triangles    = malloc(sizeof(uint32_t) * numTriangles);
+    if ( centroids == NULL || mesh->nodes == NULL || mesh->triangles == NULL )
+    {
+        free(centroids);
+        triangle_mesh_free(mesh);
+        return false;
+    }
+
+    for ( unsigned i = 0; i < numTriangles; i++ )
+    {
+        ac_vec3 a, b, c;
+        triangle_vertices(mesh, i, &a, &b, &c);
+        centroids[i]       = ac_vec3_add(&a, &b);
+        centroids[i]       = ac_vec3_add(&centroids[i], &c);
+        centroids[i]       = ac_vec3_scale(&centroids[i], 1.0f / 3.0f);
+        mesh->triangles[i] = i;
+    }
+    build_node(mesh, centroids, 0, numTriangles);
+    free(centroids);
+    return true;
+}
+
+void triangle_mesh_free(TriangleMesh* mesh)
+{
+    free(mesh->nodes);
+    free(mesh->triangles);
+    mesh->nodes     = NULL;
+    mesh->triangles = NULL;
+    mesh->numNodes  = 0;
+}
+
+bool triangle_mesh_closest_point(
+    const TriangleMesh* mesh,
+    const ac_vec3*      point,
+    float               radius,
+    ac_vec3*            closest,
+    ac_vec3*            normal
+)
+{
+    uint16_t queryMin[3], queryMax[3];
+    for ( int axis = 0; axis < 3; axis++ )
+    {
+        if ( point->data[axis] + radius < mesh->boundsMin.data[axis]
+             || point->data[axis] - radius > mesh->boundsMax.data[axis] )
+        {
+            return false;
+        }
+        queryMin[axis] = quantize(mesh, point->data[axis] - radius, axis, false);
+        queryMax[axis] = quantize(mesh, point->data[axis] + radius, axis, true);
+    }
+
+    float    bestDistSquared = radius * radius;
+    bool     found           = false;
+    unsigned stack[AC_MESH_STACK_SIZE];
+    unsigned top = 0;
+    stack[top++] = 0;
+    while ( top > 0 )
+    {
+        const TriangleMeshNode* node = &mesh->nodes[stack[--top]];
+        if ( node->min[0] > queryMax[0] || node->max[0] < queryMin[0] || node->min[1] > queryMax[1]
+             || node->max[1] < queryMin[1] || node->min[2] > queryMax[2]
+             || node->max[2] < queryMin[2] )
+        {
+            continue;
+        }
+
+        unsigned count = node->data >> AC_MESH_COUNT_SHIFT;
+        if ( count == 0 )
+        {
+            // the left child directly follows its parent
+            stack[top++] = node->data;
+            stack[top++] = (unsigned) (node - mesh->nodes) + 1;
+            continue;
+        }
+
+        unsigned first = node->data & AC_MESH_FIRST_MASK;
+        for ( unsigned i = first; i < first + count; i++ )
+        {
+            ac_vec3 a, b, c;
+            triangle_vertices(mesh, mesh->triangles[i], &a, &b, &c);
+            ac_vec3 candidate   = triangle_closest_point(point, &a, &b, &c);
+            ac_vec3 diffVec     = ac_vec3_sub(&candidate, point);
+            float   distSquared = ac_vec3_dot(&diffVec, &diffVec);
+            if ( distSquared <= bestDistSquared )
+            {
+                bestDistSquared = distSquared;
+                found           = true;
+                *closest        = candidate;
+                *normal         = triangle_normal(&a, &b, &c);
+            }
+        }
+    }
+    return found;
+}
+
+bool heightfield_init(
+    Heightfield* heightfield, const float* heights, unsigned numX, unsigned numZ, float cellSize
+)
+{
+    if ( numX < 2 || numZ < 2 || !(cellSize > 0.0f) )
+    {
+        return false;
+    }
+
+    *heightfield = (Heightfield){ .heights   = heights,
+                                  .numX      = numX,
+                                  .numZ      = numZ,
+                                  .cellSize  = cellSize,
+                                  .minHeight = heights[0],
+                                  .maxHeight = heights[0] };
+    for ( size_t i = 1; i < (size_t) numX * numZ; i++ )
+    {
+        heightfield->minHeight = fminf(heightfield->minHeight, heights[i]);
+        heightfield->maxHeight = fmaxf(heightfield->maxHeight, heights[i]);
+    }
+    return true;
+}
+
+static bool heightfield_cell_range(
+    float min, float max, float cellSize, unsigned numSamples, unsigned* first, unsigned* last
+)
+{
+    float extent = (float) (numSamples - 1) * cellSize;
+    if ( max < 0.0f || min > extent )
+    {
+        return false;
+    }
+
+    *first = (unsigned) (fmaxf(min, 0.0f) / cellSize);
+    *last  = (unsigned) (fminf(max, extent) / cellSize);
+    *first = *first > numSamples - 2 ? numSamples - 2 : *first;
+    *last  = *last > numSamples - 2 ? numSamples - 2 : *last;
+    return true;
+}
+
+bool heightfield_closest_point(
+    const Heightfield* heightfield,
+    const ac_vec3*     point,
+    float              radius,
+    ac_vec3*           closest,
+    ac_vec3*           normal
+)
+{
+    if ( point->y - radius > heightfield->maxHeight || point->y + radius < heightfield->minHeight )
+    {
+        return false;
+    }
+
+    unsigned x0, x1, z0, z1;
+    float    cellSize = heightfield->cellSize;
+    if ( !heightfield_cell_range(
+             point->x - radius, point->x + radius, cellSize, heightfield->numX, &x0, &x1
+         )
+         || !heightfield_cell_range(
+             point->z - radius, point->z + radius, cellSize, heightfield->numZ, &z0, &z1
+         ) )
+    {
+        return false;
+    }
+
+    float bestDistSquared = radius * radius;
+    bool  found           = false;
+    for ( unsigned z = z0; z <= z1; z++ )
+    {
+        for ( unsigned x = x0; x <= x1; x++ )
+        {
+            const float* row  = &heightfield->heights[(size_t) z * heightfield->numX + x];
+            const float* next = row + heightfield->numX;
+            float        fx   = (float) x * cellSize;
+            float        fz   = (float) z * cellSize;
+            ac_vec3      v00  = { fx, row[0], fz };
+            ac_vec3      v10  = { fx + cellSize, row[1], fz };
+            ac_vec3      v01  = { fx, next[0], fz + cellSize };
+            ac_vec3      v11  = { fx + cellSize, next[1], fz + cellSize };
+
+            // each cell is split along its v10 - v01 diagonal, both wound to face +y
+            const ac_vec3* triangles[2][3] = {
+                { &v00, &v01, &v10 },
+                { &v10, &v01, &v11 }
+            };
+            for ( int t = 0; t < 2; t++ )
+            {
+                ac_vec3 candidate = triangle_closest_point(
+                    point, triangles[t][0], triangles[t][1], triangles[t][2]
+                );
+                ac_vec3 diffVec     = ac_vec3_sub(&candidate, point);
+                float   distSquared = ac_vec3_dot(&diffVec, &diffVec);
+                if ( distSquared <= bestDistSquared )
+                {
+                    bestDistSquared = distSquared;
+                    found           = true;
+                    *closest        = candidate;
+                    *normal = triangle_normal(triangles[t][0], triangles[t][1], triangles[t][2]);
+                }
+            }
+        }
+    }
+    return found;
+}
+
+ac_vec3 triangle_closest_point(
+    const ac_vec3* p, const ac_vec3* a, const ac_vec3* b, const ac_vec3* c
+)
+{
+    // Real-Time Collision Detection, Ericson, 5.1.5
+    ac_vec3 ab = ac_vec3_sub(b, a);
+    ac_vec3 ac = ac_vec3_sub(c, a);
+    ac_vec3 ap = ac_vec3_sub(p, a);
+    float   d1 = ac_vec3_dot(&ab, &ap);
+    float   d2 = ac_vec3_dot(&ac, &ap);
+    if ( d1 <= 0.0f && d2 <= 0.0f )
+    {
+        return *a;
+    }
+
+    ac_vec3 bp = ac_vec3_sub(p, b);
+    float   d3 = ac_vec3_dot(&ab, &bp);
+    float   d4 = ac_vec3_dot(&ac, &bp);
+    if ( d3 >= 0.0f && d4 <= d3 )
+    {
+        return *b;
+    }
+
+    float vc = d1 * d4 - d3 * d2;
+    if ( vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f )
+    {
+        ac_vec3 offset = ac_vec3_scale(&ab, d1 / (d1 - d3));
+        return ac_vec3_add(a, &offset);
+    }
+
+    ac_vec3 cp = ac_vec3_sub(p, c);
+    float   d5 = ac_vec3_dot(&ab, &cp);
+    float   d6 = ac_vec3_dot(&ac, &cp);
+    if ( d6 >= 0.0f && d5 <= d6 )
+    {
+        return *c;
+    }
+
+    float vb = d5 * d2 - d1 * d6;
+    if ( vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f )
+    {
+        ac_vec3 offset = ac_vec3_scale(&ac, d2 / (d2 - d6));
+        return ac_vec3_add(a, &offset);
+    }
+
+    float va = d3 * d6 - d5 * d4;
+    if ( va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f )
+    {
+        ac_vec3 bc     = ac_vec3_sub(c, b);
+        ac_vec3 offset = ac_vec3_scale(&bc, (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+        return ac_vec3_add(b, &offset);
+    }
+
+    // inside the face
+    float   denom   = 1.0f / (va + vb + vc);
+    ac_vec3 offsetB = ac_vec3_scale(&ab, vb * denom);
+    ac_vec3 offsetC = ac_vec3_scale(&ac, vc * denom);
+    ac_vec3 result  = ac_vec3_add(a, &offsetB);
+    return ac_vec3_add(&result, &offsetC);
+}
@@ -0,0 +1,21 @@
+/**
+ * \file
+ * \brief Marks the batch loops for per-CPU code generation.
+ */
+#pragma once
+
+/**
+ * \def AC_BATCH_KERNEL
+ * \brief Builds a function for both AVX2 and the baseline instruction set where supported.
+ * \details
+ * The loader picks the AVX2 version on CPUs that have it. Other compilers and platforms build the
+ * function once for the target set at compile time.
+ */
+#if defined(__x86_64__) && defined(__linux__) && defined(__has_attribute)
+    #if __has_attribute(target_clones)
+        #define AC_BATCH_KERNEL __attribute__((target_clones("avx2", "default")))
+    #endif
+#endif
+#ifndef AC_BATCH_KERNEL
+    #define AC_BATCH_KERNEL
+#endif
@@ -0,0 +1,174 @@
+/**
+ * \file
+ * \brief Fast math approximations implementation.
+ * \details
+ * The polynomials and range reductions follow the single precision Cephes library.
+ */
+#include <ace/math/fast.h>
+#include <ace/math/math.h>
+#include <ace/math/vec4.h>
+#include <math.h>
+
+#if defined(AC_VEC4_SSE)
+    #include <xmmintrin.h>
+#elif defined(AC_VEC4_NEON)
+    #include <arm_neon.h>
+#endif
+
+#define AC_HALF_PI 1.57079632679489661923f
+
+/**
+ * \brief Computes the reciprocal square root, inlined into each of its callers.
+ * \param[in] x The value.
+ * \return The reciprocal square root.
+ */
+static inline float rsqrt(float x)
+{
+#if defined(AC_DETERMINISTIC)
+    return 1.0f / sqrtf(x);
+#elif defined(AC_VEC4_SSE)
+    // the estimate has 12 bits, one Newton-Raphson step doubles them
+    float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+    return y * (1.5f - 0.5f * (x * y * y));
+#elif defined(AC_VEC4_NEON)
+    // the estimate has 8 bits, so it takes two steps
+    float32x2_t value    = vdup_n_f32(x);
+    float32x2_t estimate = vrsqrte_f32(value);
+    estimate = vmul_f32(estimate, vrsqrts_f32(vmul_f32(value, estimate), estimate));
+    estimate = vmul_f32(estimate, vrsqrts_f32(vmul_f32(value, estimate), estimate));
+    return vget_lane_f32(estimate, 0);
+#else
+    return 1.0f / sqrtf(x);
+#endif
+}
+
+float ac_rsqrt(float x)
+{
+    return rsqrt(x);
+}
+
+void ac_sincos(float angle, float* sine, float* cosine)
+{
+    const float max_reduced_angle = 8192.0f;
+    if ( !(fabsf(angle) <= max_reduced_angle) )
+    {
+        // beyond the range where the reduction is accurate, this also passes through NaN
+        *sine   = sinf(angle);
+        *cosine = cosf(angle);
+        return;
+    }
+
+    // reduce to [-pi/4, pi/4] by the nearest multiple of pi/2, which is split into three parts so
+    // that the products with the quadrant are exact
+    const float pi_2_part1 = 1.5703125f;
+    const float pi_2_part2 = 4.837512969970703125e-4f;
+    const float pi_2_part3 = 7.54978995489188216e-8f;
+    int         turns      = (int) (angle * (2.0f / AC_PI) + (angle < 0.0f ? -0.5f : 0.5f));
+    float       quadrant   = (float) turns;
+    float       x          = ((angle - quadrant * pi_2_part1) - quadrant * pi_2_part2)
+                - quadrant * pi_2_part3;
+    float       z          = x * x;
+
+    float s = ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * x + x;
+    float c = ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f)
+                * z * z
+            - 0.5f * z + 1.0f;
+
+    // rotate the result into the quadrant of the angle, which swaps the two every odd quadrant and
+    // negates each in two of the four
+    bool  odd        = turns & 1;
+    float sine_value = odd ? c : s;
+    float cos_value  = odd ? s : c;
+    *sine            = (turns & 2) ? -sine_value : sine_value;
+    *cosine          = ((turns + 1) & 2) ? -cos_value : cos_value;
+}
+
+/**
+ * \brief Computes the arc sine for |x| <= 0.5.
+ * \param[in] x The value.
+ * \return The arc sine.
+ */
+static float asin_small(float x)
+{
+    float z = x * x;
+    float p = (((4.2163199048e-2f * z + 2.4181311049e-2f) * z + 4.5470025998e-2f) * z
+               + 7.4953002686e-2f)
+                * z
+            + 1.6666752422e-1f;
+    return p * z * x + x;
+}
+
+float ac_acos_fast(float x)
+{
+    if ( !(fabsf(x) <= 1.0f) )
+    {
+        return NAN;
+    }
+
+    if ( fabsf(x) <= 0.5f )
+    {
+        return AC_HALF_PI - asin_small(x);
+    }
+
+    // acos(x) = 2 asin(sqrt((1 - x) / 2)) keeps the precision near 1 and -1
+    float half_angle = 2.0f * asin_small(sqrtf(0.5f * (1.0f - fabsf(x))));
+    return x > 0.0f ? half_angle : AC_PI - half_angle;
+}
+
+/**
+ * \brief Computes the arc tangent for x >= 0.
+ * \param[in] x The value.
+ * \return The arc tangent.
+ */
+static float atan_positive(float x)
+{
+    // reduce to [0, tan(pi/8)] with the identities for atan(1/x) and atan((x - 1) / (x + 1))
+    float offset = 0.0f;
+    if ( x > 2.414213562373095f )
+    {
+        offset = AC_HALF_PI;
+        x      = -1.0f / x;
+    }
+    else if ( x > 0.4142135623730950f )
+    {
+        offset = 0.25f * AC_PI;
+        x      = (x - 1.0f) / (x + 1.0f);
+    }
+
+    float z = x * x;
+    float p = ((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z
+            - 3.33329491539e-1f;
+    return offset + (p * z * x + x);
+}
+
+float ac_atan2_fast(float y, float x)
+{
+    if ( x == 0.0f )
+    {
+        if ( y == 0.0f )
+        {
+            return 0.0f;
+        }
+        return y > 0.0f ? AC_HALF_PI : -AC_HALF_PI;
+    }
+
+    float angle = atan_positive(fabsf(y / x));
+    if ( x < 0.0f )
+    {
+        angle = AC_PI - angle;
+    }
+    return y < 0.0f ? -angle : angle;
+}
+
+ac_vec3 ac_vec3_normalize_fast(const ac_vec3* v)
+{
+    // the same zero length test as ac_vec3_normalize, applied to the squared length
+    float length_sq = v->x * v->x + v->y * v->y + v->z * v->z;
+    if ( !(length_sq > AC_EPSILON * AC_EPSILON) )
+    {
+        return ac_vec3_nan();
+    }
+    float   scale  = rsqrt(length_sq);
+    ac_vec3 result = { { v->x * scale, v->y * scale, v->z * scale } };
+    return result;
+}
@@ -0,0 +1,649 @@
+/**
+ * \file
+ * \brief Fixed-point scalar and vector functions implementation.
+ * \details
+ * Products and sums are computed exactly on unsigned magnitudes in a portable 128-bit integer,
+ * then rounded once, so no step relies on compiler extensions or implementation defined shifts.
+ */
+#include <ace/math/fixed.h>
+#include <math.h>
+
+_Static_assert(sizeof(int) == 4, "ac_fixed requires a 32-bit int");
+
+//--------------------------------------------------------------------------------------------------
+// 128-bit unsigned arithmetic
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \brief A 128-bit unsigned integer.
+ */
+typedef struct u128
+{
+    uint64_t hi, lo;
+} u128;
+
+static u128 u128_from(uint64_t value)
+{
+    u128 result = { 0, value };
+    return result;
+}
+
+static u128 u128_add(u128 a, u128 b)
+{
+    u128 result = { a.hi + b.hi, a.lo + b.lo };
+    result.hi += result.lo < a.lo;
+    return result;
+}
+
+static u128 u128_sub(u128 a, u128 b)
+{
+    u128 result = { a.hi - b.hi, a.lo - b.lo };
+    result.hi -= a.lo < b.lo;
+    return result;
+}
+
+static bool u128_less(u128 a, u128 b)
+{
+    return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+}
+
+/**
+ * \brief Shifts left by 1 to 63 bits.
+ */
+static u128 u128_shift_left(u128 a, int bits)
+{
+    u128 result = { (a.hi << bits) | (a.lo >> (64 - bits)), a.lo << bits };
+    return result;
+}
+
+/**
+ * \brief Shifts right by 1 to 63 bits, rounding to nearest with ties away from zero.
+ */
+static u128 u128_shift_right_round(u128 a, int bits)
+{
+    a           = u128_add(a, u128_from((uint64_t) 1 << (bits - 1)));
+    u128 result = { a.hi >> bits, (a.lo >> bits) | (a.hi << (64 - bits)) };
+    return result;
+}
+
+static u128 u128_mul(uint64_t a, uint64_t b)
+{
+    // schoolbook multiplication of the 32-bit halves
+    uint64_t a_lo   = (uint32_t) a;
+    uint64_t a_hi   = a >> 32;
+    uint64_t b_lo   = (uint32_t) b;
+    uint64_t b_hi   = b >> 32;
+    uint64_t lo_lo  = a_lo * b_lo;
+    uint64_t hi_lo  = a_hi * b_lo;
+    uint64_t lo_hi  = a_lo * b_hi;
+    uint64_t middle = (lo_lo >> 32) + (uint32_t) hi_lo + lo_hi;
+
+    u128 result = {
+        a_hi * b_hi + (hi_lo >> 32) + (middle >> 32),
+        (middle << 32) | (uint32_t) lo_lo,
+    };
+    return result;
+}
+
+/**
+ * \brief Divides, rounding to nearest with ties away from zero.
+ * \param[in] numerator The dividend.
+ * \param[in] divisor The divisor, which must not be zero.
+ * \param[out] quotient The quotient.
+ * \return False if the quotient does not fit in 64 bits.
+ */
+static bool u128_div_round(u128 numerator, uint64_t divisor, uint64_t* quotient)
+{
+    numerator = u128_add(numerator, u128_from(divisor / 2));
+    if ( numerator.hi >= divisor )
+    {
+        return false;
+    }
+
+    // restoring long division, one bit of the quotient at a time
+    uint64_t remainder = numerator.hi;
+    uint64_t result    = 0;
+    for ( int bit = 63; bit >= 0; bit-- )
+    {
+        uint64_t carry = remainder >> 63;
+        remainder      = (remainder << 1) | ((numerator.lo >> bit) & 1);
+        result         = result << 1;
+        if ( carry || remainder >= divisor )
+        {
+            remainder = remainder - divisor;
+            result    = result | 1;
+        }
+    }
+    *quotient = result;
+    return true;
+}
+
+/**
+ * \brief Computes the square root, rounded down.
+ */
+static uint64_t u128_sqrt(u128 value)
+{
+    // the digit by digit method, which brings down two bits of the value for each bit of the root
+    u128     remainder = { 0, 0 };
+    uint64_t root      = 0;
+    for ( int digit = 63; digit >= 0; digit-- )
+    {
+        uint64_t pair = digit >= 32 ? value.hi >> (2 * (digit - 32)) : value.lo >> (2 * digit);
+        remainder     = u128_shift_left(remainder, 2);
+        remainder.lo  = remainder.lo | (pair & 3);
+
+        // the trial subtrahend is 4 * root + 1
+        u128 trial = u128_shift_left(u128_from(root), 2);
+        trial.lo   = trial.lo | 1;
+        root       = root << 1;
+        if ( !u128_less(remainder, trial) )
+        {
+            remainder = u128_sub(remainder, trial);
+            root      = root | 1;
+        }
+    }
+    return root;
+}
+
+//--------------------------------------------------------------------------------------------------
+// exact sums of products
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \brief A sum of signed products, kept as separate positive and negative magnitudes so that it
+ * is exact for up to three products of 64-bit values.
+ */
+typedef struct product_sum
+{
+    u128 positive, negative;
+} product_sum;
+
+static uint64_t magnitude(int64_t value)
+{
+    return value < 0 ? (uint64_t) 0 - (uint64_t) value : (uint64_t) value;
+}
+
+static void product_sum_add(product_sum* sum, int64_t a, int64_t b)
+{
+    u128 product = u128_mul(magnitude(a), magnitude(b));
+    if ( (a < 0) != (b < 0) )
+    {
+        sum->negative = u128_add(sum->negative, product);
+    }
+    else
+    {
+        sum->positive = u128_add(sum->positive, product);
+    }
+}
+
+static void product_sum_sub(product_sum* sum, int64_t a, int64_t b)
+{
+    product_sum_add(sum, a, -b);
+}
+
+/**
+ * \brief Resolves a sum into its magnitude and sign.
+ */
+static u128 product_sum_resolve(const product_sum* sum, bool* negative)
+{
+    *negative = u128_less(sum->positive, sum->negative);
+    return *negative ? u128_sub(sum->negative, sum->positive)
+                     : u128_sub(sum->positive, sum->negative);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Q16.16
+//--------------------------------------------------------------------------------------------------
+
+#define AC_FIXED_FRACTION_BITS 16
+
+static ac_fixed fixed_from_magnitude(u128 value, bool negative)
+{
+    if ( value.hi != 0 || value.lo > INT_MAX )
+    {
+        return INT_INVALID;
+    }
+    return negative ? -(ac_fixed) value.lo : (ac_fixed) value.lo;
+}
+
+static ac_fixed fixed_from_sum(const product_sum* sum)
+{
+    bool negative;
+    u128 value = product_sum_resolve(sum, &negative);
+    return fixed_from_magnitude(u128_shift_right_round(value, AC_FIXED_FRACTION_BITS), negative);
+}
+
+ac_fixed ac_fixed_from_int(int value)
+{
+    if ( value < -32767 || value > 32767 )
+    {
+        return INT_INVALID;
+    }
+    return value * AC_FIXED_ONE;
+}
+
+ac_fixed ac_fixed_from_float(float value)
+{
+    float scaled = roundf(value * (float) AC_FIXED_ONE);
+    if ( !(fabsf(scaled) < 2147483648.0f) )
+    {
+        return INT_INVALID;
+    }
+    return (ac_fixed) scaled;
+}
+
+float ac_fixed_to_float(ac_fixed value)
+{
+    if ( value == INT_INVALID )
+    {
+        return NAN;
+    }
+    return (float) value / (float) AC_FIXED_ONE;
+}
+
+ac_fixed ac_fixed_add(ac_fixed a, ac_fixed b)
+{
+    if ( a == INT_INVALID || b == INT_INVALID )
+    {
+        return INT_INVALID;
+    }
+
+    int64_t sum = (int64_t) a + b;
+    return sum < -INT_MAX || sum > INT_MAX ? INT_INVALID : (ac_fixed) sum;
+}
+
+ac_fixed ac_fixed_sub(ac_fixed a, ac_fixed b)
+{
+    if ( b == INT_INVALID )
+    {
+        return INT_INVALID;
+    }
+    return ac_fixed_add(a, -b);
+}
+
+ac_fixed ac_fixed_mul(ac_fixed a, ac_fixed b)
+{
+    if ( a == INT_INVALID || b == INT_INVALID )
+    {
+        return INT_INVALID;
+    }
+
+    product_sum sum = { { 0, 0 }, { 0, 0 } };
+    product_sum_add(&sum, a, b);
+    return fixed_from_sum(&sum);
+}
+
+ac_fixed ac_fixed_div(ac_fixed a, ac_fixed b)
+{
+    if ( a == INT_INVALID || b == INT_INVALID || b == 0 )
+    {
+        return INT_INVALID;
+    }
+
+    uint64_t quotient;
+    u128     numerator = u128_from(magnitude(a) << AC_FIXED_FRACTION_BITS);
+    if ( !u128_div_round(numerator, magnitude(b), &quotient) )
+    {
+        return INT_INVALID;
+    }
+    return fixed_from_magnitude(u128_from(quotient), (a < 0) != (b < 0));
+}
+
+ac_fixed ac_fixed_sqrt(ac_fixed value)
+{
+    if ( value == INT_INVALID || value < 0 )
+    {
+        return INT_INVALID;
+    }
+    return (ac_fixed) u128_sqrt(u128_from((uint64_t) value << AC_FIXED_FRACTION_BITS));
+}
+
+ac_fixed_vec3 ac_fixed_vec3_from_vec3(const ac_vec3* v)
+{
+    ac_fixed_vec3 result = {
+        { ac_fixed_from_float(v->x), ac_fixed_from_float(v->y), ac_fixed_from_float(v->z) }
+    };
+    return ac_ivec3_is_invalid(&result) ? ac_ivec3_invalid() : result;
+}
+
+ac_vec3 ac_fixed_vec3_to_vec3(const ac_fixed_vec3* v)
+{
+    if ( ac_ivec3_is_invalid(v) )
+    {
+        return ac_vec3_nan();
+    }
+
+    ac_vec3 result = {
+        { ac_fixed_to_float(v->x), ac_fixed_to_float(v->y), ac_fixed_to_float(v->z) }
+    };
+    return result;
+}
+
+ac_fixed_vec3 ac_fixed_vec3_add(const ac_fixed_vec3* a, const ac_fixed_vec3* b)
+{
+    // fixed-point addition is integer addition, which saturates in the same way
+    return ac_ivec3_add(a, b);
+}
+
+ac_fixed_vec3 ac_fixed_vec3_sub(const ac_fixed_vec3* a, const ac_fixed_vec3* b)
+{
+    return ac_ivec3_sub(a, b);
+}
+
+ac_fixed_vec3 ac_fixed_vec3_scale(const ac_fixed_vec3* v, ac_fixed scalar)
+{
+    ac_fixed_vec3 result = {
+        { ac_fixed_mul(v->x, scalar), ac_fixed_mul(v->y, scalar), ac_fixed_mul(v->z, scalar) }
+    };
+    return ac_ivec3_is_invalid(&result) ? ac_ivec3_invalid() : result;
+}
+
+ac_fixed ac_fixed_vec3_dot(const ac_fixed_vec3* a, const ac_fixed_vec3* b)
+{
+    if ( ac_ivec3_is_invalid(a) || ac_ivec3_is_invalid(b) )
+    {
+        return INT_INVALID;
+    }
+
+    product_sum sum = { { 0, 0 }, { 0, 0 } };
+    for ( int i = 0; i < 3; i++ )
+    {
+        product_sum_add(&sum, a->data[i], b->data[i]);
+    }
+    return fixed_from_sum(&sum);
+}
+
+ac_fixed_vec3 ac_fixed_vec3_cross(const ac_fixed_vec3* a, const ac_fixed_vec3* b)
+{
+    if ( ac_ivec3_is_invalid(a) || ac_ivec3_is_invalid(b) )
+    {
+        return ac_ivec3_invalid();
+    }
+
+    ac_fixed_vec3 result;
+    for ( int i = 0; i < 3; i++ )
+    {
+        int         j   = (i + 1) % 3;
+        int         k   = (i + 2) % 3;
+        product_sum sum = { { 0, 0 }, { 0, 0 } };
+        product_sum_add(&sum, a->data[j], b->data[k]);
+        product_sum_sub(&sum, a->data[k], b->data[j]);
+        result.data[i] = fixed_from_sum(&sum);
+    }
+    return ac_ivec3_is_invalid(&result) ? ac_ivec3_invalid() : result;
+}
+
+ac_fixed ac_fixed_vec3_length(const ac_fixed_vec3* v)
+{
+    if ( ac_ivec3_is_invalid(v) )
+    {
+        return INT_INVALID;
+    }
+
+    // the squares have twice the fraction bits, so their square root is already Q16.16
+    product_sum sum = { { 0, 0 }, { 0, 0 } };
+    for ( int i = 0; i < 3; i++ )
+    {
+        product_sum_add(&sum, v->data[i], v->data[i]);
+    }
+    return fixed_from_magnitude(u128_from(u128_sqrt(sum.positive)), false);
+}
+
+ac_fixed_vec3 ac_fixed_vec3_normalize(const ac_fixed_vec3* v)
+{
+    ac_fixed length = ac_fixed_vec3_length(v);
+    if ( length == INT_INVALID || length == 0 )
+    {
+        return ac_ivec3_invalid();
+    }
+
+    ac_fixed_vec3 result = {
+        { ac_fixed_div(v->x, length), ac_fixed_div(v->y, length), ac_fixed_div(v->z, length) }
+    };
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Q32.32
+//--------------------------------------------------------------------------------------------------
+
+#define AC_FIXED64_FRACTION_BITS 32
+
+static ac_fixed64 fixed64_from_magnitude(u128 value, bool negative)
+{
+    if ( value.hi != 0 || value.lo > INT64_MAX )
+    {
+        return AC_FIXED64_INVALID;
+    }
+    return negative ? -(ac_fixed64) value.lo : (ac_fixed64) value.lo;
+}
+
+static ac_fixed64 fixed64_from_sum(const product_sum* sum)
+{
+    bool negative;
+    u128 value = product_sum_resolve(sum, &negative);
+    return fixed64_from_magnitude(
+        u128_shift_right_round(value, AC_FIXED64_FRACTION_BITS), negative
+    );
+}
+
+ac_fixed64 ac_fixed64_from_int(int value)
+{
+    if ( value == INT_INVALID )
+    {
+        return AC_FIXED64_INVALID;
+    }
+    return value * AC_FIXED64_ONE;
+}
+
+ac_fixed64 ac_fixed64_from_double(double value)
+{
+    double scaled = round(value * (double) AC_FIXED64_ONE);
+    if ( !(fabs(scaled) < 9223372036854775808.0) )
+    {
+        return AC_FIXED64_INVALID;
+    }
+    return (ac_fixed64) scaled;
+}
+
+double ac_fixed64_to_double(ac_fixed64 value)
+{
+    if ( value == AC_FIXED64_INVALID )
+    {
+        return NAN;
+    }
+    return (double) value / (double) AC_FIXED64_ONE;
+}
+
+ac_fixed64 ac_fixed64_add(ac_fixed64 a, ac_fixed64 b)
+{
+    if ( a == AC_FIXED64_INVALID || b == AC_FIXED64_INVALID )
+    {
+        return AC_FIXED64_INVALID;
+    }
+
+    // test against the limits before adding, as signed overflow is undefined
+    if ( (b > 0 && a > INT64_MAX - b) || (b < 0 && a < -INT64_MAX - b) )
+    {
+        return AC_FIXED64_INVALID;
+    }
+    return a + b;
+}
+
+ac_fixed64 ac_fixed64_sub(ac_fixed64 a, ac_fixed64 b)
+{
+    if ( b == AC_FIXED64_INVALID )
+    {
+        return AC_FIXED64_INVALID;
+    }
+    return ac_fixed64_add(a, -b);
+}
+
+ac_fixed64 ac_fixed64_mul(ac_fixed64 a, ac_fixed64 b)
+{
+    if ( a == AC_FIXED64_INVALID || b == AC_FIXED64_INVALID )
+    {
+        return AC_FIXED64_INVALID;
+    }
+
+    product_sum sum = { { 0, 0 }, { 0, 0 } };
+    product_sum_add(&sum, a, b);
+    return fixed64_from_sum(&sum);
+}
+
+ac_fixed64 ac_fixed64_div(ac_fixed64 a, ac_fixed64 b)
+{
+    if ( a == AC_FIXED64_INVALID || b == AC_FIXED64_INVALID || b == 0 )
+    {
+        return AC_FIXED64_INVALID;
+    }
+
+    uint64_t quotient;
+    u128     numerator = u128_shift_left(u128_from(magnitude(a)), AC_FIXED64_FRACTION_BITS);
+    if ( !u128_div_round(numerator, magnitude(b), &quotient) )
+    {
+        return AC_FIXED64_INVALID;
+    }
+    return fixed64_from_magnitude(u128_from(quotient), (a < 0) != (b < 0));
+}
+
+ac_fixed64 ac_fixed64_sqrt(ac_fixed64 value)
+{
+    if ( value == AC_FIXED64_INVALID || value < 0 )
+    {
+        return AC_FIXED64_INVALID;
+    }
+
+    u128 scaled = u128_shift_left(u128_from((uint64_t) value), AC_FIXED64_FRACTION_BITS);
+    return (ac_fixed64) u128_sqrt(scaled);
+}
+
+ac_fixed64_vec3 ac_fixed64_vec3_invalid(void)
+{
+    ac_fixed64_vec3 result = { { AC_FIXED64_INVALID, AC_FIXED64_INVALID, AC_FIXED64_INVALID } };
+    return result;
+}
+
+bool ac_fixed64_vec3_is_invalid(const ac_fixed64_vec3* v)
+{
+    return (v->x == AC_FIXED64_INVALID || v->y == AC_FIXED64_INVALID
+            || v->z == AC_FIXED64_INVALID);
+}
+
+ac_fixed64_vec3 ac_fixed64_vec3_from_vec3(const ac_vec3* v)
+{
+    ac_fixed64_vec3 result = {
+        { ac_fixed64_from_double(v->x),
+          ac_fixed64_from_double(v->y),
+          ac_fixed64_from_double(v->z) }
+    };
+    return ac_fixed64_vec3_is_invalid(&result) ? ac_fixed64_vec3_invalid() : result;
+}
+
+ac_vec3 ac_fixed64_vec3_to_vec3(const ac_fixed64_vec3* v)
+{
+    if ( ac_fixed64_vec3_is_invalid(v) )
+    {
+        return ac_vec3_nan();
+    }
+
+    ac_vec3 result = {
+        { (float) ac_fixed64_to_double(v->x),
+          (float) ac_fixed64_to_double(v->y),
+          (float) ac_fixed64_to_double(v->z) }
+    };
+    return result;
+}
+
+ac_fixed64_vec3 ac_fixed64_vec3_add(const ac_fixed64_vec3* a, const ac_fixed64_vec3* b)
+{
+    ac_fixed64_vec3 result = {
+        { ac_fixed64_add(a->x, b->x), ac_fixed64_add(a->y, b->y), ac_fixed64_add(a->z, b->z) }
+    };
+    return ac_fixed64_vec3_is_invalid(&result) ? ac_fixed64_vec3_invalid() : result;
+}
+
+ac_fixed64_vec3 ac_fixed64_vec3_sub(const ac_fixed64_vec3* a, const ac_fixed64_vec3* b)
+{
+    ac_fixed64_vec3 result = {
+        { ac_fixed64_sub(a->x, b->x), ac_fixed64_sub(a->y, b->y), ac_fixed64_sub(a->z, b->z) }
+    };
+    return ac_fixed64_vec3_is_invalid(&result) ? ac_fixed64_vec3_invalid() : result;
+}
+
+ac_fixed64_vec3 ac_fixed64_vec3_scale(const ac_fixed64_vec3* v, ac_fixed64 scalar)
+{
+    ac_fixed64_vec3 result = {
+        { ac_fixed64_mul(v->x, scalar),
+          ac_fixed64_mul(v->y, scalar),
+          ac_fixed64_mul(v->z, scalar) }
+    };
+    return ac_fixed64_vec3_is_invalid(&result) ? ac_fixed64_vec3_invalid() : result;
+}
+
+ac_fixed64 ac_fixed64_vec3_dot(const ac_fixed64_vec3* a, const ac_fixed64_vec3* b)
+{
+    if ( ac_fixed64_vec3_is_invalid(a) || ac_fixed64_vec3_is_invalid(b) )
+    {
+        return AC_FIXED64_INVALID;
+    }
+
+    product_sum sum = { { 0, 0 }, { 0, 0 } };
+    for ( int i = 0; i < 3; i++ )
+    {
+        product_sum_add(&sum, a->data[i], b->data[i]);
+    }
+    return fixed64_from_sum(&sum);
+}
+
+ac_fixed64_vec3 ac_fixed64_vec3_cross(const ac_fixed64_vec3* a, const ac_fixed64_vec3* b)
+{
+    if ( ac_fixed64_vec3_is_invalid(a) || ac_fixed64_vec3_is_invalid(b) )
+    {
+        return ac_fixed64_vec3_invalid();
+    }
+
+    ac_fixed64_vec3 result;
+    for ( int i = 0; i < 3; i++ )
+    {
+        int         j   = (i + 1) % 3;
+        int         k   = (i + 2) % 3;
+        product_sum sum = { { 0, 0 }, { 0, 0 } };
+        product_sum_add(&sum, a->data[j], b->data[k]);
+        product_sum_sub(&sum, a->data[k], b->data[j]);
+        result.data[i] = fixed64_from_sum(&sum);
+    }
+    return ac_fixed64_vec3_is_invalid(&result) ? ac_fixed64_vec3_invalid() : result;
+}
+
+ac_fixed64 ac_fixed64_vec3_length(const ac_fixed64_vec3* v)
+{
+    if ( ac_fixed64_vec3_is_invalid(v) )
+    {
+        return AC_FIXED64_INVALID;
+    }
+
+    // the squares have twice the fraction bits, so their square root is already Q32.32
+    product_sum sum = { { 0, 0 }, { 0, 0 } };
+    for ( int i = 0; i < 3; i++ )
+    {
+        product_sum_add(&sum, v->data[i], v->data[i]);
+    }
+    return fixed64_from_magnitude(u128_from(u128_sqrt(sum.positive)), false);
+}
+
+ac_fixed64_vec3 ac_fixed64_vec3_normalize(const ac_fixed64_vec3* v)
+{
+    ac_fixed64 length = ac_fixed64_vec3_length(v);
+    if ( length == AC_FIXED64_INVALID || length == 0 )
+    {
+        return ac_fixed64_vec3_invalid();
+    }
+
+    ac_fixed64_vec3 result = {
+        { ac_fixed64_div(v->x, length),
+          ac_fixed64_div(v->y, length),
+          ac_fixed64_div(v->z, length) }
+    };
+    return result;
+}
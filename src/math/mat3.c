@@ -0,0 +1,96 @@
+/**
+ * \file
+ * \brief 3x3 matrix functions implementation.
+ */
+#include <ace/math/mat3.h>
+#include <math.h>
+
+ac_mat3 ac_mat3_identity(void)
+{
+    ac_mat3 result = {
+        { { { 1.0f, 0.0f, 0.0f } }, { { 0.0f, 1.0f, 0.0f } }, { { 0.0f, 0.0f, 1.0f } } }
+    };
+    return result;
+}
+
+ac_mat3 ac_mat3_from_quat(const ac_quat* q)
+{
+    float xx = q->x * q->x;
+    float yy = q->y * q->y;
+    float zz = q->z * q->z;
+    float xy = q->x * q->y;
+    float xz = q->x * q->z;
+    float yz = q->y * q->z;
+    float wx = q->w * q->x;
+    float wy = q->w * q->y;
+    float wz = q->w * q->z;
+
+    ac_mat3 result = {
+        { { { 1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy) } },
+          { { 2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx) } },
+          { { 2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy) } } }
+    };
+    return result;
+}
+
+ac_mat3 ac_mat3_mul(const ac_mat3* a, const ac_mat3* b)
+{
+    ac_mat3 result;
+    for ( int column = 0; column < 3; column++ )
+    {
+        result.columns[column] = ac_mat3_transform(a, &b->columns[column]);
+    }
+    return result;
+}
+
+ac_vec3 ac_mat3_transform(const ac_mat3* m, const ac_vec3* v)
+{
+    ac_vec3 result;
+    for ( int row = 0; row < 3; row++ )
+    {
+        result.data[row] = m->data[row] * v->x + m->data[3 + row] * v->y + m->data[6 + row] * v->z;
+    }
+    return result;
+}
+
+ac_mat3 ac_mat3_transpose(const ac_mat3* m)
+{
+    ac_mat3 result;
+    for ( int column = 0; column < 3; column++ )
+    {
+        for ( int row = 0; row < 3; row++ )
+        {
+            result.data[column * 3 + row] = m->data[row * 3 + column];
+        }
+    }
+    return result;
+}
+
+float ac_mat3_determinant(const ac_mat3* m)
+{
+    // the scalar triple product of the columns
+    ac_vec3 cross = ac_vec3_cross(&m->columns[1], &m->columns[2]);
+    return ac_vec3_dot(&m->columns[0], &cross);
+}
+
+ac_mat3 ac_mat3_inverse(const ac_mat3* m)
+{
+    // the rows of the inverse are the cross products of the columns divided by the determinant
+    ac_vec3 rows[3] = {
+        ac_vec3_cross(&m->columns[1], &m->columns[2]),
+        ac_vec3_cross(&m->columns[2], &m->columns[0]),
+        ac_vec3_cross(&m->columns[0], &m->columns[1]),
+    };
+    float determinant = ac_vec3_dot(&m->columns[0], &rows[0]);
+    float inverse     = determinant == 0.0f ? NAN : 1.0f / determinant;
+
+    ac_mat3 result;
+    for ( int row = 0; row < 3; row++ )
+    {
+        for ( int column = 0; column < 3; column++ )
+        {
+            result.data[column * 3 + row] = rows[row].data[column] * inverse;
+        }
+    }
+    return result;
+}
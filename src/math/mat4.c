@@ -0,0 +1,285 @@
+/**
+ * \file
+ * \brief 4x4 matrix functions implementation.
+ * \details
+ * Products are computed a column at a time as a weighted sum of the columns of the matrix, which
+ * maps to four SIMD multiplies and three adds. The sum is taken in the same order on every
+ * platform so that the results do not depend on the instruction set.
+ */
+#include <ace/math/mat4.h>
+#include <math.h>
+
+#if defined(AC_VEC4_SSE)
+    #include <xmmintrin.h>
+#elif defined(AC_VEC4_NEON)
+    #include <arm_neon.h>
+#endif
+
+/**
+ * \brief Sums the columns of a matrix weighted by the components of a vector: m * v.
+ * \param[in] m The matrix.
+ * \param[in] x The weight of the first column.
+ * \param[in] y The weight of the second column.
+ * \param[in] z The weight of the third column.
+ * \param[in] w The weight of the fourth column.
+ * \return The weighted sum, ((c0 * x + c1 * y) + c2 * z) + c3 * w.
+ */
+static inline ac_vec4 combine_columns(const ac_mat4* m, float x, float y, float z, float w)
+{
+    ac_vec4 result;
+#if defined(AC_VEC4_SSE)
+    __m128 sum = _mm_mul_ps(_mm_load_ps(m->columns[0].data), _mm_set1_ps(x));
+    sum        = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(m->columns[1].data), _mm_set1_ps(y)));
+    sum        = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(m->columns[2].data), _mm_set1_ps(z)));
+    sum        = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(m->columns[3].data), _mm_set1_ps(w)));
+    _mm_store_ps(result.data, sum);
+#elif defined(AC_VEC4_NEON)
+    float32x4_t sum = vmulq_n_f32(vld1q_f32(m->columns[0].data), x);
+    sum             = vaddq_f32(sum, vmulq_n_f32(vld1q_f32(m->columns[1].data), y));
+    sum             = vaddq_f32(sum, vmulq_n_f32(vld1q_f32(m->columns[2].data), z));
+    sum             = vaddq_f32(sum, vmulq_n_f32(vld1q_f32(m->columns[3].data), w));
+    vst1q_f32(result.data, sum);
+#else
+    for ( int row = 0; row < 4; row++ )
+    {
+        result.data[row] = m->data[row] * x + m->data[4 + row] * y + m->data[8 + row] * z
+                         + m->data[12 + row] * w;
+    }
+#endif
+    return result;
+}
+
+/**
+ * \brief Computes the transposed cofactor matrix, the inverse scaled by the determinant.
+ * \param[in] m The matrix elements.
+ * \param[out] adjugate The adjugate matrix elements.
+ * \return The determinant of the matrix.
+ */
+static float adjugate_matrix(const float* m, float* adjugate)
+{
+    // the determinants of the 2x2 sub-matrices of the first two and last two columns
+    float a0 = m[0] * m[5] - m[1] * m[4];
+    float a1 = m[0] * m[6] - m[2] * m[4];
+    float a2 = m[0] * m[7] - m[3] * m[4];
+    float a3 = m[1] * m[6] - m[2] * m[5];
+    float a4 = m[1] * m[7] - m[3] * m[5];
+    float a5 = m[2] * m[7] - m[3] * m[6];
+    float b0 = m[8] * m[13] - m[9] * m[12];
+    float b1 = m[8] * m[14] - m[10] * m[12];
+    float b2 = m[8] * m[15] - m[11] * m[12];
+    float b3 = m[9] * m[14] - m[10] * m[13];
+    float b4 = m[9] * m[15] - m[11] * m[13];
+    float b5 = m[10] * m[15] - m[11] * m[14];
+
+    adjugate[0]  = m[5] * b5 - m[6] * b4 + m[7] * b3;
+    adjugate[1]  = -m[1] * b5 + m[2] * b4 - m[3] * b3;
+    adjugate[2]  = m[13] * a5 - m[14] * a4 + m[15] * a3;
+    adjugate[3]  = -m[9] * a5 + m[10] * a4 - m[11] * a3;
+    adjugate[4]  = -m[4] * b5 + m[6] * b2 - m[7] * b1;
+    adjugate[5]  = m[0] * b5 - m[2] * b2 + m[3] * b1;
+    adjugate[6]  = -m[12] * a5 + m[14] * a2 - m[15] * a1;
+    adjugate[7]  = m[8] * a5 - m[10] * a2 + m[11] * a1;
+    adjugate[8]  = m[4] * b4 - m[5] * b2 + m[7] * b0;
+    adjugate[9]  = -m[0] * b4 + m[1] * b2 - m[3] * b0;
+    adjugate[10] = m[12] * a4 - m[13] * a2 + m[15] * a0;
+    adjugate[11] = -m[8] * a4 + m[9] * a2 - m[11] * a0;
+    adjugate[12] = -m[4] * b3 + m[5] * b1 - m[6] * b0;
+    adjugate[13] = m[0] * b3 - m[1] * b1 + m[2] * b0;
+    adjugate[14] = -m[12] * a3 + m[13] * a1 - m[14] * a0;
+    adjugate[15] = m[8] * a3 - m[9] * a1 + m[10] * a0;
+
+    return a0 * b5 - a1 * b4 + a2 * b3 + a3 * b2 - a4 * b1 + a5 * b0;
+}
+
+ac_mat4 ac_mat4_identity(void)
+{
+    ac_mat4 result = {
+        { { { 1.0f, 0.0f, 0.0f, 0.0f } },
+          { { 0.0f, 1.0f, 0.0f, 0.0f } },
+          { { 0.0f, 0.0f, 1.0f, 0.0f } },
+          { { 0.0f, 0.0f, 0.0f, 1.0f } } }
+    };
+    return result;
+}
+
+ac_mat4 ac_mat4_translation(const ac_vec3* translation)
+{
+    ac_mat4 result    = ac_mat4_identity();
+    result.columns[3] = ac_vec4_from_vec3(translation, 1.0f);
+    return result;
+}
+
+ac_mat4 ac_mat4_scaling(const ac_vec3* scale)
+{
+    ac_mat4 result  = ac_mat4_identity();
+    result.data[0]  = scale->x;
+    result.data[5]  = scale->y;
+    result.data[10] = scale->z;
+    return result;
+}
+
+ac_mat4 ac_mat4_from_quat(const ac_quat* q)
+{
+    ac_vec3 zero  = { { 0.0f, 0.0f, 0.0f } };
+    ac_vec3 scale = { { 1.0f, 1.0f, 1.0f } };
+    return ac_mat4_from_trs(&zero, q, &scale);
+}
+
+ac_mat4 ac_mat4_from_trs(const ac_vec3* translation, const ac_quat* rotation, const ac_vec3* scale)
+{
+    // the rotation matrix as in ac_mat3_from_quat, with each column scaled by its axis
+    const ac_quat* q  = rotation;
+    float          xx = q->x * q->x;
+    float          yy = q->y * q->y;
+    float          zz = q->z * q->z;
+    float          xy = q->x * q->y;
+    float          xz = q->x * q->z;
+    float          yz = q->y * q->z;
+    float          wx = q->w * q->x;
+    float          wy = q->w * q->y;
+    float          wz = q->w * q->z;
+    float          sx = scale->x;
+    float          sy = scale->y;
+    float          sz = scale->z;
+
+    ac_mat4 result = {
+        { { { (1.0f - 2.0f * (yy + zz)) * sx, 2.0f * (xy + wz) * sx, 2.0f * (xz - wy) * sx, 0 } },
+          { { 2.0f * (xy - wz) * sy, (1.0f - 2.0f * (xx + zz)) * sy, 2.0f * (yz + wx) * sy, 0 } },
+          { { 2.0f * (xz + wy) * sz, 2.0f * (yz - wx) * sz, (1.0f - 2.0f * (xx + yy)) * sz, 0 } },
+          { { translation->x, translation->y, translation->z, 1.0f } } }
+    };
+    return result;
+}
+
+void ac_mat4_from_trs_n(
+    ac_mat4*       out,
+    const ac_vec3* translations,
+    const ac_quat* rotations,
+    const ac_vec3* scales,
+    size_t         count
+)
+{
+    const ac_vec3 unit = { { 1.0f, 1.0f, 1.0f } };
+    for ( size_t i = 0; i < count; i++ )
+    {
+        const ac_vec3* scale = scales ? &scales[i] : &unit;
+        out[i]               = ac_mat4_from_trs(&translations[i], &rotations[i], scale);
+    }
+}
+
+ac_mat4 ac_mat4_look_at(const ac_vec3* eye, const ac_vec3* target, const ac_vec3* up)
+{
+    // build an orthonormal basis, the view looks down the negative z-axis
+    ac_vec3 forward = ac_vec3_sub(target, eye);
+    forward         = ac_vec3_normalize(&forward);
+    ac_vec3 right   = ac_vec3_cross(&forward, up);
+    right           = ac_vec3_normalize(&right);
+    ac_vec3 true_up = ac_vec3_cross(&right, &forward);
+
+    // the rotation is the transposed basis, followed by the eye position moved into view space
+    float   x      = -ac_vec3_dot(&right, eye);
+    float   y      = -ac_vec3_dot(&true_up, eye);
+    float   z      = ac_vec3_dot(&forward, eye);
+    ac_mat4 result = {
+        { { { right.x, true_up.x, -forward.x, 0.0f } },
+          { { right.y, true_up.y, -forward.y, 0.0f } },
+          { { right.z, true_up.z, -forward.z, 0.0f } },
+          { { x, y, z, 1.0f } } }
+    };
+    return result;
+}
+
+ac_mat4 ac_mat4_perspective(float fov_y, float aspect, float near_plane, float far_plane)
+{
+    float focal_length = 1.0f / tanf(fov_y * 0.5f);
+    float depth        = near_plane - far_plane;
+
+    ac_mat4 result = {
+        { { { focal_length / aspect, 0.0f, 0.0f, 0.0f } },
+          { { 0.0f, focal_length, 0.0f, 0.0f } },
+          { { 0.0f, 0.0f, (far_plane + near_plane) / depth, -1.0f } },
+          { { 0.0f, 0.0f, 2.0f * far_plane * near_plane / depth, 0.0f } } }
+    };
+    return result;
+}
+
+ac_mat4 ac_mat4_mul(const ac_mat4* a, const ac_mat4* b)
+{
+    ac_mat4 result;
+    for ( int column = 0; column < 4; column++ )
+    {
+        const ac_vec4* weights = &b->columns[column];
+        result.columns[column] = combine_columns(a, weights->x, weights->y, weights->z, weights->w);
+    }
+    return result;
+}
+
+ac_vec4 ac_mat4_transform(const ac_mat4* m, const ac_vec4* v)
+{
+    return combine_columns(m, v->x, v->y, v->z, v->w);
+}
+
+ac_vec3 ac_mat4_transform_point(const ac_mat4* m, const ac_vec3* point)
+{
+    ac_vec4 result = combine_columns(m, point->x, point->y, point->z, 1.0f);
+    return ac_vec4_to_vec3(&result);
+}
+
+ac_vec3 ac_mat4_transform_direction(const ac_mat4* m, const ac_vec3* direction)
+{
+    ac_vec4 result = combine_columns(m, direction->x, direction->y, direction->z, 0.0f);
+    return ac_vec4_to_vec3(&result);
+}
+
+void ac_mat4_transform_points_n(
+    ac_vec3* out, const ac_mat4* m, const ac_vec3* points, size_t count
+)
+{
+    for ( size_t i = 0; i < count; i++ )
+    {
+        ac_vec4 result = combine_columns(m, points[i].x, points[i].y, points[i].z, 1.0f);
+        out[i]         = ac_vec4_to_vec3(&result);
+    }
+}
+
+ac_mat4 ac_mat4_transpose(const ac_mat4* m)
+{
+    ac_mat4 result;
+    for ( int column = 0; column < 4; column++ )
+    {
+        for ( int row = 0; row < 4; row++ )
+        {
+            result.data[column * 4 + row] = m->data[row * 4 + column];
+        }
+    }
+    return result;
+}
+
+float ac_mat4_determinant(const ac_mat4* m)
+{
+    float adjugate[16];
+    return adjugate_matrix(m->data, adjugate);
+}
+
+ac_mat4 ac_mat4_inverse(const ac_mat4* m)
+{
+    float   adjugate[16];
+    float   determinant = adjugate_matrix(m->data, adjugate);
+    float   inverse     = determinant == 0.0f ? NAN : 1.0f / determinant;
+    ac_mat4 result;
+    for ( int i = 0; i < 16; i++ )
+    {
+        result.data[i] = adjugate[i] * inverse;
+    }
+    return result;
+}
+
+ac_mat3 ac_mat4_to_mat3(const ac_mat4* m)
+{
+    ac_mat3 result;
+    for ( int column = 0; column < 3; column++ )
+    {
+        result.columns[column] = ac_vec4_to_vec3(&m->columns[column]);
+    }
+    return result;
+}
@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \brief Quaternion functions implementation.
+ */
+#include <ace/math/quat.h>
+#include <math.h>
+
+ac_quat ac_quat_identity(void)
+{
+    return (ac_quat){ 0.0f, 0.0f, 0.0f, 1.0f };
+}
+
+ac_quat ac_quat_from_axis_angle(const ac_vec3* axis, float angle)
+{
+    float s = sinf(angle * 0.5f);
+    return (ac_quat){ axis->x * s, axis->y * s, axis->z * s, cosf(angle * 0.5f) };
+}
+
+ac_quat ac_quat_mul(const ac_quat* a, const ac_quat* b)
+{
+    return (ac_quat){ a->w * b->x + a->x * b->w + a->y * b->z - a->z * b->y,
+                      a->w * b->y - a->x * b->z + a->y * b->w + a->z * b->x,
+                      a->w * b->z + a->x * b->y - a->y * b->x + a->z * b->w,
+                      a->w * b->w - a->x * b->x - a->y * b->y - a->z * b->z };
+}
+
+ac_quat ac_quat_conjugate(const ac_quat* q)
+{
+    return (ac_quat){ -q->x, -q->y, -q->z, q->w };
+}
+
+ac_quat ac_quat_normalize(const ac_quat* q)
+{
+    float length = sqrtf(q->x * q->x + q->y * q->y + q->z * q->z + q->w * q->w);
+    if ( length <= 0.0f )
+    {
+        return ac_quat_identity();
+    }
+    float inverse = 1.0f / length;
+    return (ac_quat){ q->x * inverse, q->y * inverse, q->z * inverse, q->w * inverse };
+}
+
+ac_vec3 ac_quat_rotate(const ac_quat* q, const ac_vec3* v)
+{
+    // v + 2w(u x v) + 2u x (u x v), where u is the vector part
+    ac_vec3 u      = { q->x, q->y, q->z };
+    ac_vec3 t      = ac_vec3_cross(&u, v);
+    t              = ac_vec3_scale(&t, 2.0f);
+    ac_vec3 scaled = ac_vec3_scale(&t, q->w);
+    ac_vec3 twice  = ac_vec3_cross(&u, &t);
+    ac_vec3 result = ac_vec3_add(v, &scaled);
+    return ac_vec3_add(&result, &twice);
+}
+
+ac_quat ac_quat_integrate(const ac_quat* q, const ac_vec3* angular_velocity, float delta_time)
+{
+    ac_quat spin  = { angular_velocity->x, angular_velocity->y, angular_velocity->z, 0.0f };
+    ac_quat delta = ac_quat_mul(&spin, q);
+    float   half  = 0.5f * delta_time;
+    ac_quat next  = { q->x + delta.x * half,
+                      q->y + delta.y * half,
+                      q->z + delta.z * half,
+                      q->w + delta.w * half };
+    return ac_quat_normalize(&next);
+}
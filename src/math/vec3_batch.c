@@ -0,0 +1,272 @@
+/**
+ * \file
+ * \brief Batch 3-component vector functions implementation.
+ * \details
+ * The loops are plain C that the compiler vectorises. Each element is computed with the same
+ * operations in the same order as the single vector functions, so deterministic builds give the
+ * same results either way.
+ */
+#include <ace/math/math.h>
+#include <ace/math/vec3_batch.h>
+#include <math.h>
+
+#include "batch_kernel.h"
+
+// the elementwise functions treat arrays of ac_vec3 as flat arrays of floats
+_Static_assert(sizeof(ac_vec3) == 3 * sizeof(float), "ac_vec3 must be three packed floats");
+
+//--------------------------------------------------------------------------------------------------
+// array of structures
+//--------------------------------------------------------------------------------------------------
+
+AC_BATCH_KERNEL
+void ac_vec3_add_n(ac_vec3* out, const ac_vec3* a, const ac_vec3* b, size_t count)
+{
+    float*       out_data = (float*)out;
+    const float* a_data   = (const float*)a;
+    const float* b_data   = (const float*)b;
+    for ( size_t i = 0; i < count * 3; i++ )
+    {
+        out_data[i] = a_data[i] + b_data[i];
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_vec3_scale_add_n(
+    ac_vec3* out, const ac_vec3* x, float scalar, const ac_vec3* y, size_t count
+)
+{
+    float*       out_data = (float*)out;
+    const float* x_data   = (const float*)x;
+    const float* y_data   = (const float*)y;
+    for ( size_t i = 0; i < count * 3; i++ )
+    {
+        out_data[i] = x_data[i] * scalar + y_data[i];
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_vec3_dot_n(float* out, const ac_vec3* a, const ac_vec3* b, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out[i] = a[i].x * b[i].x + a[i].y * b[i].y + a[i].z * b[i].z;
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_vec3_length_sq_n(float* out, const ac_vec3* v, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out[i] = v[i].x * v[i].x + v[i].y * v[i].y + v[i].z * v[i].z;
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_vec3_normalize_n(ac_vec3* out, const ac_vec3* v, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+    {
+        float x         = v[i].x;
+        float y         = v[i].y;
+        float z         = v[i].z;
+        float magnitude = sqrtf(x * x + y * y + z * z);
+        // divide unconditionally and select the result so that the loop has no branches
+        float inv_magnitude = 1.0f / magnitude;
+        inv_magnitude       = magnitude <= AC_EPSILON ? NAN : inv_magnitude;
+        out[i].x            = x * inv_magnitude;
+        out[i].y            = y * inv_magnitude;
+        out[i].z            = z * inv_magnitude;
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_vec3_lerp_n(
+    ac_vec3* out, const ac_vec3* a, const ac_vec3* b, float interpolation_factor, size_t count
+)
+{
+    float        t        = ac_clamp(interpolation_factor, 0.0f, 1.0f);
+    float*       out_data = (float*)out;
+    const float* a_data   = (const float*)a;
+    const float* b_data   = (const float*)b;
+    for ( size_t i = 0; i < count * 3; i++ )
+    {
+        out_data[i] = a_data[i] + (b_data[i] - a_data[i]) * t;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// structure of arrays
+//--------------------------------------------------------------------------------------------------
+
+AC_BATCH_KERNEL
+void ac_vec3_soa_add_n(
+    const ac_vec3_soa* out, const ac_vec3_soa* a, const ac_vec3_soa* b, size_t count
+)
+{
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out->x[i] = a->x[i] + b->x[i];
+    }
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out->y[i] = a->y[i] + b->y[i];
+    }
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out->z[i] = a->z[i] + b->z[i];
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_vec3_soa_scale_add_n(
+    const ac_vec3_soa* out, const ac_vec3_soa* x, float scalar, const ac_vec3_soa* y, size_t count
+)
+{
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out->x[i] = x->x[i] * scalar + y->x[i];
+    }
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out->y[i] = x->y[i] * scalar + y->y[i];
+    }
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out->z[i] = x->z[i] * scalar + y->z[i];
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_vec3_soa_dot_n(float* out, const ac_vec3_soa* a, const ac_vec3_soa* b, size_t count)
+{
+    const float* ax = a->x;
+    const float* ay = a->y;
+    const float* az = a->z;
+    const float* bx = b->x;
+    const float* by = b->y;
+    const float* bz = b->z;
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out[i] = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_vec3_soa_length_sq_n(float* out, const ac_vec3_soa* v, size_t count)
+{
+    const float* vx = v->x;
+    const float* vy = v->y;
+    const float* vz = v->z;
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out[i] = vx[i] * vx[i] + vy[i] * vy[i] + vz[i] * vz[i];
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_vec3_soa_normalize_n(const ac_vec3_soa* out, const ac_vec3_soa* v, size_t count)
+{
+    float*       ox = out->x;
+    float*       oy = out->y;
+    float*       oz = out->z;
+    const float* vx = v->x;
+    const float* vy = v->y;
+    const float* vz = v->z;
+    for ( size_t i = 0; i < count; i++ )
+    {
+        float x             = vx[i];
+        float y             = vy[i];
+        float z             = vz[i];
+        float magnitude     = sqrtf(x * x + y * y + z * z);
+        float inv_magnitude = 1.0f / magnitude;
+        inv_magnitude       = magnitude <= AC_EPSILON ? NAN : inv_magnitude;
+        ox[i]               = x * inv_magnitude;
+        oy[i]               = y * inv_magnitude;
+        oz[i]               = z * inv_magnitude;
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_vec3_soa_lerp_n(
+    const ac_vec3_soa* out,
+    const ac_vec3_soa* a,
+    const ac_vec3_soa* b,
+    float              interpolation_factor,
+    size_t             count
+)
+{
+    float t = ac_clamp(interpolation_factor, 0.0f, 1.0f);
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out->x[i] = a->x[i] + (b->x[i] - a->x[i]) * t;
+    }
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out->y[i] = a->y[i] + (b->y[i] - a->y[i]) * t;
+    }
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out->z[i] = a->z[i] + (b->z[i] - a->z[i]) * t;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// int
+//--------------------------------------------------------------------------------------------------
+
+AC_BATCH_KERNEL
+void ac_ivec3_add_n(ac_ivec3* out, const ac_ivec3* a, const ac_ivec3* b, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+    {
+        int64_t x       = (int64_t) a[i].x + b[i].x;
+        int64_t y       = (int64_t) a[i].y + b[i].y;
+        int64_t z       = (int64_t) a[i].z + b[i].z;
+        bool    invalid = (a[i].x == INT_INVALID) | (a[i].y == INT_INVALID)
+                     | (a[i].z == INT_INVALID) | (b[i].x == INT_INVALID)
+                     | (b[i].y == INT_INVALID) | (b[i].z == INT_INVALID) | (x < -INT_MAX)
+                     | (x > INT_MAX) | (y < -INT_MAX) | (y > INT_MAX) | (z < -INT_MAX)
+                     | (z > INT_MAX);
+        out[i].x = invalid ? INT_INVALID : (int) x;
+        out[i].y = invalid ? INT_INVALID : (int) y;
+        out[i].z = invalid ? INT_INVALID : (int) z;
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_ivec3_sub_n(ac_ivec3* out, const ac_ivec3* a, const ac_ivec3* b, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+    {
+        int64_t x       = (int64_t) a[i].x - b[i].x;
+        int64_t y       = (int64_t) a[i].y - b[i].y;
+        int64_t z       = (int64_t) a[i].z - b[i].z;
+        bool    invalid = (a[i].x == INT_INVALID) | (a[i].y == INT_INVALID)
+                     | (a[i].z == INT_INVALID) | (b[i].x == INT_INVALID)
+                     | (b[i].y == INT_INVALID) | (b[i].z == INT_INVALID) | (x < -INT_MAX)
+                     | (x > INT_MAX) | (y < -INT_MAX) | (y > INT_MAX) | (z < -INT_MAX)
+                     | (z > INT_MAX);
+        out[i].x = invalid ? INT_INVALID : (int) x;
+        out[i].y = invalid ? INT_INVALID : (int) y;
+        out[i].z = invalid ? INT_INVALID : (int) z;
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_ivec3_scale_n(ac_ivec3* out, const ac_ivec3* v, int scalar, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+    {
+        int64_t x       = (int64_t) v[i].x * scalar;
+        int64_t y       = (int64_t) v[i].y * scalar;
+        int64_t z       = (int64_t) v[i].z * scalar;
+        bool    invalid = (v[i].x == INT_INVALID) | (v[i].y == INT_INVALID)
+                     | (v[i].z == INT_INVALID) | (x < -INT_MAX) | (x > INT_MAX) | (y < -INT_MAX)
+                     | (y > INT_MAX) | (z < -INT_MAX) | (z > INT_MAX);
+        out[i].x = invalid ? INT_INVALID : (int) x;
+        out[i].y = invalid ? INT_INVALID : (int) y;
+        out[i].z = invalid ? INT_INVALID : (int) z;
+    }
+}
@@ -2,6 +2,8 @@
 #include <ace/math/vec3_ext.h>
 #include <math.h>
 
+#include "core/debug.h"
+
 float ac_vec3_angle(const ac_vec3* a, const ac_vec3* b)
 {
     // guard against NaN vectors
@@ -16,6 +18,14 @@ float ac_vec3_angle(const ac_vec3* a, const ac_vec3* b)
         return NAN;
     }
 
+    return ac_vec3_angle_unchecked(a, b);
+}
+
+float ac_vec3_angle_unchecked(const ac_vec3* a, const ac_vec3* b)
+{
+    AC_DEBUG_CHECK(!ac_vec3_is_nan(a) && !ac_vec3_is_zero(a));
+    AC_DEBUG_CHECK(!ac_vec3_is_nan(b) && !ac_vec3_is_zero(b));
+
     // the dot product can be defined as: dot = |a| * |b| * cos(theta)
     // therefore, theta = acos(dot / (|a| * |b|))
     float dot  = ac_vec3_dot(a, b);
@@ -55,6 +65,14 @@ ac_vec3 ac_vec3_project(const ac_vec3* a, const ac_vec3* b)
         return ac_vec3_nan();
     }
 
+    return ac_vec3_project_unchecked(a, b);
+}
+
+ac_vec3 ac_vec3_project_unchecked(const ac_vec3* a, const ac_vec3* b)
+{
+    AC_DEBUG_CHECK(!ac_vec3_is_nan(a) && !ac_vec3_is_zero(a));
+    AC_DEBUG_CHECK(!ac_vec3_is_nan(b) && !ac_vec3_is_zero(b));
+
     // the projection can be derived by calculating the dot product of a and b
     // and then scaling b by the dot product divided by the magnitude of b squared
     // projection = (a . b) / |b|^2 * b
@@ -85,11 +103,20 @@ ac_vec3 ac_vec3_reflect(const ac_vec3* incoming, const ac_vec3* normal)
         return ac_vec3_nan();
     }
 
+    return ac_vec3_reflect_unchecked(incoming, &n_normalized);
+}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+ac_vec3 ac_vec3_reflect_unchecked(const ac_vec3* incoming, const ac_vec3* normal)
+{
+    AC_DEBUG_CHECK(!ac_vec3_is_nan(incoming) && !ac_vec3_is_zero(incoming));
+    AC_DEBUG_CHECK(fabsf(ac_vec3_dot(normal, normal) - 1.0f) <= 1e-4f);
+
     // the projection modifier is used to scale the projection of v onto n
     static const float projection_modifier = 2.0f;
 
     // calculate the projection of v onto n
-    float   projection = ac_vec3_dot(incoming, &n_normalized);
-    ac_vec3 scaled_n   = ac_vec3_scale(&n_normalized, projection_modifier * projection);
+    float   projection = ac_vec3_dot(incoming, normal);
+    ac_vec3 scaled_n   = ac_vec3_scale(normal, projection_modifier * projection);
     return ac_vec3_sub(incoming, &scaled_n);
 }
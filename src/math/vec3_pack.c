@@ -0,0 +1,309 @@
+/**
+ * \file
+ * \brief Packed vector storage formats implementation.
+ * \details
+ * Each format converts one component or vector in a static inline function with no branches,
+ * which the single vector functions and the batch loops share, so the compiler can vectorise the
+ * loops and both give the same results.
+ */
+#include <ace/math/vec3_pack.h>
+#include <math.h>
+#include <string.h>
+
+#include "batch_kernel.h"
+
+_Static_assert(sizeof(ac_half_vec3) == 6, "ac_half_vec3 must be three packed halves");
+_Static_assert(sizeof(ac_unorm16_vec3) == 6, "ac_unorm16_vec3 must be three packed words");
+_Static_assert(sizeof(ac_oct_normal) == 4, "ac_oct_normal must be two packed words");
+
+static inline uint32_t float_bits(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline float bits_float(uint32_t bits)
+{
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+//--------------------------------------------------------------------------------------------------
+// half-precision
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \brief Converts a float to half-precision, rounding to nearest even.
+ * \param[in] value The float.
+ * \return The half-precision bits.
+ * \details
+ * All three cases are computed and the result selected, so that the batch loops have no branches.
+ */
+static inline uint16_t float_to_half(float value)
+{
+    uint32_t bits      = float_bits(value);
+    uint32_t sign      = (bits >> 16) & 0x8000u;
+    uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+    // infinity and NaN, which keeps a quiet NaN, and finite values too large for a half
+    uint32_t overflow = magnitude > 0x7F800000u ? 0x7E00u : 0x7C00u;
+
+    // a half subnormal, adding the magic value aligns the ten fraction bits at the bottom of the
+    // float and rounds them with the hardware rounding
+    const uint32_t subnormal_magic = 126u << 23;
+    uint32_t       subnormal =
+        float_bits(bits_float(magnitude) + bits_float(subnormal_magic)) - subnormal_magic;
+
+    // a normal half, rebias the exponent and round the thirteen dropped bits to nearest even
+    uint32_t odd    = (magnitude >> 13) & 1u;
+    uint32_t normal = (magnitude + ((uint32_t) (15 - 127) << 23) + 0xFFFu + odd) >> 13;
+
+    uint32_t half = magnitude < 0x38800000u ? subnormal : normal;
+    half          = magnitude >= 0x47800000u ? overflow : half;
+    return (uint16_t) (half | sign);
+}
+
+/**
+ * \brief Converts half-precision to a float, which is exact.
+ * \param[in] half The half-precision bits.
+ * \return The float.
+ */
+static inline float half_to_float(uint16_t half)
+{
+    const uint32_t exponent_mask = 0x7C00u << 13;
+    uint32_t       bits          = ((uint32_t) half & 0x7FFFu) << 13;
+    uint32_t       exponent      = bits & exponent_mask;
+    uint32_t       rebiased      = bits + ((uint32_t) (127 - 15) << 23);
+
+    // infinity and NaN take the largest exponent, subnormals and zero are renormalised by
+    // subtracting the value of the implied bit
+    const float subnormal_magic = bits_float(113u << 23);
+    uint32_t    special         = rebiased + ((uint32_t) (128 - 16) << 23);
+    uint32_t    subnormal       = float_bits(bits_float(rebiased + (1u << 23)) - subnormal_magic);
+
+    uint32_t result = exponent == exponent_mask ? special : rebiased;
+    result          = exponent == 0 ? subnormal : result;
+    return bits_float(result | (((uint32_t) half & 0x8000u) << 16));
+}
+
+uint16_t ac_float_to_half(float value)
+{
+    return float_to_half(value);
+}
+
+float ac_half_to_float(uint16_t half)
+{
+    return half_to_float(half);
+}
+
+ac_half_vec3 ac_half_vec3_from_vec3(const ac_vec3* v)
+{
+    ac_half_vec3 result;
+    for ( int i = 0; i < 3; i++ )
+    {
+        result.data[i] = float_to_half(v->data[i]);
+    }
+    return result;
+}
+
+ac_vec3 ac_half_vec3_to_vec3(const ac_half_vec3* v)
+{
+    ac_vec3 result;
+    for ( int i = 0; i < 3; i++ )
+    {
+        result.data[i] = half_to_float(v->data[i]);
+    }
+    return result;
+}
+
+AC_BATCH_KERNEL
+void ac_half_vec3_from_vec3_n(ac_half_vec3* out, const ac_vec3* v, size_t count)
+{
+    // both arrays are flat arrays of components
+    uint16_t*    out_data = (uint16_t*) out;
+    const float* v_data   = (const float*) v;
+    for ( size_t i = 0; i < count * 3; i++ )
+    {
+        out_data[i] = float_to_half(v_data[i]);
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_half_vec3_to_vec3_n(ac_vec3* out, const ac_half_vec3* v, size_t count)
+{
+    float*          out_data = (float*) out;
+    const uint16_t* v_data   = (const uint16_t*) v;
+    for ( size_t i = 0; i < count * 3; i++ )
+    {
+        out_data[i] = half_to_float(v_data[i]);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// bounded 16-bit
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \brief Encodes a fraction of the unit range as a 16-bit integer.
+ * \param[in] steps The fraction multiplied by 65535.
+ * \return The nearest step, clamped to [0, 65535] with NaN as 0.
+ */
+static inline uint16_t encode_unorm16(float steps)
+{
+    steps = steps > 0.0f ? steps : 0.0f;
+    steps = steps < 65535.0f ? steps : 65535.0f;
+    return (uint16_t) (int) (steps + 0.5f);
+}
+
+ac_unorm16_vec3 ac_unorm16_vec3_from_vec3(const ac_vec3* v, const ac_vec3* min, const ac_vec3* max)
+{
+    ac_unorm16_vec3 result;
+    for ( int i = 0; i < 3; i++ )
+    {
+        float scale    = 65535.0f / (max->data[i] - min->data[i]);
+        result.data[i] = encode_unorm16((v->data[i] - min->data[i]) * scale);
+    }
+    return result;
+}
+
+ac_vec3 ac_unorm16_vec3_to_vec3(const ac_unorm16_vec3* v, const ac_vec3* min, const ac_vec3* max)
+{
+    ac_vec3 result;
+    for ( int i = 0; i < 3; i++ )
+    {
+        float step     = (max->data[i] - min->data[i]) / 65535.0f;
+        result.data[i] = min->data[i] + (float) v->data[i] * step;
+    }
+    return result;
+}
+
+AC_BATCH_KERNEL
+void ac_unorm16_vec3_from_vec3_n(
+    ac_unorm16_vec3* out, const ac_vec3* v, const ac_vec3* min, const ac_vec3* max, size_t count
+)
+{
+    float scale[3];
+    for ( int i = 0; i < 3; i++ )
+    {
+        scale[i] = 65535.0f / (max->data[i] - min->data[i]);
+    }
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out[i].x = encode_unorm16((v[i].x - min->x) * scale[0]);
+        out[i].y = encode_unorm16((v[i].y - min->y) * scale[1]);
+        out[i].z = encode_unorm16((v[i].z - min->z) * scale[2]);
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_unorm16_vec3_to_vec3_n(
+    ac_vec3* out, const ac_unorm16_vec3* v, const ac_vec3* min, const ac_vec3* max, size_t count
+)
+{
+    float step[3];
+    for ( int i = 0; i < 3; i++ )
+    {
+        step[i] = (max->data[i] - min->data[i]) / 65535.0f;
+    }
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out[i].x = min->x + (float) v[i].x * step[0];
+        out[i].y = min->y + (float) v[i].y * step[1];
+        out[i].z = min->z + (float) v[i].z * step[2];
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// octahedral
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \brief Encodes a coordinate in [-1, 1] as a signed 16-bit integer.
+ * \param[in] value The coordinate.
+ * \return The nearest step of 1/32767.
+ */
+static inline int16_t encode_snorm16(float value)
+{
+    float steps = value * 32767.0f;
+    steps       = steps > -32767.0f ? steps : -32767.0f;
+    steps       = steps < 32767.0f ? steps : 32767.0f;
+    return (int16_t) (int) (steps + (steps < 0.0f ? -0.5f : 0.5f));
+}
+
+/**
+ * \brief Encodes a vector with octahedral coordinates.
+ * \param[in] x The x component.
+ * \param[in] y The y component.
+ * \param[in] z The z component.
+ * \param[out] out The encoded vector.
+ */
+static inline void encode_oct(float x, float y, float z, ac_oct_normal* out)
+{
+    // project onto the octahedron |x| + |y| + |z| = 1, a zero or NaN vector projects to the origin
+    // of the upper half, which is { 0, 0, 1 }
+    float sum     = fabsf(x) + fabsf(y) + fabsf(z);
+    bool  valid   = sum > 0.0f;
+    float inverse = 1.0f / (valid ? sum : 1.0f);
+    float u       = valid ? x * inverse : 0.0f;
+    float v       = valid ? y * inverse : 0.0f;
+
+    // fold the lower half over the diagonals onto the outer triangles of the square
+    float folded_u = (1.0f - fabsf(v)) * (u < 0.0f ? -1.0f : 1.0f);
+    float folded_v = (1.0f - fabsf(u)) * (v < 0.0f ? -1.0f : 1.0f);
+    bool  lower    = valid && z < 0.0f;
+    out->x         = encode_snorm16(lower ? folded_u : u);
+    out->y         = encode_snorm16(lower ? folded_v : v);
+}
+
+/**
+ * \brief Decodes a vector stored with octahedral coordinates.
+ * \param[in] n The encoded vector.
+ * \return The unit vector.
+ */
+static inline ac_vec3 decode_oct(const ac_oct_normal* n)
+{
+    float x = (float) n->x * (1.0f / 32767.0f);
+    float y = (float) n->y * (1.0f / 32767.0f);
+    float z = 1.0f - fabsf(x) - fabsf(y);
+
+    // unfold the outer triangles back onto the lower half
+    float t = z < 0.0f ? -z : 0.0f;
+    x       = x + (x < 0.0f ? t : -t);
+    y       = y + (y < 0.0f ? t : -t);
+
+    float   inverse = 1.0f / sqrtf(x * x + y * y + z * z);
+    ac_vec3 result  = { { x * inverse, y * inverse, z * inverse } };
+    return result;
+}
+
+ac_oct_normal ac_oct_normal_from_vec3(const ac_vec3* n)
+{
+    ac_oct_normal result;
+    encode_oct(n->x, n->y, n->z, &result);
+    return result;
+}
+
+ac_vec3 ac_oct_normal_to_vec3(const ac_oct_normal* n)
+{
+    return decode_oct(n);
+}
+
+AC_BATCH_KERNEL
+void ac_oct_normal_from_vec3_n(ac_oct_normal* out, const ac_vec3* n, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+    {
+        encode_oct(n[i].x, n[i].y, n[i].z, &out[i]);
+    }
+}
+
+AC_BATCH_KERNEL
+void ac_oct_normal_to_vec3_n(ac_vec3* out, const ac_oct_normal* n, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+    {
+        out[i] = decode_oct(&n[i]);
+    }
+}
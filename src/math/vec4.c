@@ -0,0 +1,10 @@
+/**
+ * \file
+ * \brief Aligned 4-component vector types and functions implementation.
+ * \details
+ * The definitions are shared with the static inline mode in vec4.inl and are compiled here as
+ * ordinary functions, in the same way as vec3.c.
+ */
+#undef AC_MATH_INLINE
+#include <ace/math/vec4.h>
+#include <ace/math/vec4.inl>
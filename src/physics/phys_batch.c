@@ -0,0 +1,324 @@
+/**
+ * \file
+ * \brief Implements parallel stepping of independent physics worlds.
+ */
+#include <ace/physics/phys_batch.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef __STDC_NO_THREADS__
+    #include <threads.h>
+#endif
+
+#ifdef AC_PLATFORM_WINDOWS
+    #include <malloc.h>
+#endif
+
+#define AC_PHYS_BATCH_ALIGNMENT 64  // cache line size, keeps neighbouring worlds apart
+
+//--------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \brief The work a batch performs on each worker's partition of worlds.
+ */
+typedef enum PhysBatchJobType
+{
+    phys_batch_job_step,
+    phys_batch_job_clone
+} PhysBatchJobType;
+
+typedef struct PhysBatchJob
+{
+    PhysBatchJobType type;
+    PhysWorld*       worlds;
+    const PhysWorld* source;
+    unsigned         numWorlds;
+    unsigned         numSteps;
+} PhysBatchJob;
+
+typedef struct PhysBatchWorker
+{
+    struct PhysBatch* batch;
+    unsigned          index;
+#ifndef __STDC_NO_THREADS__
+    thrd_t thread;
+#endif
+} PhysBatchWorker;
+
+struct PhysBatch
+{
+    unsigned         numThreads;  // includes the calling thread
+    PhysBatchWorker* workers;     // numThreads - 1 background workers
+    PhysBatchJob     job;
+#ifndef __STDC_NO_THREADS__
+    mtx_t    lock;
+    cnd_t    workReady;
+    cnd_t    workDone;
+    unsigned generation;  // incremented for each job so workers can detect new work
+    unsigned pending;     // background workers yet to finish the current job
+    bool     shutdown;
+#endif
+};
+
+//--------------------------------------------------------------------------------------------------
+// Helpers
+//--------------------------------------------------------------------------------------------------
+
+static double batch_time_seconds(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+static void batch_run_partition(const PhysBatchJob* job, unsigned index, unsigned numThreads)
+{
+    // static partitioning keeps each world on the same worker across calls
+    unsigned begin = (unsigned) ((unsigned long long) job->numWorlds * index / numThreads);
+    unsigned end   = (unsigned) ((unsigned long long) job->numWorlds * (index + 1) / numThreads);
+
+    switch ( job->type )
+    {
+    case phys_batch_job_step:
+        for ( unsigned i = begin; i < end; i++ )
+        {
+            for ( unsigned step = 0; step < job->numSteps; step++ )
+            {
+                phys_step(&job->worlds[i]);
+            }
+        }
+        break;
+    case phys_batch_job_clone:
+        for ( unsigned i = begin; i < end; i++ )
+        {
+            memcpy(&job->worlds[i], job->source, sizeof(PhysWorld));
+            job->worlds[i].userData = NULL;  // the clones must not share the source's state
+        }
+        break;
+    }
+}
+
+#ifndef __STDC_NO_THREADS__
+static int batch_worker_main(void* arg)
+{
+    PhysBatchWorker* worker = (PhysBatchWorker*) arg;
+    PhysBatch*       batch  = worker->batch;
+    unsigned         seen   = 0;
+
+    for ( ;; )
+    {
+        mtx_lock(&batch->lock);
+        while ( batch->generation == seen && !batch->shutdown )
+        {
+            cnd_wait(&batch->workReady, &batch->lock);
+        }
+        if ( batch->shutdown )
+        {
+            mtx_unlock(&batch->lock);
+            return 0;
+        }
+        seen             = batch->generation;
+        PhysBatchJob job = batch->job;
+        mtx_unlock(&batch->lock);
+
+        batch_run_partition(&job, worker->index, batch->numThreads);
+
+        mtx_lock(&batch->lock);
+        if ( --batch->pending == 0 )
+        {
+            cnd_signal(&batch->workDone);
+        }
+        mtx_unlock(&batch->lock);
+    }
+}
+#endif
+
+static void batch_run(PhysBatch* batch, const PhysBatchJob* job)
+{
+#ifndef __STDC_NO_THREADS__
+    if ( batch->numThreads > 1 )
+    {
+        mtx_lock(&batch->lock);
+        batch->job     = *job;
+        batch->pending = batch->numThreads - 1;
+        batch->generation++;
+        cnd_broadcast(&batch->workReady);
+        mtx_unlock(&batch->lock);
+
+        // the calling thread always takes the first partition
+        batch_run_partition(job, 0, batch->numThreads);
+
+        mtx_lock(&batch->lock);
+        while ( batch->pending > 0 )
+        {
+            cnd_wait(&batch->workDone, &batch->lock);
+        }
+        mtx_unlock(&batch->lock);
+        return;
+    }
+#endif
+    batch_run_partition(job, 0, 1);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Public Functions
+//--------------------------------------------------------------------------------------------------
+
+PhysBatch* phys_batch_create(unsigned numThreads)
+{
+    PhysBatch* batch = (PhysBatch*) calloc(1, sizeof(PhysBatch));
+    if ( batch == NULL )
+    {
+        return NULL;
+    }
+    batch->numThreads = 1;
+
+#ifndef __STDC_NO_THREADS__
+    if ( numThreads <= 1 )
+    {
+        return batch;
+    }
+
+    batch->workers = (PhysBatchWorker*) calloc(numThreads - 1, sizeof(PhysBatchWorker));
+    if ( batch->workers == NULL )
+    {
+        return batch;
+    }
+
+    bool lockReady = mtx_init(&batch->lock, mtx_plain) == thrd_success;
+    bool workReady = lockReady && cnd_init(&batch->workReady) == thrd_success;
+    bool doneReady = workReady && cnd_init(&batch->workDone) == thrd_success;
+    if ( !doneReady )
+    {
+        if ( workReady )
+        {
+            cnd_destroy(&batch->workReady);
+        }
+        if ( lockReady )
+        {
+            mtx_destroy(&batch->lock);
+        }
+        free(batch->workers);
+        free(batch);
+        return NULL;
+    }
+
+    // spawn the background workers, falling back to fewer threads if creation fails
+    unsigned spawned = 0;
+    for ( unsigned i = 0; i < numThreads - 1; i++ )
+    {
+        PhysBatchWorker* worker = &batch->workers[i];
+        worker->batch           = batch;
+        worker->index           = i + 1;
+        if ( thrd_create(&worker->thread, batch_worker_main, worker) != thrd_success )
+        {
+            break;
+        }
+        spawned++;
+    }
+    batch->numThreads = spawned + 1;
+#else
+    (void) numThreads;
+#endif
+
+    return batch;
+}
+
+void phys_batch_destroy(PhysBatch* batch)
+{
+    if ( batch == NULL )
+    {
+        return;
+    }
+
+#ifndef __STDC_NO_THREADS__
+    if ( batch->workers != NULL )
+    {
+        mtx_lock(&batch->lock);
+        batch->shutdown = true;
+        cnd_broadcast(&batch->workReady);
+        mtx_unlock(&batch->lock);
+
+        for ( unsigned i = 0; i < batch->numThreads - 1; i++ )
+        {
+            thrd_join(batch->workers[i].thread, NULL);
+        }
+
+        cnd_destroy(&batch->workDone);
+        cnd_destroy(&batch->workReady);
+        mtx_destroy(&batch->lock);
+        free(batch->workers);
+    }
+#endif
+
+    free(batch);
+}
+
+unsigned phys_batch_num_threads(const PhysBatch* batch)
+{
+    return batch->numThreads;
+}
+
+PhysWorld* phys_batch_clone_worlds(PhysBatch* batch, const PhysWorld* source, unsigned numWorlds)
+{
+    if ( numWorlds == 0 )
+    {
+        return NULL;
+    }
+
+    // aligned_alloc requires the size to be a multiple of the alignment
+    size_t size = (size_t) numWorlds * sizeof(PhysWorld);
+    size        = (size + AC_PHYS_BATCH_ALIGNMENT - 1) & ~(size_t) (AC_PHYS_BATCH_ALIGNMENT - 1);
+
+#ifdef AC_PLATFORM_WINDOWS
+    PhysWorld* worlds = (PhysWorld*) _aligned_malloc(size, AC_PHYS_BATCH_ALIGNMENT);
+#else
+    PhysWorld* worlds = (PhysWorld*) aligned_alloc(AC_PHYS_BATCH_ALIGNMENT, size);
+#endif
+    if ( worlds == NULL )
+    {
+        return NULL;
+    }
+
+    // the copy is the first write to the memory, so each worker touches the worlds it will step
+    PhysBatchJob job = { .type      = phys_batch_job_clone,
+                         .worlds    = worlds,
+                         .source    = source,
+                         .numWorlds = numWorlds,
+                         .numSteps  = 0 };
+    batch_run(batch, &job);
+    return worlds;
+}
+
+void phys_batch_free_worlds(PhysWorld* worlds)
+{
+#ifdef AC_PLATFORM_WINDOWS
+    _aligned_free(worlds);
+#else
+    free(worlds);
+#endif
+}
+
+PhysBatchStats phys_batch_step(
+    PhysBatch* batch, PhysWorld* worlds, unsigned numWorlds, unsigned numSteps
+)
+{
+    PhysBatchJob job = { .type      = phys_batch_job_step,
+                         .worlds    = worlds,
+                         .source    = NULL,
+                         .numWorlds = numWorlds,
+                         .numSteps  = numSteps };
+
+    double start = batch_time_seconds();
+    batch_run(batch, &job);
+    double elapsed = batch_time_seconds() - start;
+
+    PhysBatchStats stats;
+    stats.worldSteps          = (unsigned long long) numWorlds * numSteps;
+    stats.seconds             = elapsed;
+    stats.worldStepsPerSecond = elapsed > 0.0 ? (double) stats.worldSteps / elapsed : 0.0;
+    return stats;
+}
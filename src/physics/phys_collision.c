@@ -3,19 +3,28 @@
  * \author Blake Caldwell
  * \brief Implements collision detection and resolution.
  */
+#include <ace/geometry/convex.h>
+#include <ace/math/math.h>
 #include <ace/math/vec2.h>
 #include <ace/physics/phys_collision.h>
 #include <math.h>
+#include <stddef.h>
+
+#include "core/debug.h"
 
 typedef IntersectionResult (*collision_detection_func)(
     const Collider* c1, const ac_vec3* p1, const Collider* c2, const ac_vec3* p2
 );
 
-static const collision_detection_func collisionDetectionFunctions[2][2] = {
+static const collision_detection_func collisionDetectionFunctions[6][6] = {
     // 3hrs of my life was spent on finding that this indexing was wrong
-    // SPHERE_C, AABB_C
-    { sphere_sphere, sphere_AABB }, // SPHERE_C
-    {   AABB_sphere,        NULL }  // AABB_C
+    // SPHERE_C, AABB_C, MESH_C, HEIGHTFIELD_C, CONVEX_C, PLANE_C
+    { sphere_sphere, sphere_AABB, sphere_mesh, sphere_heightfield, convex_convex, sphere_plane },
+    { AABB_sphere, AABB_AABB, NULL, NULL, convex_convex, AABB_plane },
+    { mesh_sphere, NULL, NULL, NULL, NULL, NULL },
+    { heightfield_sphere, NULL, NULL, NULL, NULL, NULL },
+    { convex_convex, convex_convex, NULL, NULL, convex_convex, NULL },
+    { plane_sphere, plane_AABB, NULL, NULL, NULL, NULL }
 };
 
 IntersectionResult check_collision(Collider* c1, ac_vec3* const p1, Collider* c2, ac_vec3* const p2)
@@ -25,24 +34,279 @@ IntersectionResult check_collision(Collider* c1, ac_vec3* const p1, Collider* c2
     {
         // no collision detection function exists
         return (IntersectionResult){ .intersected      = false,
-                                     .contactNormal    = ac_vec3_nan(),
+                                     .contactNormal    = AC_VEC3_NAN,
                                      .penetrationDepth = NAN,
-                                     .contactPoint     = ac_vec3_nan() };
+                                     .contactPoint     = AC_VEC3_NAN };
     }
 
     return func(c1, p1, c2, p2);
 }
 
+IntersectionResult check_collision_cached(
+    Collider* c1, ac_vec3* const p1, Collider* c2, ac_vec3* const p2, ConvexCache* cache
+)
+{
+    if ( cache == NULL || (c1->type != CONVEX_C && c2->type != CONVEX_C)
+         || collisionDetectionFunctions[c1->type][c2->type] != convex_convex )
+    {
+        return check_collision(c1, p1, c2, p2);
+    }
+    return convex_intersect(c1, p1, c2, p2, cache);
+}
+
+bool uses_contact_manifold(const Collider* c1, const Collider* c2)
+{
+    if ( c1->type == AABB_C )
+    {
+        return c2->type == AABB_C || c2->type == PLANE_C;
+    }
+    return c1->type == PLANE_C && c2->type == AABB_C;
+}
+
+bool check_manifold(
+    Collider* c1, ac_vec3* const p1, Collider* c2, ac_vec3* const p2, ContactManifold* manifold
+)
+{
+    static const ac_vec3 axes[3] = {
+        { { 1.0f, 0.0f, 0.0f } },
+        { { 0.0f, 1.0f, 0.0f } },
+        { { 0.0f, 0.0f, 1.0f } }
+    };
+
+    manifold->numPoints = 0;
+    if ( !uses_contact_manifold(c1, c2) )
+    {
+        return false;
+    }
+
+    if ( c1->type == PLANE_C )
+    {
+        AABB*  box   = (AABB*) c2->data;
+        Plane* plane = (Plane*) c1->data;
+        bool   hit   = box_plane_manifold(
+            p2, axes, &box->half_extents, p1, &plane->normal, manifold
+        );
+        manifold->normal = ac_vec3_negate(&manifold->normal);
+        return hit;
+    }
+
+    AABB* box = (AABB*) c1->data;
+    if ( c2->type == PLANE_C )
+    {
+        Plane* plane = (Plane*) c2->data;
+        return box_plane_manifold(p1, axes, &box->half_extents, p2, &plane->normal, manifold);
+    }
+    AABB* other = (AABB*) c2->data;
+    return box_box_manifold(p1, axes, &box->half_extents, p2, axes, &other->half_extents, manifold);
+}
+
+IntersectionResult sphere_baked_sphere(
+    const ac_vec3* p1, float radius, const PhysBakedStatic* baked
+)
+{
+    // mirrors sphere_sphere without reading the colliders
+    IntersectionResult ret;
+    float              radii   = radius + baked->halfExtents.x;
+    ac_vec3            diffVec = ac_vec3_sub(p1, &baked->center);
+    float              dist    = ac_vec3_magnitude(&diffVec);
+
+    ret.intersected = radii > dist;
+    if ( ret.intersected )
+    {
+        ret.contactNormal    = ac_vec3_sub(&baked->center, p1);
+        ret.contactNormal    = ac_vec3_normalize(&ret.contactNormal);
+        ret.penetrationDepth = radii - dist;
+
+        ret.contactPoint =
+            ac_vec3_scale(&ret.contactNormal, radius - ret.penetrationDepth * 0.5f);
+        ret.contactPoint = ac_vec3_add(&ret.contactPoint, p1);
+    }
+    return ret;
+}
+
+IntersectionResult sphere_baked_AABB(const ac_vec3* p1, float radius, const PhysBakedStatic* baked)
+{
+    // mirrors sphere_AABB without reading the colliders
+    IntersectionResult ret;
+    ac_vec3            closestPoint;
+    for ( int i = 0; i < 3; i++ )
+    {
+        float min            = baked->center.data[i] - baked->halfExtents.data[i];
+        float max            = baked->center.data[i] + baked->halfExtents.data[i];
+        closestPoint.data[i] = ac_clamp(p1->data[i], min, max);
+    }
+
+    ac_vec3 diffVec     = ac_vec3_sub(&closestPoint, p1);
+    float   distSquared = ac_vec3_dot(&diffVec, &diffVec);
+
+    ret.intersected = (distSquared <= radius * radius);
+    if ( ret.intersected )
+    {
+        float dist           = sqrtf(distSquared);
+        ret.contactNormal    = ac_vec3_scale(&diffVec, 1.0f / dist);
+        ret.penetrationDepth = radius - dist;
+        ret.contactPoint     = ac_vec3_scale(&ret.contactNormal, ret.penetrationDepth);
+        ret.contactPoint     = ac_vec3_add(&ret.contactPoint, &closestPoint);
+    }
+    return ret;
+}
+
+ac_vec3 apply_inverse_inertia(const PhysContactBody* body, const ac_vec3* v)
+{
+    if ( body->isStatic )
+    {
+        return AC_VEC3_ZERO;
+    }
+
+    // the tensor is diagonal in body space, so rotate into it and back out
+    ac_quat inverse = ac_quat_conjugate(body->orientation);
+    ac_vec3 local   = ac_quat_rotate(&inverse, v);
+    for ( int i = 0; i < 3; i++ )
+    {
+        local.data[i] *= body->inverseInertia.data[i] / body->mass;
+    }
+    return ac_quat_rotate(body->orientation, &local);
+}
+
+static float inverse_effective_mass(
+    const PhysContactBody* body, const ac_vec3* offset, const ac_vec3* direction
+)
+{
+    if ( body->isStatic )
+    {
+        return 0.0f;
+    }
+
+    ac_vec3 torque  = ac_vec3_cross(offset, direction);
+    ac_vec3 spin    = apply_inverse_inertia(body, &torque);
+    ac_vec3 angular = ac_vec3_cross(&spin, offset);
+    return 1.0f / body->mass + ac_vec3_dot(direction, &angular);
+}
+
+static ac_vec3 point_velocity(const PhysContactBody* body, const ac_vec3* offset)
+{
+    ac_vec3 spin = ac_vec3_cross(body->angularVelocity, offset);
+    return ac_vec3_add(body->velocity, &spin);
+}
+
+static ac_vec3 relative_velocity(
+    const PhysContactBody* body1,
+    const ac_vec3*         offset1,
+    const PhysContactBody* body2,
+    const ac_vec3*         offset2
+)
+{
+    ac_vec3 velocity1 = point_velocity(body1, offset1);
+    ac_vec3 velocity2 = point_velocity(body2, offset2);
+    return ac_vec3_sub(&velocity2, &velocity1);
+}
+
+static void apply_impulse(PhysContactBody* body, const ac_vec3* offset, const ac_vec3* impulse)
+{
+    if ( body->isStatic )
+    {
+        return;
+    }
+
+    ac_vec3 linear         = ac_vec3_scale(impulse, 1.0f / body->mass);
+    ac_vec3 torque         = ac_vec3_cross(offset, impulse);
+    ac_vec3 angular        = apply_inverse_inertia(body, &torque);
+    *body->velocity        = ac_vec3_add(body->velocity, &linear);
+    *body->angularVelocity = ac_vec3_add(body->angularVelocity, &angular);
+}
+
+/**
+ * \brief Applies an impulse to body2 and the opposite impulse to body1.
+ */
+static void apply_impulse_pair(
+    PhysContactBody* body1,
+    const ac_vec3*   offset1,
+    PhysContactBody* body2,
+    const ac_vec3*   offset2,
+    const ac_vec3*   impulse
+)
+{
+    ac_vec3 opposite = ac_vec3_negate(impulse);
+    apply_impulse(body1, offset1, &opposite);
+    apply_impulse(body2, offset2, impulse);
+}
+
+static void apply_friction(
+    const ac_vec3*   normal,
+    float            normalImpulse,
+    PhysContactBody* body1,
+    const ac_vec3*   offset1,
+    PhysContactBody* body2,
+    const ac_vec3*   offset2,
+    float            friction,
+    float            rollingFriction
+)
+{
+    if ( normalImpulse <= 0.0f )
+    {
+        return;
+    }
+
+    // sliding friction opposes the tangential velocity of the contact point, up to mu * jn
+    ac_vec3 relative = relative_velocity(body1, offset1, body2, offset2);
+    ac_vec3 along    = ac_vec3_scale(normal, ac_vec3_dot(&relative, normal));
+    ac_vec3 sliding  = ac_vec3_sub(&relative, &along);
+    float   speed    = ac_vec3_magnitude(&sliding);
+    if ( friction > 0.0f && speed > AC_EPSILON )
+    {
+        ac_vec3 tangent = ac_vec3_scale(&sliding, -1.0f / speed);
+        float   k       = inverse_effective_mass(body1, offset1, &tangent) +
+                  inverse_effective_mass(body2, offset2, &tangent);
+        if ( k > 0.0f )
+        {
+            // the impulse that stops the sliding, capped by the friction cone
+            float   stop    = speed / k;
+            float   cap     = friction * normalImpulse;
+            ac_vec3 impulse = ac_vec3_scale(&tangent, stop < cap ? stop : cap);
+            apply_impulse_pair(body1, offset1, body2, offset2, &impulse);
+        }
+    }
+
+    // rolling friction is a torque opposing the relative spin, applied about each body's centre
+    ac_vec3 spin      = ac_vec3_sub(body2->angularVelocity, body1->angularVelocity);
+    float   spinSpeed = ac_vec3_magnitude(&spin);
+    if ( rollingFriction <= 0.0f || spinSpeed <= AC_EPSILON )
+    {
+        return;
+    }
+    ac_vec3 axis  = ac_vec3_scale(&spin, 1.0f / spinSpeed);
+    ac_vec3 spin1 = apply_inverse_inertia(body1, &axis);
+    ac_vec3 spin2 = apply_inverse_inertia(body2, &axis);
+    float   k     = ac_vec3_dot(&axis, &spin1) + ac_vec3_dot(&axis, &spin2);
+    float   lever = 0.0f;  // the radius of each body that can spin
+    if ( !ac_vec3_is_zero(&spin1) )
+    {
+        lever += ac_vec3_magnitude(offset1);
+    }
+    if ( !ac_vec3_is_zero(&spin2) )
+    {
+        lever += ac_vec3_magnitude(offset2);
+    }
+    if ( k <= 0.0f || lever <= 0.0f )
+    {
+        return;
+    }
+
+    float   stop    = spinSpeed / k;
+    float   cap     = rollingFriction * normalImpulse * lever;
+    float   angular = stop < cap ? stop : cap;
+    ac_vec3 change1 = ac_vec3_scale(&spin1, angular);
+    ac_vec3 change2 = ac_vec3_scale(&spin2, -angular);
+    *body1->angularVelocity = ac_vec3_add(body1->angularVelocity, &change1);
+    *body2->angularVelocity = ac_vec3_add(body2->angularVelocity, &change2);
+}
+
 void resolve_collision(
     IntersectionResult* info,
-    ac_vec3*            pos1,
-    ac_vec3*            v1,
-    float               m1,
-    bool                s1,
-    ac_vec3*            pos2,
-    ac_vec3*            v2,
-    float               m2,
-    bool                s2
+    PhysContactBody*    body1,
+    PhysContactBody*    body2,
+    float               friction,
+    float               rollingFriction
 )
 {
     if ( ac_vec3_is_nan(&info->contactNormal) || ac_vec3_is_nan(&info->contactPoint) )
@@ -50,23 +314,51 @@ void resolve_collision(
         return;
     }
 
-    ac_vec3 relativeVelocity = ac_vec3_sub(v2, v1);
+    resolve_collision_unchecked(info, body1, body2, friction, rollingFriction);
+}
+
+void resolve_collision_unchecked(
+    IntersectionResult* info,
+    PhysContactBody*    body1,
+    PhysContactBody*    body2,
+    float               friction,
+    float               rollingFriction
+)
+{
+    AC_DEBUG_CHECK(!ac_vec3_is_nan(&info->contactNormal) && !ac_vec3_is_nan(&info->contactPoint));
+
+    bool    s1      = body1->isStatic;
+    bool    s2      = body2->isStatic;
+    ac_vec3 offset1 = ac_vec3_sub(&info->contactPoint, body1->position);
+    ac_vec3 offset2 = ac_vec3_sub(&info->contactPoint, body2->position);
+
+    ac_vec3 relativeVelocity = relative_velocity(body1, &offset1, body2, &offset2);
 
     float impulse = ac_vec3_dot(&relativeVelocity, &info->contactNormal);
     // if objects are moving towards eachother or either entity is static
     if ( impulse <= 0.0f || (s1 || s2) )
     {
-        // calculate the impulse
+        // calculate the impulse at the contact point
         float impulseScalar  = -(1.0f + 0.8f) * impulse;  // 0.8 is the coefficient of restitution
-        impulseScalar       /= (s1 ? 0.0f : 1.0f / m1) + (s2 ? 0.0f : 1.0f / m2);
+        impulseScalar       /= inverse_effective_mass(body1, &offset1, &info->contactNormal) +
+                         inverse_effective_mass(body2, &offset2, &info->contactNormal);
 
-        // calc velocity changes
-        ac_vec3 velocityChange1, velocityChange2;
-        velocityChange1 = ac_vec3_scale(&info->contactNormal, impulseScalar / (s1 ? 1.0f : m1));
-        velocityChange2 = ac_vec3_scale(&info->contactNormal, impulseScalar / (s2 ? 1.0f : m2));
+        ac_vec3 normalImpulse = ac_vec3_scale(&info->contactNormal, impulseScalar);
+        apply_impulse_pair(body1, &offset1, body2, &offset2, &normalImpulse);
+        apply_friction(
+            &info->contactNormal,
+            impulseScalar,
+            body1,
+            &offset1,
+            body2,
+            &offset2,
+            friction,
+            rollingFriction
+        );
 
         const float penetrationSlop  = 0.001f;  // max allowed overlap before depenetration
-        float       penetrationDepth = fmaxf(info->penetrationDepth - penetrationSlop, 0.0f);
+        float       penetrationDepth = info->penetrationDepth - penetrationSlop;
+        penetrationDepth             = penetrationDepth > 0.0f ? penetrationDepth : 0.0f;
 
         // set the default depenetration, even distibution is both dynamic
         // if both these ifs are true, the depenetration will be 0.5f
@@ -81,21 +373,88 @@ void resolve_collision(
             depenetrationScalars.x += 0.5f;
         }
 
-        // apply velocity and position correction to non-static objects only
+        // apply position correction to non-static objects only
         if ( !s1 )
         {
             ac_vec3 correction =
                 ac_vec3_scale(&info->contactNormal, penetrationDepth * depenetrationScalars.x);
-            *v1   = ac_vec3_sub(v1, &velocityChange1);  // v1 -= velocityChange1
-            *pos1 = ac_vec3_sub(pos1, &correction);
+            *body1->position = ac_vec3_sub(body1->position, &correction);
         }
 
         if ( !s2 )
         {
             ac_vec3 correction =
                 ac_vec3_scale(&info->contactNormal, penetrationDepth * depenetrationScalars.y);
-            *v2   = ac_vec3_add(v2, &velocityChange2);  // v2 += velocityChange2
-            *pos2 = ac_vec3_add(pos2, &correction);
+            *body2->position = ac_vec3_add(body2->position, &correction);
+        }
+    }
+}
+
+void resolve_manifold(
+    ContactManifold* manifold, PhysContactBody* body1, PhysContactBody* body2, bool warmStart
+)
+{
+    float inverseMass1 = body1->isStatic ? 0.0f : 1.0f / body1->mass;
+    float inverseMass2 = body2->isStatic ? 0.0f : 1.0f / body2->mass;
+    float inverseMass  = inverseMass1 + inverseMass2;
+    if ( manifold->numPoints == 0 || inverseMass <= 0.0f )
+    {
+        return;
+    }
+
+    // the offsets are taken before any correction moves the bodies, and the bounce is decided
+    // from the velocity before any impulse is applied
+    ac_vec3 offsets1[AC_MANIFOLD_MAX_POINTS], offsets2[AC_MANIFOLD_MAX_POINTS];
+    float   targetVelocities[AC_MANIFOLD_MAX_POINTS];
+    for ( unsigned i = 0; i < manifold->numPoints; i++ )
+    {
+        offsets1[i]      = ac_vec3_sub(&manifold->points[i].position, body1->position);
+        offsets2[i]      = ac_vec3_sub(&manifold->points[i].position, body2->position);
+        ac_vec3 relative = relative_velocity(body1, &offsets1[i], body2, &offsets2[i]);
+        float   approach = ac_vec3_dot(&relative, &manifold->normal);
+        targetVelocities[i] = approach < -AC_PHYS_RESTITUTION_THRESHOLD ? -0.8f * approach : 0.0f;
+    }
+
+    if ( warmStart )
+    {
+        for ( unsigned i = 0; i < manifold->numPoints; i++ )
+        {
+            ac_vec3 impulse =
+                ac_vec3_scale(&manifold->normal, manifold->points[i].normalImpulse);
+            apply_impulse_pair(body1, &offsets1[i], body2, &offsets2[i], &impulse);
         }
     }
+
+    for ( unsigned i = 0; i < manifold->numPoints; i++ )
+    {
+        ContactPoint* point    = &manifold->points[i];
+        ac_vec3       relative = relative_velocity(body1, &offsets1[i], body2, &offsets2[i]);
+        float         velocity = ac_vec3_dot(&relative, &manifold->normal);
+        float         k        = inverse_effective_mass(body1, &offsets1[i], &manifold->normal) +
+                  inverse_effective_mass(body2, &offsets2[i], &manifold->normal);
+        float impulse = (targetVelocities[i] - velocity) / k;
+
+        // clamp the accumulated impulse rather than this one so earlier impulses can be undone
+        float previous       = point->normalImpulse;
+        float sum            = previous + impulse;
+        point->normalImpulse = sum > 0.0f ? sum : 0.0f;
+        impulse              = point->normalImpulse - previous;
+
+        ac_vec3 change = ac_vec3_scale(&manifold->normal, impulse);
+        apply_impulse_pair(body1, &offsets1[i], body2, &offsets2[i], &change);
+    }
+
+    // positional correction from the deepest point, split by inverse mass
+    const float penetrationSlop  = 0.001f;
+    unsigned    deepest          = contact_manifold_deepest(manifold);
+    float       penetrationDepth = manifold->points[deepest].penetrationDepth - penetrationSlop;
+    if ( penetrationDepth > 0.0f )
+    {
+        ac_vec3 correction1 =
+            ac_vec3_scale(&manifold->normal, penetrationDepth * inverseMass1 / inverseMass);
+        ac_vec3 correction2 =
+            ac_vec3_scale(&manifold->normal, penetrationDepth * inverseMass2 / inverseMass);
+        *body1->position = ac_vec3_sub(body1->position, &correction1);
+        *body2->position = ac_vec3_add(body2->position, &correction2);
+    }
 }
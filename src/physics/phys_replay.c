@@ -0,0 +1,689 @@
+/**
+ * \file
+ * \brief Implements recording and playback of physics world state.
+ */
+#include <ace/physics/phys_replay.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef __STDC_NO_THREADS__
+    #include <threads.h>
+#endif
+
+#define AC_PHYS_REPLAY_HEADER_SIZE       20
+#define AC_PHYS_REPLAY_DEFAULT_KEYFRAMES 120
+#define AC_PHYS_REPLAY_DEFAULT_BUFFER    (1u << 20)
+#define AC_PHYS_REPLAY_MAX_QUANTIZE      16
+#define AC_PHYS_REPLAY_WORDS_PER_ENT     13  // position, velocity, orientation and spin
+#define AC_PHYS_REPLAY_MAX_VARINT        5
+
+/**
+ * \brief The type byte at the start of each frame.
+ */
+typedef enum PhysReplayFrameType
+{
+    phys_replay_frame_key,
+    phys_replay_frame_delta
+} PhysReplayFrameType;
+
+//--------------------------------------------------------------------------------------------------
+// Encoding
+//--------------------------------------------------------------------------------------------------
+
+static size_t put_varint(uint8_t* out, uint32_t value)
+{
+    size_t size = 0;
+    while ( value >= 0x80 )
+    {
+        out[size++]   = (uint8_t) (value | 0x80);
+        value       >>= 7;
+    }
+    out[size++] = (uint8_t) value;
+    return size;
+}
+
+static bool get_varint(const uint8_t** cursor, const uint8_t* end, uint32_t* value)
+{
+    uint32_t result = 0;
+    for ( unsigned shift = 0; shift < 35; shift += 7 )
+    {
+        if ( *cursor == end )
+        {
+            return false;
+        }
+        uint8_t byte  = *(*cursor)++;
+        result       |= (uint32_t) (byte & 0x7F) << shift;
+        if ( (byte & 0x80) == 0 )
+        {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void put_u32_le(uint8_t* out, uint32_t value)
+{
+    out[0] = (uint8_t) value;
+    out[1] = (uint8_t) (value >> 8);
+    out[2] = (uint8_t) (value >> 16);
+    out[3] = (uint8_t) (value >> 24);
+}
+
+static uint32_t get_u32_le(const uint8_t* in)
+{
+    return (uint32_t) in[0] | (uint32_t) in[1] << 8 | (uint32_t) in[2] << 16 |
+           (uint32_t) in[3] << 24;
+}
+
+/**
+ * \brief Finds word \p i of the recorded state within a world.
+ * \details
+ * The recorded state is the positions, velocities, orientations and angular velocities of every
+ * entity, one array after the other.
+ * \return The byte offset of the word from the start of the world.
+ */
+static size_t state_word_offset(unsigned numEnts, size_t i)
+{
+    static const struct
+    {
+        size_t offset;
+        size_t wordsPerEnt;
+    } arrays[] = {
+        { offsetof(PhysWorld, positions), 3 },
+        { offsetof(PhysWorld, velocities), 3 },
+        { offsetof(PhysWorld, orientations), 4 },
+        { offsetof(PhysWorld, angularVelocities), 3 },
+    };
+
+    size_t a = 0;
+    while ( a + 1 < sizeof(arrays) / sizeof(arrays[0]) && i >= numEnts * arrays[a].wordsPerEnt )
+    {
+        i -= numEnts * arrays[a].wordsPerEnt;
+        a++;
+    }
+    return arrays[a].offset + i * 4;
+}
+
+static uint32_t read_state_word(const PhysWorld* world, size_t i)
+{
+    uint32_t word;
+    memcpy(&word, (const uint8_t*) world + state_word_offset(world->numEnts, i), sizeof(word));
+    return word;
+}
+
+static void write_state_word(PhysWorld* world, size_t i, uint32_t word)
+{
+    memcpy((uint8_t*) world + state_word_offset(world->numEnts, i), &word, sizeof(word));
+}
+
+//--------------------------------------------------------------------------------------------------
+// Recorder
+//--------------------------------------------------------------------------------------------------
+
+struct PhysRecorder
+{
+    FILE*             file;
+    unsigned          numEnts;
+    unsigned          keyframeInterval;
+    unsigned          quantizeBits;
+    uint32_t*         previous;       // the quantized words of the last frame
+    uint8_t*          previousSleep;  // the sleeping bitmask of the last frame
+    uint8_t*          scratch;        // the encoded frame
+    size_t            scratchSize;
+    PhysRecorderStats stats;
+    bool              error;
+
+    // the ring buffer drained by the writer thread
+    uint8_t* ring;
+    size_t   ringSize;
+    size_t   ringHead;  // next byte written by the recorder
+    size_t   ringUsed;  // bytes waiting to be written to the file
+#ifndef __STDC_NO_THREADS__
+    thrd_t writer;
+    mtx_t  lock;
+    cnd_t  dataReady;
+    cnd_t  spaceReady;
+    bool   closing;
+#endif
+};
+
+#ifndef __STDC_NO_THREADS__
+static int recorder_writer_main(void* arg)
+{
+    PhysRecorder* recorder = (PhysRecorder*) arg;
+
+    mtx_lock(&recorder->lock);
+    for ( ;; )
+    {
+        // wait for half the ring to fill so the file is written in large blocks
+        while ( (recorder->ringUsed == 0 || recorder->ringUsed < recorder->ringSize / 2) &&
+                !recorder->closing )
+        {
+            cnd_wait(&recorder->dataReady, &recorder->lock);
+        }
+        if ( recorder->ringUsed == 0 )
+        {
+            break;  // closing with nothing left to write
+        }
+
+        // write the contiguous run at the tail without holding the lock
+        size_t tail  = (recorder->ringHead + recorder->ringSize - recorder->ringUsed) %
+                      recorder->ringSize;
+        size_t count = recorder->ringSize - tail;
+        count        = count < recorder->ringUsed ? count : recorder->ringUsed;
+        mtx_unlock(&recorder->lock);
+
+        bool written = fwrite(recorder->ring + tail, 1, count, recorder->file) == count;
+
+        mtx_lock(&recorder->lock);
+        recorder->error    = recorder->error || !written;
+        recorder->ringUsed -= count;
+        cnd_signal(&recorder->spaceReady);
+    }
+    mtx_unlock(&recorder->lock);
+    return 0;
+}
+#endif
+
+/**
+ * \brief Checks whether writing the recording has failed, which the writer thread may report.
+ */
+static bool recorder_failed(PhysRecorder* recorder)
+{
+#ifndef __STDC_NO_THREADS__
+    mtx_lock(&recorder->lock);
+    bool error = recorder->error;
+    mtx_unlock(&recorder->lock);
+    return error;
+#else
+    return recorder->error;
+#endif
+}
+
+/**
+ * \brief Hands encoded bytes to the writer thread, waiting for space if the ring is full.
+ */
+static void recorder_push(PhysRecorder* recorder, const uint8_t* data, size_t size)
+{
+#ifndef __STDC_NO_THREADS__
+    mtx_lock(&recorder->lock);
+    while ( size > 0 )
+    {
+        if ( recorder->ringUsed == recorder->ringSize )
+        {
+            recorder->stats.stalls++;
+            while ( recorder->ringUsed == recorder->ringSize )
+            {
+                cnd_wait(&recorder->spaceReady, &recorder->lock);
+            }
+        }
+
+        size_t space = recorder->ringSize - recorder->ringUsed;
+        size_t run   = recorder->ringSize - recorder->ringHead;
+        size_t count = size < space ? size : space;
+        count        = count < run ? count : run;
+        memcpy(recorder->ring + recorder->ringHead, data, count);
+        recorder->ringHead  = (recorder->ringHead + count) % recorder->ringSize;
+        recorder->ringUsed += count;
+        data               += count;
+        size               -= count;
+        if ( recorder->ringUsed >= recorder->ringSize / 2 )
+        {
+            cnd_signal(&recorder->dataReady);
+        }
+    }
+    mtx_unlock(&recorder->lock);
+#else
+    recorder->error = recorder->error || fwrite(data, 1, size, recorder->file) != size;
+#endif
+}
+
+PhysRecorder* phys_recorder_open(
+    const char* path, const PhysWorld* world, const PhysRecorderConfig* config
+)
+{
+    PhysRecorderConfig options = { 0 };
+    if ( config != NULL )
+    {
+        options = *config;
+    }
+    if ( options.quantizeBits > AC_PHYS_REPLAY_MAX_QUANTIZE )
+    {
+        return NULL;
+    }
+    if ( options.keyframeInterval == 0 )
+    {
+        options.keyframeInterval = AC_PHYS_REPLAY_DEFAULT_KEYFRAMES;
+    }
+    if ( options.bufferSize == 0 )
+    {
+        options.bufferSize = AC_PHYS_REPLAY_DEFAULT_BUFFER;
+    }
+
+    PhysRecorder* recorder = (PhysRecorder*) calloc(1, sizeof(PhysRecorder));
+    if ( recorder == NULL )
+    {
+        return NULL;
+    }
+
+    size_t numWords            = (size_t) world->numEnts * AC_PHYS_REPLAY_WORDS_PER_ENT;
+    size_t maskSize            = ((size_t) world->numEnts + 7) / 8;
+    recorder->numEnts          = world->numEnts;
+    recorder->keyframeInterval = options.keyframeInterval;
+    recorder->quantizeBits     = options.quantizeBits;
+    recorder->scratchSize      = 1 + 2 * AC_PHYS_REPLAY_MAX_VARINT +
+                            numWords * AC_PHYS_REPLAY_MAX_VARINT + maskSize;
+    recorder->previous         = (uint32_t*) calloc(numWords + 1, sizeof(uint32_t));
+    recorder->previousSleep    = (uint8_t*) calloc(maskSize + 1, 1);
+    recorder->scratch          = (uint8_t*) malloc(recorder->scratchSize);
+    recorder->ringSize         = options.bufferSize;
+    recorder->ring             = (uint8_t*) malloc(recorder->ringSize);
+    recorder->file             = fopen(path, "wb");
+    if ( !recorder->previous || !recorder->previousSleep || !recorder->scratch || !recorder->ring ||
+         !recorder->file )
+    {
+        goto fail;
+    }
+
+    uint8_t header[AC_PHYS_REPLAY_HEADER_SIZE];
+    memcpy(header, "ACRP", 4);
+    put_u32_le(header + 4, AC_PHYS_REPLAY_VERSION);
+    put_u32_le(header + 8, recorder->numEnts);
+    put_u32_le(header + 12, recorder->keyframeInterval);
+    put_u32_le(header + 16, recorder->quantizeBits);
+    if ( fwrite(header, 1, sizeof(header), recorder->file) != sizeof(header) )
+    {
+        goto fail;
+    }
+
+#ifndef __STDC_NO_THREADS__
+    bool lockReady  = mtx_init(&recorder->lock, mtx_plain) == thrd_success;
+    bool dataReady  = lockReady && cnd_init(&recorder->dataReady) == thrd_success;
+    bool spaceReady = dataReady && cnd_init(&recorder->spaceReady) == thrd_success;
+    if ( !spaceReady )
+    {
+        if ( dataReady )
+        {
+            cnd_destroy(&recorder->dataReady);
+        }
+        if ( lockReady )
+        {
+            mtx_destroy(&recorder->lock);
+        }
+        goto fail;
+    }
+    if ( thrd_create(&recorder->writer, recorder_writer_main, recorder) != thrd_success )
+    {
+        cnd_destroy(&recorder->spaceReady);
+        cnd_destroy(&recorder->dataReady);
+        mtx_destroy(&recorder->lock);
+        goto fail;
+    }
+#endif
+    return recorder;
+
+fail:
+    if ( recorder->file != NULL )
+    {
+        fclose(recorder->file);
+    }
+    free(recorder->previous);
+    free(recorder->previousSleep);
+    free(recorder->scratch);
+    free(recorder->ring);
+    free(recorder);
+    return NULL;
+}
+
+bool phys_recorder_record(PhysRecorder* recorder, const PhysWorld* world)
+{
+    if ( world->numEnts != recorder->numEnts || recorder_failed(recorder) )
+    {
+        return false;
+    }
+
+    bool     keyframe = recorder->stats.frames % recorder->keyframeInterval == 0;
+    unsigned bits     = recorder->quantizeBits;
+    uint32_t mask     = bits > 0 ? ~((1u << bits) - 1) : ~0u;
+    uint32_t half     = bits > 0 ? 1u << (bits - 1) : 0;
+
+    // the payload is encoded after room for the frame header
+    size_t   headerRoom = 1 + 2 * AC_PHYS_REPLAY_MAX_VARINT;
+    uint8_t* payload    = recorder->scratch + headerRoom;
+    size_t   size       = 0;
+
+    size_t numWords = (size_t) recorder->numEnts * AC_PHYS_REPLAY_WORDS_PER_ENT;
+    for ( size_t i = 0; i < numWords; i++ )
+    {
+        // round to the nearest representable value, then XOR against the previous frame
+        uint32_t word          = (read_state_word(world, i) + half) & mask;
+        uint32_t delta         = keyframe ? word : word ^ recorder->previous[i];
+        recorder->previous[i]  = word;
+        size                  += put_varint(payload + size, delta >> bits);
+    }
+
+    size_t maskSize = ((size_t) recorder->numEnts + 7) / 8;
+    for ( size_t b = 0; b < maskSize; b++ )
+    {
+        uint8_t sleepBits = 0;
+        for ( unsigned bit = 0; bit < 8 && b * 8 + bit < recorder->numEnts; bit++ )
+        {
+            sleepBits |= (uint8_t) (world->sleeping[b * 8 + bit] ? 1u << bit : 0u);
+        }
+        payload[size++]            = keyframe ? sleepBits : sleepBits ^ recorder->previousSleep[b];
+        recorder->previousSleep[b] = sleepBits;
+    }
+
+    // prepend the frame header directly before the payload
+    uint8_t header[1 + 2 * AC_PHYS_REPLAY_MAX_VARINT];
+    size_t  headerSize = 0;
+    header[headerSize++] = (uint8_t) (keyframe ? phys_replay_frame_key : phys_replay_frame_delta);
+    headerSize += put_varint(header + headerSize, (uint32_t) recorder->stats.frames);
+    headerSize += put_varint(header + headerSize, (uint32_t) size);
+    memcpy(payload - headerSize, header, headerSize);
+
+    recorder_push(recorder, payload - headerSize, headerSize + size);
+
+    recorder->stats.frames++;
+    recorder->stats.keyframes    += keyframe ? 1 : 0;
+    recorder->stats.rawBytes     += numWords * sizeof(uint32_t) + recorder->numEnts;
+    recorder->stats.encodedBytes += headerSize + size;
+    return true;
+}
+
+PhysRecorderStats phys_recorder_stats(const PhysRecorder* recorder)
+{
+    return recorder->stats;
+}
+
+bool phys_recorder_close(PhysRecorder* recorder)
+{
+    if ( recorder == NULL )
+    {
+        return false;
+    }
+
+#ifndef __STDC_NO_THREADS__
+    mtx_lock(&recorder->lock);
+    recorder->closing = true;
+    cnd_signal(&recorder->dataReady);
+    mtx_unlock(&recorder->lock);
+    thrd_join(recorder->writer, NULL);
+    cnd_destroy(&recorder->spaceReady);
+    cnd_destroy(&recorder->dataReady);
+    mtx_destroy(&recorder->lock);
+#endif
+
+    bool success = !recorder->error && fclose(recorder->file) == 0;
+    if ( recorder->error )
+    {
+        fclose(recorder->file);
+    }
+    free(recorder->previous);
+    free(recorder->previousSleep);
+    free(recorder->scratch);
+    free(recorder->ring);
+    free(recorder);
+    return success;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Player
+//--------------------------------------------------------------------------------------------------
+
+typedef struct PhysReplayKeyframe
+{
+    unsigned frame;
+    size_t   offset;
+} PhysReplayKeyframe;
+
+struct PhysReplay
+{
+    uint8_t*            data;
+    size_t              size;
+    unsigned            numEnts;
+    unsigned            quantizeBits;
+    unsigned            numFrames;
+    PhysReplayKeyframe* keyframes;
+    unsigned            numKeyframes;
+
+    // the decoder state
+    size_t    cursor;
+    unsigned  nextFrame;
+    uint32_t* words;
+    uint8_t*  sleepMask;
+};
+
+/**
+ * \brief Reads the header of the frame at \p offset.
+ * \return false if the frame is incomplete or malformed.
+ */
+static bool replay_read_frame_header(
+    const PhysReplay* replay,
+    size_t            offset,
+    uint8_t*          type,
+    uint32_t*         frame,
+    const uint8_t**   payload,
+    uint32_t*         payloadSize
+)
+{
+    const uint8_t* cursor = replay->data + offset;
+    const uint8_t* end    = replay->data + replay->size;
+    if ( cursor == end )
+    {
+        return false;
+    }
+    *type = *cursor++;
+    if ( *type > phys_replay_frame_delta || !get_varint(&cursor, end, frame) ||
+         !get_varint(&cursor, end, payloadSize) || (size_t) (end - cursor) < *payloadSize )
+    {
+        return false;
+    }
+    *payload = cursor;
+    return true;
+}
+
+/**
+ * \brief Decodes the frame at the cursor into the decoder state and advances the cursor.
+ */
+static bool replay_decode_frame(PhysReplay* replay)
+{
+    uint8_t        type;
+    uint32_t       frame, payloadSize;
+    const uint8_t* payload;
+    if ( replay->nextFrame >= replay->numFrames ||
+         !replay_read_frame_header(
+             replay, replay->cursor, &type, &frame, &payload, &payloadSize
+         ) )
+    {
+        return false;
+    }
+
+    bool           keyframe = type == phys_replay_frame_key;
+    const uint8_t* cursor   = payload;
+    const uint8_t* end      = payload + payloadSize;
+    size_t         numWords = (size_t) replay->numEnts * AC_PHYS_REPLAY_WORDS_PER_ENT;
+    for ( size_t i = 0; i < numWords; i++ )
+    {
+        uint32_t delta;
+        if ( !get_varint(&cursor, end, &delta) )
+        {
+            return false;
+        }
+        delta           <<= replay->quantizeBits;
+        replay->words[i]  = keyframe ? delta : replay->words[i] ^ delta;
+    }
+
+    size_t maskSize = ((size_t) replay->numEnts + 7) / 8;
+    if ( (size_t) (end - cursor) != maskSize )
+    {
+        return false;
+    }
+    for ( size_t b = 0; b < maskSize; b++ )
+    {
+        replay->sleepMask[b] = keyframe ? cursor[b] : replay->sleepMask[b] ^ cursor[b];
+    }
+
+    replay->cursor = (size_t) (end - replay->data);
+    replay->nextFrame++;
+    return true;
+}
+
+PhysReplay* phys_replay_open(const char* path)
+{
+    FILE* file = fopen(path, "rb");
+    if ( file == NULL )
+    {
+        return NULL;
+    }
+
+    PhysReplay* replay = (PhysReplay*) calloc(1, sizeof(PhysReplay));
+    long        size   = -1;
+    if ( replay != NULL && fseek(file, 0, SEEK_END) == 0 )
+    {
+        size = ftell(file);
+    }
+    if ( size >= AC_PHYS_REPLAY_HEADER_SIZE && fseek(file, 0, SEEK_SET) == 0 )
+    {
+        replay->size = (size_t) size;
+        replay->data = (uint8_t*) malloc(replay->size);
+    }
+    bool read = replay != NULL && replay->data != NULL &&
+                fread(replay->data, 1, replay->size, file) == replay->size;
+    fclose(file);
+    if ( !read || memcmp(replay->data, "ACRP", 4) != 0 ||
+         get_u32_le(replay->data + 4) != AC_PHYS_REPLAY_VERSION ||
+         get_u32_le(replay->data + 8) > AC_MAX_PHYS_ENTS ||
+         get_u32_le(replay->data + 16) > AC_PHYS_REPLAY_MAX_QUANTIZE )
+    {
+        phys_replay_close(replay);
+        return NULL;
+    }
+    replay->numEnts      = get_u32_le(replay->data + 8);
+    replay->quantizeBits = get_u32_le(replay->data + 16);
+
+    size_t numWords   = (size_t) replay->numEnts * AC_PHYS_REPLAY_WORDS_PER_ENT;
+    replay->words     = (uint32_t*) calloc(numWords + 1, sizeof(uint32_t));
+    replay->sleepMask = (uint8_t*) calloc(((size_t) replay->numEnts + 7) / 8 + 1, 1);
+    if ( replay->words == NULL || replay->sleepMask == NULL )
+    {
+        phys_replay_close(replay);
+        return NULL;
+    }
+
+    // index the complete frames, a recording may have been cut short
+    size_t   offset    = AC_PHYS_REPLAY_HEADER_SIZE;
+    unsigned capacity  = 0;
+    uint8_t  type;
+    uint32_t frame, payloadSize;
+    const uint8_t* payload;
+    while ( replay_read_frame_header(replay, offset, &type, &frame, &payload, &payloadSize) &&
+            frame == replay->numFrames )
+    {
+        if ( type == phys_replay_frame_key )
+        {
+            if ( replay->numKeyframes == capacity )
+            {
+                capacity                    = capacity ? capacity * 2 : 16;
+                PhysReplayKeyframe* resized = (PhysReplayKeyframe*) realloc(
+                    replay->keyframes, capacity * sizeof(PhysReplayKeyframe)
+                );
+                if ( resized == NULL )
+                {
+                    break;
+                }
+                replay->keyframes = resized;
+            }
+            replay->keyframes[replay->numKeyframes++] = (PhysReplayKeyframe){ frame, offset };
+        }
+        else if ( replay->numKeyframes == 0 )
+        {
+            break;  // a delta with nothing to apply it to
+        }
+        offset = (size_t) (payload - replay->data) + payloadSize;
+        replay->numFrames++;
+    }
+
+    phys_replay_seek(replay, 0);
+    return replay;
+}
+
+unsigned phys_replay_num_frames(const PhysReplay* replay)
+{
+    return replay->numFrames;
+}
+
+unsigned phys_replay_num_entities(const PhysReplay* replay)
+{
+    return replay->numEnts;
+}
+
+bool phys_replay_seek(PhysReplay* replay, unsigned frame)
+{
+    if ( frame >= replay->numFrames )
+    {
+        return false;
+    }
+
+    // binary search for the last keyframe at or before the frame
+    unsigned low = 0, high = replay->numKeyframes;
+    while ( high - low > 1 )
+    {
+        unsigned mid = low + (high - low) / 2;
+        if ( replay->keyframes[mid].frame <= frame )
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    replay->cursor    = replay->keyframes[low].offset;
+    replay->nextFrame = replay->keyframes[low].frame;
+    while ( replay->nextFrame < frame )
+    {
+        if ( !replay_decode_frame(replay) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool phys_replay_next(PhysReplay* replay, PhysWorld* world)
+{
+    if ( world->numEnts != replay->numEnts || !replay_decode_frame(replay) )
+    {
+        return false;
+    }
+
+    memcpy(world->previousPositions, world->positions, sizeof(ac_vec3) * world->numEnts);
+    size_t numWords = (size_t) replay->numEnts * AC_PHYS_REPLAY_WORDS_PER_ENT;
+    for ( size_t i = 0; i < numWords; i++ )
+    {
+        write_state_word(world, i, replay->words[i]);
+    }
+    for ( unsigned i = 0; i < replay->numEnts; i++ )
+    {
+        world->sleeping[i] = (replay->sleepMask[i / 8] >> (i % 8)) & 1;
+    }
+    return true;
+}
+
+void phys_replay_close(PhysReplay* replay)
+{
+    if ( replay == NULL )
+    {
+        return;
+    }
+    free(replay->data);
+    free(replay->keyframes);
+    free(replay->words);
+    free(replay->sleepMask);
+    free(replay);
+}
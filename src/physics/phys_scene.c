@@ -0,0 +1,537 @@
+/**
+ * \file
+ * \brief Implements saving and loading of physics world scenes.
+ */
+#include <ace/geometry/shapes.h>
+#include <ace/physics/phys_scene.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(AC_PLATFORM_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define AC_PHYS_SCENE_MMAP
+#endif
+
+// the bulk copies rely on these types being packed 32-bit words
+_Static_assert(sizeof(ac_vec3) == 3 * sizeof(uint32_t), "ac_vec3 must be three packed floats");
+_Static_assert(sizeof(ac_quat) == 4 * sizeof(uint32_t), "ac_quat must be four packed floats");
+_Static_assert(sizeof(float) == sizeof(uint32_t), "float must be 32 bits");
+_Static_assert(sizeof(unsigned) == sizeof(uint32_t), "entity ids must be 32 bits");
+
+struct PhysScene
+{
+    Sphere* spheres;
+    AABB*   aabbs;
+};
+
+//--------------------------------------------------------------------------------------------------
+// Byte Order
+//--------------------------------------------------------------------------------------------------
+
+static bool host_is_little_endian(void)
+{
+    const uint16_t probe = 1;
+    unsigned char  first;
+    memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+static uint32_t swap_u32(uint32_t value)
+{
+    return (value >> 24) | ((value >> 8) & 0xFF00u) | ((value << 8) & 0xFF0000u) | (value << 24);
+}
+
+/**
+ * \brief Copies 32-bit little-endian words into host order.
+ */
+static void copy_words_from_le(void* dst, const void* src, size_t numWords)
+{
+    memcpy(dst, src, numWords * sizeof(uint32_t));
+    if ( !host_is_little_endian() )
+    {
+        uint32_t* words = (uint32_t*) dst;
+        for ( size_t i = 0; i < numWords; i++ )
+        {
+            words[i] = swap_u32(words[i]);
+        }
+    }
+}
+
+/**
+ * \brief Writes 32-bit host order words to a file as little-endian.
+ */
+static bool write_words_le(FILE* file, const void* src, size_t numWords)
+{
+    if ( host_is_little_endian() )
+    {
+        return fwrite(src, sizeof(uint32_t), numWords, file) == numWords;
+    }
+
+    uint32_t       chunk[256];
+    const uint32_t chunkWords = sizeof(chunk) / sizeof(chunk[0]);
+    const uint8_t* bytes      = (const uint8_t*) src;
+    while ( numWords > 0 )
+    {
+        size_t count = numWords < chunkWords ? numWords : chunkWords;
+        memcpy(chunk, bytes, count * sizeof(uint32_t));
+        for ( size_t i = 0; i < count; i++ )
+        {
+            chunk[i] = swap_u32(chunk[i]);
+        }
+        if ( fwrite(chunk, sizeof(uint32_t), count, file) != count )
+        {
+            return false;
+        }
+        bytes    += count * sizeof(uint32_t);
+        numWords -= count;
+    }
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Saving
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * \brief An entity's collider shape, sorted by address so shared shapes are stored once.
+ */
+typedef struct SceneShapeRef
+{
+    const void* data;
+    uint32_t    entity;
+} SceneShapeRef;
+
+static int compare_shape_refs(const void* a, const void* b)
+{
+    const SceneShapeRef* refA = (const SceneShapeRef*) a;
+    const SceneShapeRef* refB = (const SceneShapeRef*) b;
+    if ( refA->data != refB->data )
+    {
+        return (uintptr_t) refA->data < (uintptr_t) refB->data ? -1 : 1;
+    }
+    return refA->entity < refB->entity ? -1 : (refA->entity > refB->entity);
+}
+
+static size_t byte_section_size(uint32_t numEnts)
+{
+    return ((size_t) numEnts + 3) & ~(size_t) 3;
+}
+
+bool phys_scene_save(const PhysWorld* world, const char* path)
+{
+    uint32_t numEnts     = world->numEnts;
+    float    friction[2] = { world->friction, world->rollingFriction };
+
+    // per entity (type, shape index) pairs, plus the shapes grouped by type
+    uint32_t*      colliders = (uint32_t*) malloc(sizeof(uint32_t) * 2 * (numEnts + 1));
+    SceneShapeRef* refs      = (SceneShapeRef*) malloc(sizeof(SceneShapeRef) * (numEnts + 1));
+    float*         spheres   = (float*) malloc(sizeof(float) * (numEnts + 1));
+    float*         aabbs     = (float*) malloc(sizeof(float) * 3 * (numEnts + 1));
+    uint8_t*       sleeping  = (uint8_t*) calloc(byte_section_size(numEnts) + 1, 1);
+    uint8_t*       alive     = (uint8_t*) calloc(byte_section_size(numEnts) + 1, 1);
+    FILE*          file      = NULL;
+    bool           success   = false;
+    if ( !colliders || !refs || !spheres || !aabbs || !sleeping || !alive )
+    {
+        goto cleanup;
+    }
+
+    uint32_t numRefs = 0;
+    for ( uint32_t i = 0; i < numEnts; i++ )
+    {
+        const Collider* collider = &world->colliders[i];
+        colliders[i * 2]         = AC_PHYS_SCENE_NO_COLLIDER;
+        colliders[i * 2 + 1]     = 0;
+        if ( collider->data == NULL )
+        {
+            continue;
+        }
+        if ( collider->type != SPHERE_C && collider->type != AABB_C )
+        {
+            goto cleanup;  // the shape cannot be stored by value
+        }
+        refs[numRefs++] = (SceneShapeRef){ .data = collider->data, .entity = i };
+    }
+
+    // give every distinct shape an index within the table for its type
+    qsort(refs, numRefs, sizeof(SceneShapeRef), compare_shape_refs);
+    uint32_t numSpheres = 0, numAABBs = 0;
+    for ( uint32_t r = 0; r < numRefs; r++ )
+    {
+        uint32_t        entity   = refs[r].entity;
+        const Collider* collider = &world->colliders[entity];
+        bool            shared   = r > 0 && refs[r].data == refs[r - 1].data;
+        if ( shared )
+        {
+            colliders[entity * 2]     = colliders[refs[r - 1].entity * 2];
+            colliders[entity * 2 + 1] = colliders[refs[r - 1].entity * 2 + 1];
+            continue;
+        }
+
+        colliders[entity * 2] = (uint32_t) collider->type;
+        if ( collider->type == SPHERE_C )
+        {
+            colliders[entity * 2 + 1] = numSpheres;
+            spheres[numSpheres++]     = ((const Sphere*) collider->data)->radius;
+        }
+        else
+        {
+            colliders[entity * 2 + 1] = numAABBs;
+            memcpy(&aabbs[numAABBs * 3], ((const AABB*) collider->data)->half_extents.data, 12);
+            numAABBs++;
+        }
+    }
+
+    for ( uint32_t i = 0; i < numEnts; i++ )
+    {
+        sleeping[i] = world->sleeping[i] ? 1 : 0;
+        alive[i]    = world->alive[i] ? 1 : 0;
+    }
+
+    PhysSceneHeader header = {
+        .magic              = { 'A', 'C', 'E', 'W' },
+        .version            = AC_PHYS_SCENE_VERSION,
+        .headerSize         = sizeof(PhysSceneHeader),
+        .numEnts            = numEnts,
+        .numStaticEntities  = world->numStaticEntities,
+        .numDynamicEntities = world->numDynamicEntities,
+        .numSpheres         = numSpheres,
+        .numAABBs           = numAABBs,
+        .gravity            = { world->gravity.x, world->gravity.y, world->gravity.z },
+        .airResistance      = world->airResistance,
+        .velocityThreshhold = world->velocityThreshhold,
+        .timeStep           = world->timeStep,
+    };
+
+    file = fopen(path, "wb");
+    if ( file == NULL )
+    {
+        goto cleanup;
+    }
+
+    // the header is written as words after the magic
+    success = fwrite(header.magic, 1, 4, file) == 4 &&
+              write_words_le(file, &header.version, (sizeof(header) - 4) / sizeof(uint32_t)) &&
+              write_words_le(file, world->positions, (size_t) numEnts * 3) &&
+              write_words_le(file, world->velocities, (size_t) numEnts * 3) &&
+              write_words_le(file, world->masses, numEnts) &&
+              fwrite(sleeping, 1, byte_section_size(numEnts), file) ==
+                  byte_section_size(numEnts) &&
+              write_words_le(file, colliders, (size_t) numEnts * 2) &&
+              write_words_le(file, world->staticEntities, world->numStaticEntities) &&
+              write_words_le(file, world->dynamicEntities, world->numDynamicEntities) &&
+              write_words_le(file, spheres, numSpheres) &&
+              write_words_le(file, aabbs, (size_t) numAABBs * 3) &&
+              write_words_le(file, world->generations, numEnts) &&
+              fwrite(alive, 1, byte_section_size(numEnts), file) == byte_section_size(numEnts) &&
+              write_words_le(file, world->orientations, (size_t) numEnts * 4) &&
+              write_words_le(file, world->angularVelocities, (size_t) numEnts * 3) &&
+              write_words_le(file, world->inverseInertias, (size_t) numEnts * 3) &&
+              write_words_le(file, friction, 2);
+
+cleanup:
+    if ( file != NULL && fclose(file) != 0 )
+    {
+        success = false;
+    }
+    free(colliders);
+    free(refs);
+    free(spheres);
+    free(aabbs);
+    free(sleeping);
+    free(alive);
+    return success;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Loading
+//--------------------------------------------------------------------------------------------------
+
+PhysScene* phys_scene_load_memory(PhysWorld* world, const void* data, size_t size)
+{
+    PhysSceneHeader header;
+    if ( data == NULL || size < sizeof(header) )
+    {
+        return NULL;
+    }
+
+    const uint8_t* bytes = (const uint8_t*) data;
+    memcpy(header.magic, bytes, 4);
+    copy_words_from_le(&header.version, bytes + 4, (sizeof(header) - 4) / sizeof(uint32_t));
+    if ( memcmp(header.magic, "ACEW", 4) != 0 || header.version == 0 ||
+         header.version > AC_PHYS_SCENE_VERSION ||
+         header.headerSize < sizeof(header) || header.numEnts > AC_MAX_PHYS_ENTS ||
+         header.numStaticEntities > AC_MAX_PHYS_ENTS ||
+         header.numDynamicEntities > AC_MAX_PHYS_ENTS )
+    {
+        return NULL;
+    }
+
+    // locate every section and check the file is large enough to hold them, version 1 files have
+    // no generation or alive sections and version 2 files have no rotation or friction sections.
+    // The header size and shape counts are not bounded, so the total is summed in 64 bits where it
+    // cannot wrap, and once it fits in the data so does the offset of every section
+    const size_t   n        = header.numEnts;
+    const size_t   slots    = header.version >= 2 ? n * 4 + byte_section_size(n) : 0;
+    const size_t   rotation = header.version >= 3 ? n * 16 + n * 12 + n * 12 + 8 : 0;
+    const uint64_t sections = (uint64_t) header.headerSize + n * 12 + n * 12 + n * 4 +
+                              byte_section_size(n) + n * 8 + header.numStaticEntities * 4 +
+                              header.numDynamicEntities * 4 + (uint64_t) header.numSpheres * 4 +
+                              (uint64_t) header.numAABBs * 12 + slots + rotation;
+    if ( (uint64_t) size < sections )
+    {
+        return NULL;
+    }
+
+    const uint8_t* positions  = bytes + header.headerSize;
+    const uint8_t* velocities = positions + n * 12;
+    const uint8_t* masses     = velocities + n * 12;
+    const uint8_t* sleeping   = masses + n * 4;
+    const uint8_t* colliders  = sleeping + byte_section_size(n);
+    const uint8_t* statics    = colliders + n * 8;
+    const uint8_t* dynamics   = statics + header.numStaticEntities * 4;
+    const uint8_t* spheres    = dynamics + header.numDynamicEntities * 4;
+    const uint8_t* aabbs      = spheres + (size_t) header.numSpheres * 4;
+    const uint8_t* slotGens   = aabbs + (size_t) header.numAABBs * 12;
+    const uint8_t* slotAlive  = slotGens + n * 4;
+    const uint8_t* rotations  = slotAlive + byte_section_size(n);
+    const uint8_t* spins      = rotations + n * 16;
+    const uint8_t* inertias   = spins + n * 12;
+    const uint8_t* friction   = inertias + n * 12;
+
+    PhysScene* scene = (PhysScene*) calloc(1, sizeof(PhysScene));
+    if ( scene == NULL )
+    {
+        return NULL;
+    }
+    scene->spheres = (Sphere*) malloc(sizeof(Sphere) * ((size_t) header.numSpheres + 1));
+    scene->aabbs   = (AABB*) malloc(sizeof(AABB) * ((size_t) header.numAABBs + 1));
+    if ( scene->spheres == NULL || scene->aabbs == NULL )
+    {
+        phys_scene_free(scene);
+        return NULL;
+    }
+    copy_words_from_le(scene->spheres, spheres, header.numSpheres);
+    copy_words_from_le(scene->aabbs, aabbs, (size_t) header.numAABBs * 3);
+
+    // validate the references before touching the world
+    uint32_t* refs   = (uint32_t*) malloc(n * 12 + header.numStaticEntities * 4 +
+                                        header.numDynamicEntities * 4 + 4);
+    uint8_t*  listed = (uint8_t*) calloc(n * 2 + 1, 1);  // static then dynamic membership
+    if ( refs == NULL || listed == NULL )
+    {
+        free(refs);
+        free(listed);
+        phys_scene_free(scene);
+        return NULL;
+    }
+    uint32_t* generations = refs + n * 2;
+    uint32_t* staticIds   = generations + n;
+    uint32_t* dynamicIds  = staticIds + header.numStaticEntities;
+    copy_words_from_le(refs, colliders, n * 2);
+    copy_words_from_le(staticIds, statics, header.numStaticEntities);
+    copy_words_from_le(dynamicIds, dynamics, header.numDynamicEntities);
+    if ( header.version >= 2 )
+    {
+        copy_words_from_le(generations, slotGens, n);
+    }
+    else
+    {
+        memset(generations, 0, n * 4);
+    }
+
+    bool valid = true;
+    for ( size_t i = 0; i < n && valid; i++ )
+    {
+        uint32_t type  = refs[i * 2];
+        uint32_t index = refs[i * 2 + 1];
+        bool     alive = header.version < 2 || slotAlive[i] != 0;
+        bool     shape = (type == SPHERE_C && index < header.numSpheres) ||
+                     (type == AABB_C && index < header.numAABBs);
+        valid = (type == AC_PHYS_SCENE_NO_COLLIDER || (alive && shape)) &&
+                generations[i] <= AC_PHYS_ENT_GENERATION_MASK;
+    }
+    for ( uint32_t i = 0; i < header.numStaticEntities + header.numDynamicEntities && valid; i++ )
+    {
+        // the dynamic ids directly follow the static ids, each entity may appear once per list
+        uint32_t id      = staticIds[i];
+        size_t   listing = (size_t) id * 2 + (i >= header.numStaticEntities);
+        valid = id < n && (header.version < 2 || slotAlive[id] != 0) && listed[listing] == 0;
+        if ( valid )
+        {
+            listed[listing] = 1;
+        }
+    }
+    free(listed);
+    if ( !valid )
+    {
+        free(refs);
+        phys_scene_free(scene);
+        return NULL;
+    }
+
+    // bulk copy the arrays straight into the world
+    phys_init_world(world);
+    world->gravity.x          = header.gravity[0];
+    world->gravity.y          = header.gravity[1];
+    world->gravity.z          = header.gravity[2];
+    world->airResistance      = header.airResistance;
+    world->velocityThreshhold = header.velocityThreshhold;
+    world->timeStep           = header.timeStep;
+    world->numEnts            = header.numEnts;
+    world->numStaticEntities  = header.numStaticEntities;
+    world->numDynamicEntities = header.numDynamicEntities;
+
+    // phys_init_world leaves every slot zeroed, the loaded ones start in no entity list
+    memset(world->staticIndices, 0xFF, sizeof(unsigned) * n);  // AC_PHYS_NO_INDEX
+    memset(world->dynamicIndices, 0xFF, sizeof(unsigned) * n);
+
+    copy_words_from_le(world->positions, positions, n * 3);
+    copy_words_from_le(world->velocities, velocities, n * 3);
+    copy_words_from_le(world->masses, masses, n);
+    memcpy(world->previousPositions, world->positions, sizeof(ac_vec3) * n);
+    memcpy(world->generations, generations, sizeof(uint32_t) * n);
+    memcpy(world->staticEntities, staticIds, sizeof(uint32_t) * header.numStaticEntities);
+    memcpy(world->dynamicEntities, dynamicIds, sizeof(uint32_t) * header.numDynamicEntities);
+    for ( uint32_t i = 0; i < header.numStaticEntities; i++ )
+    {
+        world->staticIndices[staticIds[i]] = i;
+    }
+    for ( uint32_t i = 0; i < header.numDynamicEntities; i++ )
+    {
+        world->dynamicIndices[dynamicIds[i]] = i;
+    }
+
+    // queue the free slots so the lowest is reused first
+    for ( size_t i = n; i-- > 0; )
+    {
+        world->alive[i] = header.version < 2 || slotAlive[i] != 0;
+        if ( !world->alive[i] )
+        {
+            world->freeEntities[world->numFreeEntities++] = (unsigned) i;
+        }
+    }
+
+    for ( size_t i = 0; i < n; i++ )
+    {
+        world->sleeping[i] = sleeping[i] != 0;
+
+        uint32_t type = refs[i * 2];
+        if ( type == AC_PHYS_SCENE_NO_COLLIDER )
+        {
+            continue;
+        }
+        world->colliders[i].type = (enum ColliderType) type;
+        world->colliders[i].data = type == SPHERE_C ? (void*) &scene->spheres[refs[i * 2 + 1]]
+                                                    : (void*) &scene->aabbs[refs[i * 2 + 1]];
+        world->numColliders++;
+    }
+
+    if ( header.version >= 3 )
+    {
+        copy_words_from_le(world->orientations, rotations, n * 4);
+        copy_words_from_le(world->angularVelocities, spins, n * 3);
+        copy_words_from_le(world->inverseInertias, inertias, n * 3);
+        copy_words_from_le(&world->friction, friction, 1);
+        copy_words_from_le(&world->rollingFriction, friction + 4, 1);
+    }
+    else
+    {
+        // older scenes leave every entity unrotated and at rest
+        for ( size_t i = 0; i < n; i++ )
+        {
+            world->orientations[i]    = ac_quat_identity();
+            world->inverseInertias[i] = phys_collider_inverse_inertia(&world->colliders[i]);
+        }
+    }
+
+    free(refs);
+    return scene;
+}
+
+PhysScene* phys_scene_load(PhysWorld* world, const char* path)
+{
+    PhysScene* scene = NULL;
+
+#if defined(AC_PHYS_SCENE_MMAP)
+    int fd = open(path, O_RDONLY);
+    if ( fd < 0 )
+    {
+        return NULL;
+    }
+    struct stat info;
+    if ( fstat(fd, &info) == 0 && info.st_size > 0 )
+    {
+        void* data = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if ( data != MAP_FAILED )
+        {
+            scene = phys_scene_load_memory(world, data, (size_t) info.st_size);
+            munmap(data, (size_t) info.st_size);
+        }
+    }
+    close(fd);
+#elif defined(AC_PLATFORM_WINDOWS)
+    HANDLE file = CreateFileA(
+        path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL
+    );
+    if ( file == INVALID_HANDLE_VALUE )
+    {
+        return NULL;
+    }
+    LARGE_INTEGER fileSize;
+    if ( GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0 )
+    {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if ( mapping != NULL )
+        {
+            void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if ( data != NULL )
+            {
+                scene = phys_scene_load_memory(world, data, (size_t) fileSize.QuadPart);
+                UnmapViewOfFile(data);
+            }
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    // a single read of the whole file
+    FILE* file = fopen(path, "rb");
+    if ( file == NULL )
+    {
+        return NULL;
+    }
+    if ( fseek(file, 0, SEEK_END) == 0 )
+    {
+        long fileSize = ftell(file);
+        void* data    = fileSize > 0 ? malloc((size_t) fileSize) : NULL;
+        if ( data != NULL && fseek(file, 0, SEEK_SET) == 0 &&
+             fread(data, 1, (size_t) fileSize, file) == (size_t) fileSize )
+        {
+            scene = phys_scene_load_memory(world, data, (size_t) fileSize);
+        }
+        free(data);
+    }
+    fclose(file);
+#endif
+
+    return scene;
+}
+
+void phys_scene_free(PhysScene* scene)
+{
+    if ( scene == NULL )
+    {
+        return;
+    }
+    free(scene->spheres);
+    free(scene->aabbs);
+    free(scene);
+}
@@ -0,0 +1,124 @@
+/**
+ * \file
+ * \brief Implements saving and restoring the simulated state of a physics world.
+ */
+#include <ace/physics/phys_snapshot.h>
+#include <string.h>
+
+#define AC_PHYS_SNAPSHOT_MAGIC 0x50534341u  // "ACSP"
+
+/**
+ * \brief The header at the start of every snapshot, followed by the per-entity arrays.
+ */
+typedef struct PhysSnapshotHeader
+{
+    uint32_t magic;
+    uint32_t numEnts;
+    float    accumulator;
+    uint32_t size;
+} PhysSnapshotHeader;
+
+size_t phys_world_snapshot_size(const PhysWorld* world)
+{
+    // positions, previous positions, velocities, generations, sleeping and alive flags,
+    // orientations, angular velocities, pending forces and torques, then the convex and manifold
+    // warm starts which change the bits of their contacts
+    return sizeof(PhysSnapshotHeader) + sizeof(ac_vec3) * 3 * world->numEnts +
+           sizeof(uint32_t) * world->numEnts + sizeof(bool) * 2 * world->numEnts +
+           (sizeof(ac_quat) + sizeof(ac_vec3) * 3) * world->numEnts + sizeof(world->convexPairs) +
+           sizeof(world->manifolds);
+}
+
+size_t phys_world_snapshot(const PhysWorld* world, void* buffer, size_t bufferSize)
+{
+    size_t size = phys_world_snapshot_size(world);
+    if ( buffer == NULL || bufferSize < size )
+    {
+        return 0;
+    }
+
+    unsigned           count  = world->numEnts;
+    PhysSnapshotHeader header = { .magic       = AC_PHYS_SNAPSHOT_MAGIC,
+                                  .numEnts     = count,
+                                  .accumulator = world->accumulator,
+                                  .size        = (uint32_t) size };
+
+    unsigned char* out = (unsigned char*) buffer;
+    memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+    memcpy(out, world->positions, sizeof(ac_vec3) * count);
+    out += sizeof(ac_vec3) * count;
+    memcpy(out, world->previousPositions, sizeof(ac_vec3) * count);
+    out += sizeof(ac_vec3) * count;
+    memcpy(out, world->velocities, sizeof(ac_vec3) * count);
+    out += sizeof(ac_vec3) * count;
+    memcpy(out, world->generations, sizeof(uint32_t) * count);
+    out += sizeof(uint32_t) * count;
+    memcpy(out, world->sleeping, sizeof(bool) * count);
+    out += sizeof(bool) * count;
+    memcpy(out, world->alive, sizeof(bool) * count);
+    out += sizeof(bool) * count;
+    memcpy(out, world->orientations, sizeof(ac_quat) * count);
+    out += sizeof(ac_quat) * count;
+    memcpy(out, world->angularVelocities, sizeof(ac_vec3) * count);
+    out += sizeof(ac_vec3) * count;
+    memcpy(out, world->forces, sizeof(ac_vec3) * count);
+    out += sizeof(ac_vec3) * count;
+    memcpy(out, world->torques, sizeof(ac_vec3) * count);
+    out += sizeof(ac_vec3) * count;
+    memcpy(out, world->convexPairs, sizeof(world->convexPairs));
+    out += sizeof(world->convexPairs);
+    memcpy(out, world->manifolds, sizeof(world->manifolds));
+
+    return size;
+}
+
+bool phys_world_restore(PhysWorld* world, const void* buffer, size_t bufferSize)
+{
+    if ( buffer == NULL || bufferSize < sizeof(PhysSnapshotHeader) )
+    {
+        return false;
+    }
+
+    PhysSnapshotHeader header;
+    memcpy(&header, buffer, sizeof(header));
+    if ( header.magic != AC_PHYS_SNAPSHOT_MAGIC || header.numEnts != world->numEnts ||
+         header.size != phys_world_snapshot_size(world) || bufferSize < header.size )
+    {
+        return false;
+    }
+
+    // the same entities must occupy the same slots, which the slot generations capture
+    unsigned             count       = header.numEnts;
+    const unsigned char* in          = (const unsigned char*) buffer + sizeof(header);
+    const unsigned char* generations = in + sizeof(ac_vec3) * 3 * count;
+    const unsigned char* alive       = generations + (sizeof(uint32_t) + sizeof(bool)) * count;
+    if ( memcmp(generations, world->generations, sizeof(uint32_t) * count) != 0 ||
+         memcmp(alive, world->alive, sizeof(bool) * count) != 0 )
+    {
+        return false;
+    }
+
+    memcpy(world->positions, in, sizeof(ac_vec3) * count);
+    in += sizeof(ac_vec3) * count;
+    memcpy(world->previousPositions, in, sizeof(ac_vec3) * count);
+    in += sizeof(ac_vec3) * count;
+    memcpy(world->velocities, in, sizeof(ac_vec3) * count);
+    in += sizeof(ac_vec3) * count + sizeof(uint32_t) * count;
+    memcpy(world->sleeping, in, sizeof(bool) * count);
+    in += sizeof(bool) * 2 * count;
+    memcpy(world->orientations, in, sizeof(ac_quat) * count);
+    in += sizeof(ac_quat) * count;
+    memcpy(world->angularVelocities, in, sizeof(ac_vec3) * count);
+    in += sizeof(ac_vec3) * count;
+    memcpy(world->forces, in, sizeof(ac_vec3) * count);
+    in += sizeof(ac_vec3) * count;
+    memcpy(world->torques, in, sizeof(ac_vec3) * count);
+    in += sizeof(ac_vec3) * count;
+    memcpy(world->convexPairs, in, sizeof(world->convexPairs));
+    in += sizeof(world->convexPairs);
+    memcpy(world->manifolds, in, sizeof(world->manifolds));
+    world->accumulator = header.accumulator;
+
+    return true;
+}
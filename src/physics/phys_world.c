@@ -3,16 +3,41 @@
  * \author Blake Caldwell
  * \brief Implements the physics world.
  */
+#include <ace/math/math.h>
+#include <ace/math/vec3_ext.h>
 #include <ace/physics/phys_collision.h>
 #include <ace/physics/phys_world.h>
+#include <float.h>
+#include <math.h>
 #include <memory.h>
 #include <stdio.h>
+#include <stdlib.h>
+
+// the error id must never be a valid handle
+_Static_assert(
+    AC_MAX_PHYS_ENTS <= (AC_PHYS_ERROR_ENT & AC_PHYS_ENT_INDEX_MASK),
+    "AC_MAX_PHYS_ENTS does not fit in the index bits of an entity handle"
+);
 
 //--------------------------------------------------------------------------------------------------
 // Forward Declarations
 //--------------------------------------------------------------------------------------------------
 
-void update_collisions(PhysWorld* world);
+void step_world(PhysWorld* world, unsigned solverIterations);
+void sort_entity_ids(unsigned* ids, unsigned* listIndices, unsigned count);
+void remove_from_list(unsigned* ids, unsigned* listIndices, unsigned* count, unsigned index);
+bool reserve_entities(PhysWorld* world, unsigned count, unsigned* indices);
+void apply_entity_flags(PhysWorld* world, unsigned index, unsigned flags);
+int  compare_baked_statics(const void* a, const void* b);
+void collide_baked_statics(PhysWorld* world, unsigned entity, bool invokeCallbacks);
+ConvexCache* find_convex_cache(PhysWorld* world, unsigned entity1, unsigned entity2);
+ContactManifold* find_contact_manifold(PhysWorld* world, unsigned entity1, unsigned entity2);
+void collide_pair(
+    PhysWorld* world, unsigned entity1, unsigned entity2, bool static2, bool firstPass
+);
+PhysContactBody contact_body(PhysWorld* world, unsigned entity, bool isStatic);
+void update_collisions(PhysWorld* world, bool invokeCallbacks);
+void invoke_callbacks(PhysWorld* world, unsigned entity1, unsigned entity2);
 void update_movements(PhysWorld* world);
 
 //--------------------------------------------------------------------------------------------------
@@ -21,75 +46,561 @@ void update_movements(PhysWorld* world);
 
 void phys_init_world(PhysWorld* world)
 {
-    world->accumulator        = 0.0f;
-    world->airResistance      = 0.3f;
-    world->gravity            = (ac_vec3){ 0.0f, -9.8f, 0.0f };  // default gravity (9.8f
-    world->numColliders       = 0;
-    world->numDynamicEntities = 0;
-    world->numEnts            = 0;
-    world->numStaticEntities  = 0;
-    world->timeStep           = 1.0f / 120.0f;
-    world->velocityThreshhold = 0.075f;
+    // every per-entity array defaults to zero, the slots that default to something else are
+    // initialised as they are first reserved, so the whole world clears in a single memset
+    memset(world, 0, sizeof(PhysWorld));
+    world->airResistance       = 0.3f;
+    world->gravity             = AC_VEC3_LITERAL(0.0f, -9.8f, 0.0f);  // default gravity (9.8f)
+    world->maxSubSteps         = 8;  // guards against the spiral of death
+    world->minSolverIterations = 1;
+    world->solverIterations    = 1;
+    world->timeStep            = 1.0f / 120.0f;
+    world->velocityThreshhold  = 0.075f;
 
-    for ( unsigned i = 0; i < AC_MAX_PHYS_ENTS; i++ )
+    for ( unsigned i = 0; i < AC_PHYS_CONVEX_CACHE_SIZE; i++ )
+    {
+        world->convexPairs[i].entity1 = AC_PHYS_ERROR_ENT;
+    }
+    for ( unsigned i = 0; i < AC_PHYS_MANIFOLD_CACHE_SIZE; i++ )
     {
-        world->velocities[i] = ac_vec3_zero();  // default velocity (0.0f)
+        world->manifolds[i].entity1 = AC_PHYS_ERROR_ENT;
     }
+}
 
-    for ( unsigned i = 0; i < AC_MAX_PHYS_ENTS; i++ )
+unsigned phys_add_entity(PhysWorld* world, const ac_vec3* position)
+{
+    unsigned index;
+    if ( !reserve_entities(world, 1, &index) )
     {
-        world->masses[i] = 1.0f;  // default mass (1.0f)
+        return AC_PHYS_ERROR_ENT;
     }
 
-    memset(world->positions, 0, sizeof(void*) * AC_MAX_PHYS_ENTS);
-    memset(world->callbacks, 0, sizeof(void*) * AC_MAX_PHYS_ENTS);
-    memset(world->sleeping, 0, sizeof(bool) * AC_MAX_PHYS_ENTS);
-    memset(world->colliders, 0, sizeof(Collider) * AC_MAX_PHYS_ENTS);
-    memset(world->staticEntities, 0, sizeof(unsigned) * AC_MAX_PHYS_ENTS);
-    memset(world->dynamicEntities, 0, sizeof(unsigned) * AC_MAX_PHYS_ENTS);
+    world->positions[index]         = *position;
+    world->previousPositions[index] = *position;
+    world->velocities[index]        = AC_VEC3_ZERO;  // default velocity (0.0f)
+    world->orientations[index]      = ac_quat_identity();
+    world->angularVelocities[index] = AC_VEC3_ZERO;
+    return phys_entity_handle(world, index);
 }
 
-unsigned phys_add_entity(PhysWorld* world, const ac_vec3* position)
+unsigned phys_add_entities(
+    PhysWorld* world, const PhysEntityDesc* descs, unsigned count, unsigned* ids
+)
+{
+    // all or nothing, the slots are reserved up front and the ids double as storage for them
+    unsigned  stackIndices[64];
+    unsigned* indices = ids ? ids : count <= 64 ? stackIndices : malloc(sizeof(unsigned) * count);
+    if ( indices == NULL || !reserve_entities(world, count, indices) )
+    {
+        if ( indices != ids && indices != stackIndices )
+        {
+            free(indices);
+        }
+        return 0;
+    }
+
+    for ( unsigned i = 0; i < count; i++ )
+    {
+        const PhysEntityDesc* desc  = &descs[i];
+        unsigned              index = indices[i];
+
+        world->positions[index]         = desc->position;
+        world->previousPositions[index] = desc->position;
+        world->velocities[index]        = desc->velocity;
+        world->orientations[index]      = ac_quat_identity();
+        world->angularVelocities[index] = AC_VEC3_ZERO;
+        world->masses[index]            = desc->mass > 0.0f ? desc->mass : 1.0f;
+        world->colliders[index]         = desc->collider;
+        world->inverseInertias[index]   = phys_collider_inverse_inertia(&desc->collider);
+        world->callbacks[index]         = desc->callback;
+        world->worldCallbacks[index]    = desc->worldCallback;
+        world->numColliders            += desc->collider.data != NULL;
+        apply_entity_flags(world, index, desc->flags);
+        indices[i] = phys_entity_handle(world, index);
+    }
+
+    if ( indices != ids && indices != stackIndices )
+    {
+        free(indices);
+    }
+    return count;
+}
+
+unsigned phys_add_entities_soa(
+    PhysWorld* world, const PhysEntityStreams* streams, unsigned count, unsigned* ids
+)
+{
+    // the slots are reserved up front as each property is written in its own pass, the ids double
+    // as storage for them
+    unsigned  stackIndices[64];
+    unsigned* indices = ids ? ids : count <= 64 ? stackIndices : malloc(sizeof(unsigned) * count);
+    if ( indices == NULL || !reserve_entities(world, count, indices) )
+    {
+        if ( indices != ids && indices != stackIndices )
+        {
+            free(indices);
+        }
+        return 0;
+    }
+
+    for ( unsigned i = 0; i < count; i++ )
+    {
+        world->positions[indices[i]]         = streams->positions[i];
+        world->previousPositions[indices[i]] = streams->positions[i];
+    }
+    for ( unsigned i = 0; i < count; i++ )
+    {
+        const ac_vec3* velocities            = streams->velocities;
+        world->velocities[indices[i]]        = velocities ? velocities[i] : AC_VEC3_ZERO;
+        world->orientations[indices[i]]      = ac_quat_identity();
+        world->angularVelocities[indices[i]] = AC_VEC3_ZERO;
+    }
+    if ( streams->masses )
+    {
+        for ( unsigned i = 0; i < count; i++ )
+        {
+            world->masses[indices[i]] = streams->masses[i] > 0.0f ? streams->masses[i] : 1.0f;
+        }
+    }
+    if ( streams->colliders )
+    {
+        for ( unsigned i = 0; i < count; i++ )
+        {
+            const Collider* collider             = &streams->colliders[i];
+            world->colliders[indices[i]]         = *collider;
+            world->inverseInertias[indices[i]]   = phys_collider_inverse_inertia(collider);
+            world->numColliders                 += collider->data != NULL;
+        }
+    }
+    if ( streams->callbacks )
+    {
+        for ( unsigned i = 0; i < count; i++ )
+        {
+            world->callbacks[indices[i]] = streams->callbacks[i];
+        }
+    }
+    if ( streams->worldCallbacks )
+    {
+        for ( unsigned i = 0; i < count; i++ )
+        {
+            world->worldCallbacks[indices[i]] = streams->worldCallbacks[i];
+        }
+    }
+    for ( unsigned i = 0; i < count; i++ )
+    {
+        apply_entity_flags(world, indices[i], streams->flags ? streams->flags[i] : 0);
+        indices[i] = phys_entity_handle(world, indices[i]);
+    }
+
+    if ( indices != ids && indices != stackIndices )
+    {
+        free(indices);
+    }
+    return count;
+}
+
+bool phys_remove_entity(PhysWorld* world, unsigned entity)
 {
-    if ( world->numEnts < AC_MAX_PHYS_ENTS )
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return false;
+    }
+
+    unsigned index = phys_entity_index(entity);
+    if ( world->staticIndices[index] != AC_PHYS_NO_INDEX )
     {
-        world->positions[world->numEnts]  = *position;
-        world->velocities[world->numEnts] = ac_vec3_zero();  // default velocity (0.0f)
-        world->numEnts++;  // not the best - if in future i have time [fix]
-        return world->numEnts - 1;
+        world->staticBaked = false;
+    }
+    remove_from_list(
+        world->dynamicEntities,
+        world->dynamicIndices,
+        &world->numDynamicEntities,
+        index
+    );
+    remove_from_list(world->staticEntities, world->staticIndices, &world->numStaticEntities, index);
+    if ( world->colliders[index].data != NULL )
+    {
+        world->numColliders--;
+    }
+
+    // clear the slot so it is reused in the same state as a new one
+    world->positions[index]         = AC_VEC3_ZERO;
+    world->previousPositions[index] = AC_VEC3_ZERO;
+    world->velocities[index]        = AC_VEC3_ZERO;
+    world->orientations[index]      = ac_quat_identity();
+    world->angularVelocities[index] = AC_VEC3_ZERO;
+    world->inverseInertias[index]   = AC_VEC3_ZERO;
+    world->forces[index]            = AC_VEC3_ZERO;
+    world->torques[index]           = AC_VEC3_ZERO;
+    world->masses[index]            = 1.0f;
+    world->colliders[index]         = (Collider){ 0 };
+    world->sleeping[index]          = false;
+    world->callbacks[index]         = NULL;
+    world->worldCallbacks[index]    = NULL;
+    world->alive[index]             = false;
+    world->generations[index]       = (world->generations[index] + 1) & AC_PHYS_ENT_GENERATION_MASK;
+
+    world->freeEntities[world->numFreeEntities++] = index;
+    return true;
+}
+
+bool phys_is_entity_valid(const PhysWorld* world, unsigned entity)
+{
+    unsigned index = phys_entity_index(entity);
+    return index < world->numEnts && world->alive[index] &&
+           world->generations[index] == entity >> AC_PHYS_ENT_INDEX_BITS;
+}
+
+unsigned phys_entity_index(unsigned entity)
+{
+    return entity & AC_PHYS_ENT_INDEX_MASK;
+}
+
+unsigned phys_entity_handle(const PhysWorld* world, unsigned index)
+{
+    return (world->generations[index] << AC_PHYS_ENT_INDEX_BITS) | index;
+}
+
+void phys_set_entity_position(PhysWorld* world, unsigned entity, const ac_vec3* position)
+{
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    unsigned index                  = phys_entity_index(entity);
+    world->positions[index]         = *position;
+    world->previousPositions[index] = *position;
+    if ( world->staticIndices[index] != AC_PHYS_NO_INDEX )
+    {
+        world->staticBaked = false;
     }
-    return AC_PHYS_ERROR_ENT;
 }
 
 void phys_add_entity_collider(PhysWorld* world, Collider collider, unsigned entity)
 {
-    if ( world->numColliders <= world->numEnts && entity <= world->numEnts )
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    // the count only changes when the slot gains its first collider or loses it
+    unsigned index       = phys_entity_index(entity);
+    bool     hadCollider = world->colliders[index].data != NULL;
+    bool     hasCollider = collider.data != NULL;
+    if ( hasCollider && !hadCollider )
     {
-        world->colliders[entity] = collider;
         world->numColliders++;
     }
+    else if ( hadCollider && !hasCollider )
+    {
+        world->numColliders--;
+    }
+
+    world->colliders[index]       = collider;
+    world->inverseInertias[index] = phys_collider_inverse_inertia(&collider);
+    if ( world->staticIndices[index] != AC_PHYS_NO_INDEX )
+    {
+        world->staticBaked = false;
+    }
+}
+
+ac_vec3 phys_collider_inverse_inertia(const Collider* collider)
+{
+    if ( collider->type != SPHERE_C || collider->data == NULL )
+    {
+        return AC_VEC3_ZERO;
+    }
+
+    // a solid sphere, I = 2/5 m r^2
+    float radius  = ((const Sphere*) collider->data)->radius;
+    float inverse = radius > 0.0f ? 2.5f / (radius * radius) : 0.0f;
+    return (ac_vec3){ inverse, inverse, inverse };
+}
+
+void phys_set_entity_inverse_inertia(
+    PhysWorld* world, unsigned entity, const ac_vec3* inverseInertia
+)
+{
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    world->inverseInertias[phys_entity_index(entity)] = *inverseInertia;
 }
 
 void phys_make_entity_dynamic(PhysWorld* world, unsigned entity)
 {
-    world->dynamicEntities[world->numDynamicEntities] = entity;
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    unsigned index = phys_entity_index(entity);
+    if ( world->dynamicIndices[index] != AC_PHYS_NO_INDEX )
+    {
+        return;  // already dynamic
+    }
+    world->dynamicIndices[index]                      = world->numDynamicEntities;
+    world->dynamicEntities[world->numDynamicEntities] = index;
     world->numDynamicEntities++;
 }
 
 void phys_make_entity_static(PhysWorld* world, unsigned entity)
 {
-    world->staticEntities[world->numStaticEntities] = entity;
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    unsigned index = phys_entity_index(entity);
+    if ( world->staticIndices[index] != AC_PHYS_NO_INDEX )
+    {
+        return;  // already static
+    }
+    world->staticIndices[index]                     = world->numStaticEntities;
+    world->staticEntities[world->numStaticEntities] = index;
     world->numStaticEntities++;
+    world->staticBaked = false;
 }
 
 void phys_add_collision_callback(PhysWorld* world, unsigned entity, PhysCallBack callback)
 {
-    world->callbacks[entity] = callback;
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    world->callbacks[phys_entity_index(entity)] = callback;
+}
+
+void phys_add_world_collision_callback(
+    PhysWorld* world, unsigned entity, PhysWorldCallBack callback
+)
+{
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    world->worldCallbacks[phys_entity_index(entity)] = callback;
 }
 
 void phys_sleep_entity(PhysWorld* world, unsigned entity, bool sleep)
 {
-    world->sleeping[entity] = sleep;
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    world->sleeping[phys_entity_index(entity)] = sleep;
+}
+
+void phys_apply_force(PhysWorld* world, unsigned entity, const ac_vec3* force)
+{
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    unsigned index = phys_entity_index(entity);
+    if ( world->dynamicIndices[index] != AC_PHYS_NO_INDEX )
+    {
+        world->forces[index]   = ac_vec3_add(&world->forces[index], force);
+        world->sleeping[index] = false;
+    }
+}
+
+void phys_apply_force_at_point(
+    PhysWorld* world, unsigned entity, const ac_vec3* force, const ac_vec3* point
+)
+{
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    unsigned index = phys_entity_index(entity);
+    if ( world->dynamicIndices[index] != AC_PHYS_NO_INDEX )
+    {
+        ac_vec3 offset         = ac_vec3_sub(point, &world->positions[index]);
+        ac_vec3 torque         = ac_vec3_cross(&offset, force);
+        world->forces[index]   = ac_vec3_add(&world->forces[index], force);
+        world->torques[index]  = ac_vec3_add(&world->torques[index], &torque);
+        world->sleeping[index] = false;
+    }
+}
+
+void phys_apply_impulse(PhysWorld* world, unsigned entity, const ac_vec3* impulse)
+{
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    unsigned index = phys_entity_index(entity);
+    if ( world->dynamicIndices[index] != AC_PHYS_NO_INDEX )
+    {
+        ac_vec3 delta_velocity   = ac_vec3_scale(impulse, 1.0f / world->masses[index]);
+        world->velocities[index] = ac_vec3_add(&world->velocities[index], &delta_velocity);
+        world->sleeping[index]   = false;
+    }
+}
+
+void phys_apply_impulse_at_point(
+    PhysWorld* world, unsigned entity, const ac_vec3* impulse, const ac_vec3* point
+)
+{
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return;
+    }
+
+    unsigned index = phys_entity_index(entity);
+    if ( world->dynamicIndices[index] != AC_PHYS_NO_INDEX )
+    {
+        PhysContactBody body    = contact_body(world, index, false);
+        ac_vec3         offset  = ac_vec3_sub(point, &world->positions[index]);
+        ac_vec3         angular = ac_vec3_cross(&offset, impulse);
+        ac_vec3         spin    = apply_inverse_inertia(&body, &angular);
+
+        world->angularVelocities[index] = ac_vec3_add(&world->angularVelocities[index], &spin);
+        phys_apply_impulse(world, entity, impulse);
+    }
+}
+
+void phys_apply_forces(
+    PhysWorld* world, const unsigned* entities, const ac_vec3* forces, unsigned count
+)
+{
+    for ( unsigned i = 0; i < count; i++ )
+    {
+        phys_apply_force(world, entities[i], &forces[i]);
+    }
+}
+
+void phys_apply_impulses(
+    PhysWorld* world, const unsigned* entities, const ac_vec3* impulses, unsigned count
+)
+{
+    for ( unsigned i = 0; i < count; i++ )
+    {
+        phys_apply_impulse(world, entities[i], &impulses[i]);
+    }
+}
+
+bool phys_bake_static(PhysWorld* world)
+{
+    world->staticBaked     = false;
+    world->numBakedStatics = 0;
+    world->bakedMaxWidth   = 0.0f;
+
+    for ( unsigned i = 0; i < world->numStaticEntities; i++ )
+    {
+        unsigned        index    = world->staticEntities[i];
+        const Collider* collider = &world->colliders[index];
+        if ( collider->data == NULL )
+        {
+            continue;
+        }
+
+        PhysBakedStatic* baked = &world->bakedStatics[world->numBakedStatics++];
+        baked->center          = world->positions[index];
+        baked->entity          = index;
+        baked->type            = collider->type;
+        switch ( collider->type )
+        {
+        case SPHERE_C: {
+            float radius       = ((const Sphere*) collider->data)->radius;
+            baked->halfExtents = (ac_vec3){ radius, radius, radius };
+            break;
+        }
+        case AABB_C:
+            baked->halfExtents = ((const AABB*) collider->data)->half_extents;
+            break;
+        case MESH_C: {
+            // the bounds are used to cull, the mesh itself is tested through its collider
+            const TriangleMesh* mesh = (const TriangleMesh*) collider->data;
+            ac_vec3             mid  = ac_vec3_add(&mesh->boundsMin, &mesh->boundsMax);
+            mid                      = ac_vec3_scale(&mid, 0.5f);
+            baked->center            = ac_vec3_add(&baked->center, &mid);
+            baked->halfExtents       = ac_vec3_sub(&mesh->boundsMax, &mid);
+            break;
+        }
+        case HEIGHTFIELD_C: {
+            const Heightfield* heightfield = (const Heightfield*) collider->data;
+            ac_vec3            halfExtents = {
+                0.5f * (float) (heightfield->numX - 1) * heightfield->cellSize,
+                0.5f * (heightfield->maxHeight - heightfield->minHeight),
+                0.5f * (float) (heightfield->numZ - 1) * heightfield->cellSize
+            };
+            ac_vec3 mid = { halfExtents.x, heightfield->minHeight + halfExtents.y, halfExtents.z };
+            baked->center      = ac_vec3_add(&baked->center, &mid);
+            baked->halfExtents = halfExtents;
+            break;
+        }
+        case CONVEX_C: {
+            // the bounds of the shape from its support points along each axis
+            ac_vec3 min, max;
+            for ( int axis = 0; axis < 3; axis++ )
+            {
+                ac_vec3 direction    = AC_VEC3_ZERO;
+                direction.data[axis] = 1.0f;
+                ac_vec3 upper        = collider_support(collider, &baked->center, &direction);
+                direction.data[axis] = -1.0f;
+                ac_vec3 lower        = collider_support(collider, &baked->center, &direction);
+                max.data[axis]       = upper.data[axis];
+                min.data[axis]       = lower.data[axis];
+            }
+            baked->center      = ac_vec3_add(&min, &max);
+            baked->center      = ac_vec3_scale(&baked->center, 0.5f);
+            baked->halfExtents = ac_vec3_sub(&max, &baked->center);
+            break;
+        }
+        default:
+            // planes are unbounded and cannot be culled along x
+            world->numBakedStatics = 0;
+            return false;
+        }
+
+        // slightly widened so rounding can never cull a touching collider
+        float width          = 2.0f * baked->halfExtents.x * (1.0f + 4.0f * FLT_EPSILON);
+        world->bakedMaxWidth = width > world->bakedMaxWidth ? width : world->bakedMaxWidth;
+    }
+
+    qsort(
+        world->bakedStatics,
+        world->numBakedStatics,
+        sizeof(PhysBakedStatic),
+        compare_baked_statics
+    );
+    world->staticBaked = true;
+    return true;
+}
+
+uint64_t phys_world_hash(const PhysWorld* world)
+{
+    // FNV-1a over 32-bit words, hashing values rather than bytes keeps it endian independent
+    static const uint64_t offsetBasis = 14695981039346656037ULL;
+    static const uint64_t prime       = 1099511628211ULL;
+
+    uint64_t hash = offsetBasis;
+    hash          = (hash ^ world->numEnts) * prime;
+    for ( unsigned i = 0; i < world->numEnts; i++ )
+    {
+        uint32_t words[13];
+        memcpy(&words[0], world->positions[i].data, sizeof(float) * 3);
+        memcpy(&words[3], world->velocities[i].data, sizeof(float) * 3);
+        memcpy(&words[6], world->orientations[i].data, sizeof(float) * 4);
+        memcpy(&words[10], world->angularVelocities[i].data, sizeof(float) * 3);
+        for ( unsigned w = 0; w < 13; w++ )
+        {
+            hash = (hash ^ words[w]) * prime;
+        }
+        hash = (hash ^ (uint64_t) world->sleeping[i]) * prime;
+    }
+    return hash;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -100,18 +611,183 @@ void phys_update(PhysWorld* world, float deltaTime)
 {
     world->accumulator += deltaTime;
 
-    while ( world->accumulator >= world->timeStep )
+    // when behind, spread the available work over the steps that are due
+    unsigned iterations = world->solverIterations;
+    if ( world->adaptiveSolver )
     {
-        update_movements(world);
-        update_collisions(world);
+        float dueSteps = world->accumulator / world->timeStep;
+        if ( dueSteps > 1.0f )
+        {
+            iterations = (unsigned) ((float) iterations / dueSteps);
+        }
+        if ( iterations < world->minSolverIterations )
+        {
+            iterations = world->minSolverIterations;
+        }
+    }
+
+    unsigned subSteps = 0;
+    while ( world->accumulator >= world->timeStep &&
+            (world->maxSubSteps == 0 || subSteps < world->maxSubSteps) )
+    {
+        step_world(world, iterations);
         world->accumulator -= world->timeStep;
+        subSteps++;
     }
+
+    // drop whole steps that could not be taken, keeping the remainder for interpolation
+    float droppedTime = 0.0f;
+    if ( world->accumulator >= world->timeStep )
+    {
+        droppedTime         = world->accumulator - fmodf(world->accumulator, world->timeStep);
+        world->accumulator -= droppedTime;
+        world->stats.droppedUpdates++;
+    }
+
+    world->stats.subSteps          = subSteps;
+    world->stats.solverIterations  = iterations;
+    world->stats.droppedTime       = droppedTime;
+    world->stats.totalDroppedTime += droppedTime;
 }
 
-void update_collisions(PhysWorld* world)
+void phys_step(PhysWorld* world)
 {
-    IntersectionResult result;
+    step_world(world, world->solverIterations);
+}
+
+float phys_get_interpolation_alpha(const PhysWorld* world)
+{
+    return ac_clamp(world->accumulator / world->timeStep, 0.0f, 1.0f);
+}
+
+ac_vec3 phys_get_interpolated_position(const PhysWorld* world, unsigned entity)
+{
+    if ( !phys_is_entity_valid(world, entity) )
+    {
+        return ac_vec3_nan();
+    }
+
+    unsigned index = phys_entity_index(entity);
+    return ac_vec3_lerp(
+        &world->previousPositions[index],
+        &world->positions[index],
+        phys_get_interpolation_alpha(world)
+    );
+}
 
+void phys_get_interpolated_positions(const PhysWorld* world, ac_vec3* positions)
+{
+    float alpha = phys_get_interpolation_alpha(world);
+    for ( unsigned i = 0; i < world->numEnts; i++ )
+    {
+        const ac_vec3* previous = &world->previousPositions[i];
+        const ac_vec3* current  = &world->positions[i];
+        positions[i].x          = previous->x + (current->x - previous->x) * alpha;
+        positions[i].y          = previous->y + (current->y - previous->y) * alpha;
+        positions[i].z          = previous->z + (current->z - previous->z) * alpha;
+    }
+}
+
+void step_world(PhysWorld* world, unsigned solverIterations)
+{
+#ifdef AC_DETERMINISTIC
+    // visit entities in id order so results do not depend on registration order
+    sort_entity_ids(world->dynamicEntities, world->dynamicIndices, world->numDynamicEntities);
+    sort_entity_ids(world->staticEntities, world->staticIndices, world->numStaticEntities);
+#endif
+
+    memcpy(world->previousPositions, world->positions, sizeof(ac_vec3) * world->numEnts);
+    update_movements(world);
+    memset(world->forces, 0, sizeof(ac_vec3) * world->numEnts);
+    memset(world->torques, 0, sizeof(ac_vec3) * world->numEnts);
+
+    // callbacks are only raised once per contact, on the first pass
+    for ( unsigned i = 0; i < solverIterations; i++ )
+    {
+        update_collisions(world, i == 0);
+    }
+}
+
+void sort_entity_ids(unsigned* ids, unsigned* listIndices, unsigned count)
+{
+    // insertion sort, the lists are almost always already sorted
+    for ( unsigned i = 1; i < count; i++ )
+    {
+        unsigned id = ids[i];
+        unsigned j  = i;
+        while ( j > 0 && ids[j - 1] > id )
+        {
+            ids[j]                  = ids[j - 1];
+            listIndices[ids[j - 1]] = j;
+            j--;
+        }
+        ids[j]          = id;
+        listIndices[id] = j;
+    }
+}
+
+bool reserve_entities(PhysWorld* world, unsigned count, unsigned* indices)
+{
+    if ( count > world->numFreeEntities + (AC_MAX_PHYS_ENTS - world->numEnts) )
+    {
+        return false;
+    }
+
+    // reuse the most recently freed slots before growing
+    for ( unsigned i = 0; i < count; i++ )
+    {
+        unsigned index;
+        if ( world->numFreeEntities > 0 )
+        {
+            index = world->freeEntities[--world->numFreeEntities];
+        }
+        else
+        {
+            // a slot used for the first time only holds the zeroes from phys_init_world, a freed
+            // one was already reset by phys_remove_entity
+            index                        = world->numEnts++;
+            world->orientations[index]   = ac_quat_identity();
+            world->masses[index]         = 1.0f;  // default mass (1.0f)
+            world->staticIndices[index]  = AC_PHYS_NO_INDEX;
+            world->dynamicIndices[index] = AC_PHYS_NO_INDEX;
+        }
+        world->alive[index] = true;
+        indices[i]          = index;
+    }
+    return true;
+}
+
+void apply_entity_flags(PhysWorld* world, unsigned index, unsigned flags)
+{
+    if ( flags & AC_PHYS_ENT_DYNAMIC )
+    {
+        phys_make_entity_dynamic(world, phys_entity_handle(world, index));
+    }
+    if ( flags & AC_PHYS_ENT_STATIC )
+    {
+        phys_make_entity_static(world, phys_entity_handle(world, index));
+    }
+    world->sleeping[index] = (flags & AC_PHYS_ENT_SLEEPING) != 0;
+}
+
+void remove_from_list(unsigned* ids, unsigned* listIndices, unsigned* count, unsigned index)
+{
+    unsigned position = listIndices[index];
+    if ( position == AC_PHYS_NO_INDEX )
+    {
+        return;
+    }
+
+    // swap the last entry into the hole
+    unsigned last      = ids[*count - 1];
+    ids[position]      = last;
+    listIndices[last]  = position;
+    listIndices[index] = AC_PHYS_NO_INDEX;
+    (*count)--;
+}
+
+void update_collisions(PhysWorld* world, bool invokeCallbacks)
+{
     unsigned entity1 = 0, entity2 = 0;
     for ( unsigned i = 0; i < world->numDynamicEntities; i++ )
     {
@@ -130,35 +806,15 @@ void update_collisions(PhysWorld* world)
                 continue;
             }
 
-            result = check_collision(
-                &world->colliders[entity1],
-                &world->positions[entity1],
-                &world->colliders[entity2],
-                &world->positions[entity2]
-            );
-            if ( result.intersected )
-            {
-                resolve_collision(
-                    &result,
-                    &world->positions[entity1],
-                    &world->velocities[entity1],
-                    world->masses[entity1],
-                    false,
-                    &world->positions[entity2],
-                    &world->velocities[entity2],
-                    world->masses[entity2],
-                    false
-                );
-
-                if ( world->callbacks[entity1] )
-                    world->callbacks[entity1](entity1, entity2);
-
-                if ( world->callbacks[entity2] )
-                    world->callbacks[entity2](entity1, entity2);
-            }
+            collide_pair(world, entity1, entity2, false, invokeCallbacks);
         }
 
         // check collisions between dynamic and static colliders
+        if ( world->staticBaked )
+        {
+            collide_baked_statics(world, entity1, invokeCallbacks);
+            continue;
+        }
         for ( unsigned j = 0; j < world->numStaticEntities; j++ )
         {
             entity2 = world->staticEntities[j];
@@ -167,36 +823,241 @@ void update_collisions(PhysWorld* world)
                 continue;
             }
 
-            result = check_collision(
-                &world->colliders[entity1],
-                &world->positions[entity1],
-                &world->colliders[entity2],
-                &world->positions[entity2]
+            collide_pair(world, entity1, entity2, true, invokeCallbacks);
+        }
+    }
+}
+
+int compare_baked_statics(const void* a, const void* b)
+{
+    const PhysBakedStatic* bakedA = (const PhysBakedStatic*) a;
+    const PhysBakedStatic* bakedB = (const PhysBakedStatic*) b;
+    float                  minA   = bakedA->center.x - bakedA->halfExtents.x;
+    float                  minB   = bakedB->center.x - bakedB->halfExtents.x;
+    if ( minA != minB )
+    {
+        return minA < minB ? -1 : 1;
+    }
+    return bakedA->entity < bakedB->entity ? -1 : (bakedA->entity > bakedB->entity);
+}
+
+void collide_baked_statics(PhysWorld* world, unsigned entity, bool invokeCallbacks)
+{
+    Collider* collider = &world->colliders[entity];
+    ac_vec3*  position = &world->positions[entity];
+    if ( collider->data == NULL )
+    {
+        return;
+    }
+
+    IntersectionResult result;
+    if ( collider->type != SPHERE_C )
+    {
+        // no specialised kernel, fall back to the general dispatch
+        for ( unsigned i = 0; i < world->numBakedStatics; i++ )
+        {
+            unsigned other = world->bakedStatics[i].entity;
+            if ( world->sleeping[other] )
+            {
+                continue;
+            }
+
+            collide_pair(world, entity, other, true, invokeCallbacks);
+        }
+        return;
+    }
+
+    // binary search for the first static that can reach the sphere, no collider is wider than
+    // bakedMaxWidth so any starting further left ends before the sphere
+    float    radius = ((const Sphere*) collider->data)->radius;
+    float    reach  = position->x - radius - world->bakedMaxWidth;
+    unsigned low = 0, high = world->numBakedStatics;
+    while ( low < high )
+    {
+        unsigned               mid   = low + (high - low) / 2;
+        const PhysBakedStatic* baked = &world->bakedStatics[mid];
+        if ( baked->center.x - baked->halfExtents.x < reach )
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    for ( unsigned i = low; i < world->numBakedStatics; i++ )
+    {
+        const PhysBakedStatic* baked = &world->bakedStatics[i];
+        if ( baked->center.x - baked->halfExtents.x > position->x + radius )
+        {
+            break;  // every remaining static starts beyond the sphere
+        }
+        if ( world->sleeping[baked->entity] )
+        {
+            continue;
+        }
+
+        switch ( baked->type )
+        {
+        case SPHERE_C:
+            result = sphere_baked_sphere(position, radius, baked);
+            break;
+        case AABB_C:
+            result = sphere_baked_AABB(position, radius, baked);
+            break;
+        default:
+            // other shapes are only culled here
+            result = check_collision_cached(
+                collider,
+                position,
+                &world->colliders[baked->entity],
+                &world->positions[baked->entity],
+                find_convex_cache(world, entity, baked->entity)
             );
-            if ( result.intersected )
+            break;
+        }
+        if ( result.intersected )
+        {
+            PhysContactBody body1 = contact_body(world, entity, false);
+            PhysContactBody body2 = contact_body(world, baked->entity, true);
+            resolve_collision(
+                &result,
+                &body1,
+                &body2,
+                world->friction,
+                world->rollingFriction
+            );
+
+            if ( invokeCallbacks )
             {
-                resolve_collision(
-                    &result,
-                    &world->positions[entity1],
-                    &world->velocities[entity1],
-                    world->masses[entity1],
-                    false,
-                    &world->positions[entity2],
-                    &world->velocities[entity2],
-                    world->masses[entity2],
-                    true
-                );
-
-                if ( world->callbacks[entity1] )
-                    world->callbacks[entity1](entity1, entity2);
-
-                if ( world->callbacks[entity2] )
-                    world->callbacks[entity2](entity1, entity2);
+                invoke_callbacks(world, entity, baked->entity);
             }
         }
     }
 }
 
+ConvexCache* find_convex_cache(PhysWorld* world, unsigned entity1, unsigned entity2)
+{
+    if ( world->colliders[entity1].type != CONVEX_C && world->colliders[entity2].type != CONVEX_C )
+    {
+        return NULL;
+    }
+
+    // keyed by handle so a reused slot never inherits a removed entity's simplex
+    unsigned        handle1 = phys_entity_handle(world, entity1);
+    unsigned        handle2 = phys_entity_handle(world, entity2);
+    unsigned        hash    = (handle1 * 2654435761u) ^ (handle2 * 2246822519u);
+    PhysConvexPair* pair    = &world->convexPairs[hash % AC_PHYS_CONVEX_CACHE_SIZE];
+    if ( pair->entity1 != handle1 || pair->entity2 != handle2 )
+    {
+        pair->entity1     = handle1;
+        pair->entity2     = handle2;
+        pair->cache.count = 0;
+    }
+    return &pair->cache;
+}
+
+ContactManifold* find_contact_manifold(PhysWorld* world, unsigned entity1, unsigned entity2)
+{
+    if ( !uses_contact_manifold(&world->colliders[entity1], &world->colliders[entity2]) )
+    {
+        return NULL;
+    }
+
+    // keyed by handle as find_convex_cache
+    unsigned          handle1 = phys_entity_handle(world, entity1);
+    unsigned          handle2 = phys_entity_handle(world, entity2);
+    unsigned          hash    = (handle1 * 2654435761u) ^ (handle2 * 2246822519u);
+    PhysManifoldPair* pair    = &world->manifolds[hash % AC_PHYS_MANIFOLD_CACHE_SIZE];
+    if ( pair->entity1 != handle1 || pair->entity2 != handle2 )
+    {
+        pair->entity1            = handle1;
+        pair->entity2            = handle2;
+        pair->manifold.numPoints = 0;
+    }
+    return &pair->manifold;
+}
+
+void collide_pair(
+    PhysWorld* world, unsigned entity1, unsigned entity2, bool static2, bool firstPass
+)
+{
+    PhysContactBody  body1      = contact_body(world, entity1, false);
+    PhysContactBody  body2      = contact_body(world, entity2, static2);
+    ContactManifold* persistent = find_contact_manifold(world, entity1, entity2);
+    if ( persistent != NULL )
+    {
+        ContactManifold fresh;
+        if ( !check_manifold(
+                 &world->colliders[entity1],
+                 &world->positions[entity1],
+                 &world->colliders[entity2],
+                 &world->positions[entity2],
+                 &fresh
+             ) )
+        {
+            persistent->numPoints = 0;
+            return;
+        }
+
+        // every pass carries the impulses forward, only the first applies them again
+        contact_manifold_merge(persistent, &fresh);
+        resolve_manifold(persistent, &body1, &body2, firstPass);
+    }
+    else
+    {
+        IntersectionResult result = check_collision_cached(
+            &world->colliders[entity1],
+            &world->positions[entity1],
+            &world->colliders[entity2],
+            &world->positions[entity2],
+            find_convex_cache(world, entity1, entity2)
+        );
+        if ( !result.intersected )
+        {
+            return;
+        }
+
+        resolve_collision(&result, &body1, &body2, world->friction, world->rollingFriction);
+    }
+
+    if ( firstPass )
+    {
+        invoke_callbacks(world, entity1, entity2);
+    }
+}
+
+PhysContactBody contact_body(PhysWorld* world, unsigned entity, bool isStatic)
+{
+    return (PhysContactBody){ .position        = &world->positions[entity],
+                              .velocity        = &world->velocities[entity],
+                              .angularVelocity = &world->angularVelocities[entity],
+                              .orientation     = &world->orientations[entity],
+                              .inverseInertia  = world->inverseInertias[entity],
+                              .mass            = world->masses[entity],
+                              .isStatic        = isStatic };
+}
+
+void invoke_callbacks(PhysWorld* world, unsigned entity1, unsigned entity2)
+{
+    // callbacks are given handles, the arguments are slot indices
+    unsigned handle1 = phys_entity_handle(world, entity1);
+    unsigned handle2 = phys_entity_handle(world, entity2);
+
+    if ( world->callbacks[entity1] )
+        world->callbacks[entity1](handle1, handle2);
+
+    if ( world->callbacks[entity2] )
+        world->callbacks[entity2](handle1, handle2);
+
+    if ( world->worldCallbacks[entity1] )
+        world->worldCallbacks[entity1](world, handle1, handle2);
+
+    if ( world->worldCallbacks[entity2] )
+        world->worldCallbacks[entity2](world, handle1, handle2);
+}
+
 void update_movements(PhysWorld* world)
 {
     // semi implicit euler
@@ -209,7 +1070,11 @@ void update_movements(PhysWorld* world)
             continue;
         }
 
-        ac_vec3 delta_velocity = ac_vec3_scale(&world->gravity, world->timeStep);
+        // the accumulated force is applied alongside gravity
+        float   inverseMass    = 1.0f / world->masses[entityIndex];
+        ac_vec3 acceleration   = ac_vec3_scale(&world->forces[entityIndex], inverseMass);
+        acceleration           = ac_vec3_add(&acceleration, &world->gravity);
+        ac_vec3 delta_velocity = ac_vec3_scale(&acceleration, world->timeStep);
         world->velocities[entityIndex] =
             ac_vec3_add(&world->velocities[entityIndex], &delta_velocity);
         world->velocities[entityIndex] = ac_vec3_scale(
@@ -223,7 +1088,29 @@ void update_movements(PhysWorld* world)
         //  if under the speed threshold, set velocity to 0
         if ( ac_vec3_magnitude(&world->velocities[entityIndex]) < world->velocityThreshhold )
         {
-            world->velocities[entityIndex] = ac_vec3_zero();
+            world->velocities[entityIndex] = AC_VEC3_ZERO;
+        }
+
+        // torque drives the spin, which is damped by the air and integrated the same way
+        ac_vec3* spin   = &world->angularVelocities[entityIndex];
+        ac_vec3* torque = &world->torques[entityIndex];
+        if ( torque->x != 0.0f || torque->y != 0.0f || torque->z != 0.0f )
+        {
+            PhysContactBody body  = contact_body(world, entityIndex, false);
+            ac_vec3         delta = apply_inverse_inertia(&body, torque);
+            delta                 = ac_vec3_scale(&delta, world->timeStep);
+            *spin                 = ac_vec3_add(spin, &delta);
+        }
+        if ( spin->x == 0.0f && spin->y == 0.0f && spin->z == 0.0f )
+        {
+            continue;
+        }
+        *spin = ac_vec3_scale(spin, 1.0f - (world->airResistance * world->timeStep));
+        world->orientations[entityIndex] =
+            ac_quat_integrate(&world->orientations[entityIndex], spin, world->timeStep);
+        if ( ac_vec3_magnitude(spin) < world->velocityThreshhold )
+        {
+            *spin = AC_VEC3_ZERO;
         }
     }
 }
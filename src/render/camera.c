@@ -134,6 +134,12 @@ ac_vec3 ac_camera_get_up(const ac_camera* cam)
     return cam->up;
 }
 
+ac_mat4 ac_camera_get_view_matrix(const ac_camera* cam)
+{
+    ac_vec3 target = ac_vec3_add(&cam->position, &cam->front);
+    return ac_mat4_look_at(&cam->position, &target, &cam->up);
+}
+
 float ac_camera_get_yaw(const ac_camera* cam)
 {
     return cam->yaw;
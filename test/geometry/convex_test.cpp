@@ -0,0 +1,138 @@
+#include <ace/geometry/convex.h>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+const ac_vec3 cube_points[] = {
+    { { -0.5f, -0.5f, -0.5f } },
+    { { 0.5f, -0.5f, -0.5f } },
+    { { -0.5f, 0.5f, -0.5f } },
+    { { 0.5f, 0.5f, -0.5f } },
+    { { -0.5f, -0.5f, 0.5f } },
+    { { 0.5f, -0.5f, 0.5f } },
+    { { -0.5f, 0.5f, 0.5f } },
+    { { 0.5f, 0.5f, 0.5f } }
+};
+ConvexHull cube_hull   = { cube_points, 8 };
+Convex     cube_convex = { convex_hull_support, &cube_hull };
+
+}  // namespace
+
+TEST_CASE( "convex support functions", "[convex]" ) {
+    Cylinder cylinder  = { 0.5f, 1.0f };
+    Cone     cone      = { 0.5f, 1.0f };
+    ac_vec3  direction = { { 1.0f, 0.1f, 0.0f } };
+
+    ac_vec3 point = cylinder_support(&cylinder, &direction);
+    REQUIRE_THAT(point.x, WithinAbs(0.5f, 1e-6f));
+    REQUIRE_THAT(point.y, WithinAbs(1.0f, 1e-6f));
+
+    point = cone_support(&cone, &direction);
+    REQUIRE_THAT(point.x, WithinAbs(0.5f, 1e-6f));
+    REQUIRE_THAT(point.y, WithinAbs(-1.0f, 1e-6f));
+
+    direction = { { 0.1f, 1.0f, 0.0f } };
+    point     = cone_support(&cone, &direction);
+    REQUIRE_THAT(point.x, WithinAbs(0.0f, 1e-6f));
+    REQUIRE_THAT(point.y, WithinAbs(1.0f, 1e-6f));
+
+    direction = { { 1.0f, 1.0f, 1.0f } };
+    point     = convex_hull_support(&cube_hull, &direction);
+    REQUIRE(ac_vec3_is_equal(&point, &cube_points[7]));
+}
+
+TEST_CASE( "convex_intersect", "[convex]" ) {
+    Sphere   sphere         = { 0.5f };
+    Collider sphereCollider = { SPHERE_C, &sphere };
+    Collider cubeCollider   = { CONVEX_C, &cube_convex };
+
+    SECTION( "matches sphere_sphere" ) {
+        ac_vec3            p1       = { { 0.0f, 0.0f, 0.0f } };
+        ac_vec3            p2       = { { 0.6f, 0.3f, 0.0f } };
+        IntersectionResult expected = sphere_sphere(&sphereCollider, &p1, &sphereCollider, &p2);
+        IntersectionResult result =
+            convex_intersect(&sphereCollider, &p1, &sphereCollider, &p2, nullptr);
+        REQUIRE(result.intersected);
+        REQUIRE_THAT(result.penetrationDepth, WithinAbs(expected.penetrationDepth, 1e-3f));
+        REQUIRE_THAT(result.contactNormal.x, WithinAbs(expected.contactNormal.x, 1e-2f));
+        REQUIRE_THAT(result.contactNormal.y, WithinAbs(expected.contactNormal.y, 1e-2f));
+    }
+
+    SECTION( "cube resting on a box" ) {
+        AABB     floor         = { { 2.0f, 0.5f, 2.0f } };
+        Collider floorCollider = { AABB_C, &floor };
+        ac_vec3  p1            = { { 0.2f, 0.9f, -0.3f } };
+        ac_vec3  p2            = { { 0.0f, 0.0f, 0.0f } };
+
+        IntersectionResult result =
+            convex_intersect(&cubeCollider, &p1, &floorCollider, &p2, nullptr);
+        REQUIRE(result.intersected);
+        REQUIRE_THAT(result.penetrationDepth, WithinAbs(0.1f, 1e-4f));
+        REQUIRE_THAT(result.contactNormal.y, WithinAbs(-1.0f, 1e-4f));
+        REQUIRE_THAT(result.contactPoint.y, WithinAbs(0.4f, 1e-4f));
+    }
+
+    SECTION( "separated and touching" ) {
+        ac_vec3 p1 = { { 0.0f, 0.0f, 0.0f } };
+        ac_vec3 p2 = { { 1.01f, 0.0f, 0.0f } };
+        REQUIRE_FALSE(
+            convex_intersect(&cubeCollider, &p1, &sphereCollider, &p2, nullptr).intersected
+        );
+        REQUIRE_FALSE(convex_convex(&cubeCollider, &p1, &cubeCollider, &p2).intersected);
+    }
+
+    SECTION( "warm starts from the previous simplex" ) {
+        ConvexCache cache = {};
+        ac_vec3     p1    = { { 0.0f, 0.0f, 0.0f } };
+        ac_vec3     p2    = { { 0.7f, 0.8f, 0.1f } };
+        REQUIRE(convex_intersect(&cubeCollider, &p1, &sphereCollider, &p2, &cache).intersected);
+        REQUIRE(cache.count > 0);
+
+        for ( int frame = 0; frame < 10; frame++ )
+        {
+            p2.x -= 0.005f;
+            IntersectionResult result =
+                convex_intersect(&cubeCollider, &p1, &sphereCollider, &p2, &cache);
+            REQUIRE(result.intersected);
+            REQUIRE(cache.iterations <= 2);
+        }
+
+        // separated pairs converge just as quickly
+        p2 = { { 2.0f, 0.3f, 0.0f } };
+        REQUIRE_FALSE(
+            convex_intersect(&cubeCollider, &p1, &sphereCollider, &p2, &cache).intersected
+        );
+        for ( int frame = 0; frame < 10; frame++ )
+        {
+            p2.y += 0.005f;
+            REQUIRE_FALSE(
+                convex_intersect(&cubeCollider, &p1, &sphereCollider, &p2, &cache).intersected
+            );
+            REQUIRE(cache.iterations <= 2);
+        }
+    }
+}
+
+TEST_CASE( "convex_intersect benchmark", "[.][benchmark][convex]" ) {
+    Cylinder    cylinder         = { 0.5f, 0.5f };
+    Convex      cylinderConvex   = { cylinder_support, &cylinder };
+    Collider    cylinderCollider = { CONVEX_C, &cylinderConvex };
+    Collider    cubeCollider     = { CONVEX_C, &cube_convex };
+    ac_vec3     p1               = { { 0.0f, 0.0f, 0.0f } };
+    ac_vec3     p2               = { { 0.7f, 0.8f, 0.1f } };
+    ConvexCache cache            = {};
+
+    BENCHMARK( "convex_intersect cold" )
+    {
+        return convex_intersect(&cubeCollider, &p1, &cylinderCollider, &p2, nullptr);
+    };
+    BENCHMARK( "convex_intersect warm" )
+    {
+        return convex_intersect(&cubeCollider, &p1, &cylinderCollider, &p2, &cache);
+    };
+}
@@ -0,0 +1,179 @@
+#include <ace/geometry/manifold.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+const ac_vec3 identity[3] = {
+    { { 1.0f, 0.0f, 0.0f } },
+    { { 0.0f, 1.0f, 0.0f } },
+    { { 0.0f, 0.0f, 1.0f } }
+};
+
+}  // namespace
+
+TEST_CASE( "box_box_manifold", "[manifold]" ) {
+    ContactManifold manifold;
+
+    SECTION( "a box resting on a larger box has four points" ) {
+        ac_vec3 p1 = { { 0.0f, 0.0f, 0.0f } };
+        ac_vec3 h1 = { { 2.0f, 0.5f, 2.0f } };
+        ac_vec3 p2 = { { 0.3f, 0.95f, -0.2f } };
+        ac_vec3 h2 = { { 0.5f, 0.5f, 0.5f } };
+        REQUIRE(box_box_manifold(&p1, identity, &h1, &p2, identity, &h2, &manifold));
+        REQUIRE(manifold.numPoints == 4);
+        REQUIRE_THAT(manifold.normal.y, WithinAbs(1.0f, 1e-6f));
+        for ( unsigned i = 0; i < manifold.numPoints; i++ )
+        {
+            const ContactPoint& point = manifold.points[i];
+            REQUIRE_THAT(point.penetrationDepth, WithinAbs(0.05f, 1e-5f));
+            REQUIRE_THAT(point.position.y, WithinAbs(0.45f, 1e-5f));
+            REQUIRE(std::fabs(point.position.x - 0.3f) <= 0.5f + 1e-5f);
+            REQUIRE(point.normalImpulse == 0.0f);
+            for ( unsigned j = 0; j < i; j++ )
+            {
+                REQUIRE(point.feature != manifold.points[j].feature);
+            }
+        }
+    }
+
+    SECTION( "the incident face is clipped to the reference face" ) {
+        // the top box hangs over the edge of the bottom box along x
+        ac_vec3 p1 = { { 0.0f, 0.0f, 0.0f } };
+        ac_vec3 h1 = { { 0.5f, 0.5f, 0.5f } };
+        ac_vec3 p2 = { { 0.75f, 0.9f, 0.0f } };
+        ac_vec3 h2 = { { 0.5f, 0.5f, 0.25f } };
+        REQUIRE(box_box_manifold(&p1, identity, &h1, &p2, identity, &h2, &manifold));
+        REQUIRE(manifold.numPoints == 4);
+        for ( unsigned i = 0; i < manifold.numPoints; i++ )
+        {
+            REQUIRE(manifold.points[i].position.x <= 0.5f + 1e-5f);
+            REQUIRE(manifold.points[i].position.x >= 0.25f - 1e-5f);
+        }
+    }
+
+    SECTION( "the normal points from the first box to the second" ) {
+        ac_vec3 p1 = { { 0.0f, 0.0f, 0.0f } };
+        ac_vec3 h1 = { { 0.5f, 0.5f, 0.5f } };
+        ac_vec3 p2 = { { -0.9f, 0.0f, 0.0f } };
+        REQUIRE(box_box_manifold(&p1, identity, &h1, &p2, identity, &h1, &manifold));
+        REQUIRE_THAT(manifold.normal.x, WithinAbs(-1.0f, 1e-6f));
+        REQUIRE_THAT(manifold.points[0].penetrationDepth, WithinAbs(0.1f, 1e-5f));
+    }
+
+    SECTION( "crossed edges give a single point" ) {
+        // both boxes are turned 45 degrees so that their edges cross at right angles
+        float   r        = std::sqrt(0.5f);
+        ac_vec3 axes1[3] = {
+            { { r, r, 0.0f } },
+            { { -r, r, 0.0f } },
+            { { 0.0f, 0.0f, 1.0f } }
+        };
+        ac_vec3 axes2[3] = {
+            { { 1.0f, 0.0f, 0.0f } },
+            { { 0.0f, r, r } },
+            { { 0.0f, -r, r } }
+        };
+        ac_vec3 h  = { { 0.5f, 0.5f, 0.5f } };
+        ac_vec3 p1 = { { 0.0f, 0.0f, 0.0f } };
+        ac_vec3 p2 = { { 0.0f, 1.35f, 0.0f } };
+        REQUIRE(box_box_manifold(&p1, axes1, &h, &p2, axes2, &h, &manifold));
+        REQUIRE(manifold.numPoints == 1);
+        REQUIRE_THAT(manifold.normal.y, WithinAbs(1.0f, 1e-5f));
+        REQUIRE_THAT(manifold.points[0].penetrationDepth, WithinAbs(2.0f * r - 1.35f, 1e-5f));
+        REQUIRE_THAT(manifold.points[0].position.y, WithinAbs(0.675f, 1e-5f));
+    }
+
+    SECTION( "separated" ) {
+        ac_vec3 p1 = { { 0.0f, 0.0f, 0.0f } };
+        ac_vec3 h  = { { 0.5f, 0.5f, 0.5f } };
+        ac_vec3 p2 = { { 0.8f, 0.8f, 0.8f } };
+        REQUIRE(box_box_manifold(&p1, identity, &h, &p2, identity, &h, &manifold));
+        p2 = { { 1.1f, 0.0f, 0.0f } };
+        REQUIRE_FALSE(box_box_manifold(&p1, identity, &h, &p2, identity, &h, &manifold));
+        REQUIRE(manifold.numPoints == 0);
+    }
+}
+
+TEST_CASE( "box_plane_manifold", "[manifold]" ) {
+    ContactManifold manifold;
+    ac_vec3         h          = { { 0.5f, 0.5f, 0.5f } };
+    ac_vec3         planePoint = { { 0.0f, 0.0f, 0.0f } };
+    ac_vec3         up         = { { 0.0f, 1.0f, 0.0f } };
+
+    SECTION( "a resting box touches with its bottom face" ) {
+        ac_vec3 p = { { 3.0f, 0.45f, 1.0f } };
+        REQUIRE(box_plane_manifold(&p, identity, &h, &planePoint, &up, &manifold));
+        REQUIRE(manifold.numPoints == 4);
+        REQUIRE_THAT(manifold.normal.y, WithinAbs(-1.0f, 1e-6f));
+        for ( unsigned i = 0; i < manifold.numPoints; i++ )
+        {
+            REQUIRE_THAT(manifold.points[i].penetrationDepth, WithinAbs(0.05f, 1e-5f));
+            REQUIRE((manifold.points[i].feature & 2u) == 0);  // the corners below the centre
+        }
+    }
+
+    SECTION( "a tilted box touches with one corner" ) {
+        float   r       = std::sqrt(0.5f);
+        ac_vec3 axes[3] = {
+            { { r, r, 0.0f } },
+            { { -r, r, 0.0f } },
+            { { 0.0f, 0.0f, 1.0f } }
+        };
+        ac_vec3 p = { { 0.0f, 0.65f, 0.0f } };
+        REQUIRE(box_plane_manifold(&p, axes, &h, &planePoint, &up, &manifold));
+        REQUIRE(manifold.numPoints == 2);  // the two ends of the lowest edge
+        REQUIRE_THAT(manifold.points[0].penetrationDepth, WithinAbs(r - 0.65f, 1e-5f));
+    }
+
+    SECTION( "above the plane" ) {
+        ac_vec3 p = { { 0.0f, 0.55f, 0.0f } };
+        REQUIRE_FALSE(box_plane_manifold(&p, identity, &h, &planePoint, &up, &manifold));
+    }
+}
+
+TEST_CASE( "contact_manifold_merge", "[manifold]" ) {
+    ContactManifold persistent;
+    ContactManifold fresh;
+    ac_vec3         h          = { { 0.5f, 0.5f, 0.5f } };
+    ac_vec3         planePoint = { { 0.0f, 0.0f, 0.0f } };
+    ac_vec3         up         = { { 0.0f, 1.0f, 0.0f } };
+    ac_vec3         p          = { { 0.0f, 0.45f, 0.0f } };
+    REQUIRE(box_plane_manifold(&p, identity, &h, &planePoint, &up, &persistent));
+    for ( unsigned i = 0; i < persistent.numPoints; i++ )
+    {
+        persistent.points[i].normalImpulse = (float) (persistent.points[i].feature + 1);
+    }
+
+    SECTION( "matching features keep their impulses" ) {
+        p.x += 0.01f;
+        REQUIRE(box_plane_manifold(&p, identity, &h, &planePoint, &up, &fresh));
+        contact_manifold_merge(&persistent, &fresh);
+        REQUIRE(persistent.numPoints == 4);
+        REQUIRE(persistent.points[0].position.x == fresh.points[0].position.x);
+        for ( unsigned i = 0; i < persistent.numPoints; i++ )
+        {
+            REQUIRE(persistent.points[i].normalImpulse == persistent.points[i].feature + 1.0f);
+        }
+    }
+
+    SECTION( "a turned normal discards the impulses" ) {
+        ac_vec3 tilted = { { 0.5f, std::sqrt(0.75f), 0.0f } };
+        REQUIRE(box_plane_manifold(&p, identity, &h, &planePoint, &tilted, &fresh));
+        contact_manifold_merge(&persistent, &fresh);
+        for ( unsigned i = 0; i < persistent.numPoints; i++ )
+        {
+            REQUIRE(persistent.points[i].normalImpulse == 0.0f);
+        }
+    }
+
+    SECTION( "the deepest point" ) {
+        p.x += 0.01f;
+        REQUIRE(box_plane_manifold(&p, identity, &h, &planePoint, &up, &fresh));
+        fresh.points[2].penetrationDepth = 1.0f;
+        REQUIRE(contact_manifold_deepest(&fresh) == 2);
+    }
+}
@@ -0,0 +1,245 @@
+#include <ace/geometry/intersection.h>
+#include <ace/geometry/mesh.h>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+#include <vector>
+
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+/// A flat grid of quads on the xz plane from the origin, two triangles per quad facing +y.
+struct GridMesh
+{
+    std::vector<ac_vec3>  vertices;
+    std::vector<uint32_t> indices;
+    TriangleMesh          mesh;
+
+    GridMesh(unsigned cells, float height)
+    {
+        for ( unsigned z = 0; z <= cells; z++ )
+        {
+            for ( unsigned x = 0; x <= cells; x++ )
+            {
+                vertices.push_back({ { (float) x, height, (float) z } });
+            }
+        }
+        for ( unsigned z = 0; z < cells; z++ )
+        {
+            for ( unsigned x = 0; x < cells; x++ )
+            {
+                uint32_t v00 = z * (cells + 1) + x;
+                uint32_t v01 = v00 + cells + 1;
+                indices.insert(indices.end(), { v00, v01, v00 + 1, v00 + 1, v01, v01 + 1 });
+            }
+        }
+        triangle_mesh_build(
+            &mesh,
+            vertices.data(),
+            (unsigned) vertices.size(),
+            indices.data(),
+            (unsigned) indices.size() / 3
+        );
+    }
+
+    ~GridMesh() { triangle_mesh_free(&mesh); }
+};
+
+}  // namespace
+
+TEST_CASE( "triangle_closest_point", "[mesh]" ) {
+    ac_vec3 a = { { 0.0f, 0.0f, 0.0f } };
+    ac_vec3 b = { { 1.0f, 0.0f, 0.0f } };
+    ac_vec3 c = { { 0.0f, 0.0f, 1.0f } };
+
+    SECTION( "face" ) {
+        ac_vec3 p       = { { 0.25f, 2.0f, 0.25f } };
+        ac_vec3 closest = triangle_closest_point(&p, &a, &b, &c);
+        REQUIRE_THAT(closest.x, WithinAbs(0.25f, 1e-6f));
+        REQUIRE_THAT(closest.y, WithinAbs(0.0f, 1e-6f));
+        REQUIRE_THAT(closest.z, WithinAbs(0.25f, 1e-6f));
+    }
+
+    SECTION( "vertex" ) {
+        ac_vec3 p       = { { 2.0f, 1.0f, -1.0f } };
+        ac_vec3 closest = triangle_closest_point(&p, &a, &b, &c);
+        REQUIRE(ac_vec3_is_equal(&closest, &b));
+    }
+
+    SECTION( "edge" ) {
+        ac_vec3 p       = { { 1.0f, 0.0f, 1.0f } };
+        ac_vec3 closest = triangle_closest_point(&p, &a, &b, &c);
+        REQUIRE_THAT(closest.x, WithinAbs(0.5f, 1e-6f));
+        REQUIRE_THAT(closest.z, WithinAbs(0.5f, 1e-6f));
+    }
+}
+
+TEST_CASE( "triangle_mesh_build", "[mesh]" ) {
+    GridMesh grid(16, 0.0f);
+    REQUIRE(grid.mesh.nodes != nullptr);
+    REQUIRE(grid.mesh.numNodes <= 2 * grid.mesh.numTriangles - 1);
+    REQUIRE(sizeof(TriangleMeshNode) == 16);
+
+    SECTION( "every triangle is in exactly one leaf inside its node" ) {
+        std::vector<int> seen(grid.mesh.numTriangles, 0);
+        for ( unsigned n = 0; n < grid.mesh.numNodes; n++ )
+        {
+            const TriangleMeshNode& node  = grid.mesh.nodes[n];
+            unsigned                count = node.data >> 29;
+            if ( count == 0 )
+            {
+                REQUIRE(node.data > n + 1);
+                REQUIRE(node.data < grid.mesh.numNodes);
+                continue;
+            }
+            REQUIRE(count <= AC_MESH_MAX_LEAF_TRIANGLES);
+            for ( unsigned i = 0; i < count; i++ )
+            {
+                uint32_t triangle = grid.mesh.triangles[(node.data & 0x1FFFFFFFu) + i];
+                seen[triangle]++;
+                for ( int corner = 0; corner < 3; corner++ )
+                {
+                    const ac_vec3& v = grid.vertices[grid.indices[triangle * 3 + corner]];
+                    for ( int axis = 0; axis < 3; axis++ )
+                    {
+                        float scale = grid.mesh.quantizeScale.data[axis];
+                        float q     = (v.data[axis] - grid.mesh.boundsMin.data[axis]) * scale;
+                        REQUIRE(node.min[axis] <= q);
+                        REQUIRE(node.max[axis] >= q);
+                    }
+                }
+            }
+        }
+        for ( int count : seen )
+        {
+            REQUIRE(count == 1);
+        }
+    }
+
+    SECTION( "invalid meshes" ) {
+        TriangleMesh mesh;
+        uint32_t     indices[] = { 0, 1, 5 };
+        REQUIRE_FALSE(triangle_mesh_build(&mesh, grid.vertices.data(), 3, indices, 1));
+        REQUIRE_FALSE(triangle_mesh_build(&mesh, grid.vertices.data(), 3, indices, 0));
+    }
+}
+
+TEST_CASE( "sphere_mesh", "[mesh]" ) {
+    GridMesh grid(16, 0.0f);
+    Sphere   sphere         = { 0.5f };
+    Collider sphereCollider = { SPHERE_C, &sphere };
+    Collider meshCollider   = { MESH_C, &grid.mesh };
+
+    SECTION( "resting on the surface" ) {
+        ac_vec3            p1     = { { 3.3f, 0.4f, 7.6f } };
+        ac_vec3            p2     = { { 0.0f, 0.0f, 0.0f } };
+        IntersectionResult result = sphere_mesh(&sphereCollider, &p1, &meshCollider, &p2);
+        REQUIRE(result.intersected);
+        REQUIRE_THAT(result.penetrationDepth, WithinAbs(0.1f, 1e-5f));
+        REQUIRE_THAT(result.contactNormal.y, WithinAbs(-1.0f, 1e-5f));
+        REQUIRE_THAT(result.contactPoint.x, WithinAbs(3.3f, 1e-5f));
+        REQUIRE_THAT(result.contactPoint.y, WithinAbs(-0.1f, 1e-5f));
+    }
+
+    SECTION( "shared between entities at different positions" ) {
+        ac_vec3            p1     = { { 103.3f, 0.4f, 7.6f } };
+        ac_vec3            p2     = { { 100.0f, 0.0f, 0.0f } };
+        IntersectionResult result = sphere_mesh(&sphereCollider, &p1, &meshCollider, &p2);
+        REQUIRE(result.intersected);
+        REQUIRE_THAT(result.contactPoint.x, WithinAbs(103.3f, 1e-4f));
+
+        p2     = { { 0.0f, 0.0f, 0.0f } };
+        result = sphere_mesh(&sphereCollider, &p1, &meshCollider, &p2);
+        REQUIRE_FALSE(result.intersected);
+    }
+
+    SECTION( "centre on the surface" ) {
+        ac_vec3            p1     = { { 2.5f, 0.0f, 2.25f } };
+        ac_vec3            p2     = { { 0.0f, 0.0f, 0.0f } };
+        IntersectionResult result = sphere_mesh(&sphereCollider, &p1, &meshCollider, &p2);
+        REQUIRE(result.intersected);
+        REQUIRE_THAT(result.penetrationDepth, WithinAbs(0.5f, 1e-6f));
+        REQUIRE_THAT(result.contactNormal.y, WithinAbs(-1.0f, 1e-6f));
+    }
+
+    SECTION( "separated" ) {
+        ac_vec3 p1 = { { 3.0f, 0.6f, 3.0f } };
+        ac_vec3 p2 = { { 0.0f, 0.0f, 0.0f } };
+        REQUIRE_FALSE(sphere_mesh(&sphereCollider, &p1, &meshCollider, &p2).intersected);
+        p1 = { { -0.6f, 0.0f, 3.0f } };
+        REQUIRE_FALSE(sphere_mesh(&sphereCollider, &p1, &meshCollider, &p2).intersected);
+    }
+
+    SECTION( "mesh_sphere reverses the normal" ) {
+        ac_vec3            p1     = { { 0.0f, 0.0f, 0.0f } };
+        ac_vec3            p2     = { { 3.3f, 0.4f, 7.6f } };
+        IntersectionResult result = mesh_sphere(&meshCollider, &p1, &sphereCollider, &p2);
+        REQUIRE(result.intersected);
+        REQUIRE_THAT(result.contactNormal.y, WithinAbs(1.0f, 1e-5f));
+    }
+}
+
+TEST_CASE( "sphere_heightfield", "[mesh]" ) {
+    // a ramp rising one unit per unit along x
+    std::vector<float> heights;
+    for ( unsigned z = 0; z < 8; z++ )
+    {
+        for ( unsigned x = 0; x < 8; x++ )
+        {
+            heights.push_back((float) x);
+        }
+    }
+    Heightfield heightfield;
+    REQUIRE(heightfield_init(&heightfield, heights.data(), 8, 8, 1.0f));
+    REQUIRE(heightfield.minHeight == 0.0f);
+    REQUIRE(heightfield.maxHeight == 7.0f);
+    REQUIRE_FALSE(heightfield_init(&heightfield, heights.data(), 1, 8, 1.0f));
+    REQUIRE_FALSE(heightfield_init(&heightfield, heights.data(), 8, 8, 0.0f));
+    REQUIRE(heightfield_init(&heightfield, heights.data(), 8, 8, 1.0f));
+
+    Sphere   sphere            = { 0.5f };
+    Collider sphereCollider    = { SPHERE_C, &sphere };
+    Collider heightCollider    = { HEIGHTFIELD_C, &heightfield };
+    ac_vec3  heightfieldOrigin = { { 10.0f, -1.0f, 0.0f } };
+
+    SECTION( "contact against the slope" ) {
+        // 0.4 above the ramp surface measured along its normal
+        float              offset = 0.4f / sqrtf(2.0f);
+        ac_vec3            p1     = { { 13.0f - offset, 2.0f + offset, 4.5f } };
+        IntersectionResult result =
+            sphere_heightfield(&sphereCollider, &p1, &heightCollider, &heightfieldOrigin);
+        REQUIRE(result.intersected);
+        REQUIRE_THAT(result.penetrationDepth, WithinAbs(0.1f, 1e-5f));
+        REQUIRE_THAT(result.contactNormal.x, WithinAbs(1.0f / sqrtf(2.0f), 1e-5f));
+        REQUIRE_THAT(result.contactNormal.y, WithinAbs(-1.0f / sqrtf(2.0f), 1e-5f));
+    }
+
+    SECTION( "outside the grid" ) {
+        ac_vec3 p1 = { { 5.0f, 0.0f, 4.0f } };
+        REQUIRE_FALSE(
+            sphere_heightfield(&sphereCollider, &p1, &heightCollider, &heightfieldOrigin)
+                .intersected
+        );
+        p1 = { { 13.0f, 10.0f, 4.0f } };
+        REQUIRE_FALSE(
+            sphere_heightfield(&sphereCollider, &p1, &heightCollider, &heightfieldOrigin)
+                .intersected
+        );
+    }
+}
+
+TEST_CASE( "sphere_mesh benchmark", "[.][benchmark][mesh]" ) {
+    GridMesh grid(128, 0.0f);
+    Sphere   sphere         = { 0.5f };
+    Collider sphereCollider = { SPHERE_C, &sphere };
+    Collider meshCollider   = { MESH_C, &grid.mesh };
+    ac_vec3  p1             = { { 64.3f, 0.4f, 37.6f } };
+    ac_vec3  p2             = { { 0.0f, 0.0f, 0.0f } };
+
+    BENCHMARK( "sphere_mesh 32k triangles" )
+    {
+        return sphere_mesh(&sphereCollider, &p1, &meshCollider, &p2);
+    };
+}
@@ -0,0 +1,173 @@
+#include <ace/math/fast.h>
+#include <ace/math/math.h>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <math.h>
+#include <vector>
+
+using Catch::Matchers::WithinAbs;
+
+// the error of a result in units of the last place of the correctly rounded reference
+static double ulp_error(float result, double reference)
+{
+    float  rounded = fabsf((float) reference);
+    double ulp     = (double) nextafterf(rounded, INFINITY) - (double) rounded;
+    return fabs((double) result - reference) / ulp;
+}
+
+TEST_CASE( "ac_rsqrt", "[fast]" ) {
+    double max_error = 0.0;
+    for ( float x = 1e-30f; x < 1e30f; x *= 1.0013f )
+    {
+        double error = ulp_error(ac_rsqrt(x), 1.0 / sqrt((double) x));
+        max_error    = error > max_error ? error : max_error;
+    }
+    REQUIRE( max_error <= 5.0 );
+    REQUIRE_THAT(ac_rsqrt(4.0f), WithinAbs(0.5f, 1e-6f));
+}
+
+TEST_CASE( "ac_sincos", "[fast]" ) {
+    double max_absolute = 0.0;
+    double max_error    = 0.0;
+    for ( float angle = -100.0f; angle < 100.0f; angle += 0.00173f )
+    {
+        float sine, cosine;
+        ac_sincos(angle, &sine, &cosine);
+        double results[2]    = { sine, cosine };
+        double references[2] = { sin((double) angle), cos((double) angle) };
+        for ( int i = 0; i < 2; i++ )
+        {
+            double absolute = fabs(results[i] - references[i]);
+            max_absolute    = absolute > max_absolute ? absolute : max_absolute;
+            if ( fabs(references[i]) >= 0.25 )
+            {
+                double error = ulp_error((float) results[i], references[i]);
+                max_error    = error > max_error ? error : max_error;
+            }
+        }
+    }
+    REQUIRE( max_absolute <= 1e-7 );
+    REQUIRE( max_error <= 2.0 );
+
+    SECTION( "large angles fall back to the standard library" )
+    {
+        float sine, cosine;
+        ac_sincos(1e6f, &sine, &cosine);
+        REQUIRE( sine == sinf(1e6f) );
+        REQUIRE( cosine == cosf(1e6f) );
+    }
+
+    SECTION( "NaN passes through" )
+    {
+        float sine, cosine;
+        ac_sincos(NAN, &sine, &cosine);
+        REQUIRE( isnan(sine) );
+        REQUIRE( isnan(cosine) );
+    }
+}
+
+TEST_CASE( "ac_acos_fast", "[fast]" ) {
+    double max_error = 0.0;
+    for ( float x = -1.0f; x <= 1.0f; x += 0.0000613f )
+    {
+        double error = ulp_error(ac_acos_fast(x), acos((double) x));
+        max_error    = error > max_error ? error : max_error;
+    }
+    REQUIRE( max_error <= 2.0 );
+    REQUIRE( ac_acos_fast(1.0f) == 0.0f );
+    REQUIRE_THAT(ac_acos_fast(-1.0f), WithinAbs(AC_PI, 1e-6f));
+    REQUIRE( isnan(ac_acos_fast(1.0001f)) );
+    REQUIRE( isnan(ac_acos_fast(NAN)) );
+}
+
+TEST_CASE( "ac_atan2_fast", "[fast]" ) {
+    double max_error = 0.0;
+    for ( float y = -1000.0f; y < 1000.0f; y += 3.17f )
+    {
+        for ( float x = -1000.0f; x < 1000.0f; x += 2.93f )
+        {
+            double error = ulp_error(ac_atan2_fast(y, x), atan2((double) y, (double) x));
+            max_error    = error > max_error ? error : max_error;
+        }
+    }
+    REQUIRE( max_error <= 4.0 );
+    REQUIRE( ac_atan2_fast(0.0f, 0.0f) == 0.0f );
+    REQUIRE_THAT(ac_atan2_fast(1.0f, 0.0f), WithinAbs(0.5f * AC_PI, 1e-6f));
+    REQUIRE_THAT(ac_atan2_fast(-1.0f, 0.0f), WithinAbs(-0.5f * AC_PI, 1e-6f));
+    REQUIRE_THAT(ac_atan2_fast(0.0f, -1.0f), WithinAbs(AC_PI, 1e-6f));
+}
+
+TEST_CASE( "ac_vec3_normalize_fast", "[fast]" ) {
+    double max_error = 0.0;
+    for ( int i = 0; i < 10000; i++ )
+    {
+        float   f = (float) i;
+        ac_vec3 v = { { sinf(f) * 100.0f, cosf(f * 0.7f), f * 0.01f - 50.0f } };
+        ac_vec3 n = ac_vec3_normalize_fast(&v);
+
+        double length = sqrt((double) v.x * v.x + (double) v.y * v.y + (double) v.z * v.z);
+        for ( int axis = 0; axis < 3; axis++ )
+        {
+            double error = ulp_error(n.data[axis], v.data[axis] / length);
+            max_error    = error > max_error ? error : max_error;
+        }
+    }
+    REQUIRE( max_error <= 6.0 );
+
+    ac_vec3 zero   = { { 0.0f, 0.0f, 0.0f } };
+    ac_vec3 result = ac_vec3_normalize_fast(&zero);
+    REQUIRE( ac_vec3_is_nan(&result) );
+}
+
+TEST_CASE( "fast math benchmark", "[.][benchmark][fast]" ) {
+    const size_t         n = 4096;
+    std::vector<ac_vec3> vectors(n);
+    for ( size_t i = 0; i < n; i++ )
+    {
+        float f    = (float) i;
+        vectors[i] = { { sinf(f), cosf(f), f * 0.001f + 1.0f } };
+    }
+
+    BENCHMARK( "ac_vec3_normalize" )
+    {
+        float sum = 0.0f;
+        for ( const ac_vec3& v : vectors )
+        {
+            sum += ac_vec3_normalize(&v).x;
+        }
+        return sum;
+    };
+
+    BENCHMARK( "ac_vec3_normalize_fast" )
+    {
+        float sum = 0.0f;
+        for ( const ac_vec3& v : vectors )
+        {
+            sum += ac_vec3_normalize_fast(&v).x;
+        }
+        return sum;
+    };
+
+    BENCHMARK( "sinf and cosf" )
+    {
+        float sum = 0.0f;
+        for ( size_t i = 0; i < n; i++ )
+        {
+            sum += sinf((float) i * 0.01f) + cosf((float) i * 0.01f);
+        }
+        return sum;
+    };
+
+    BENCHMARK( "ac_sincos" )
+    {
+        float sum = 0.0f;
+        for ( size_t i = 0; i < n; i++ )
+        {
+            float sine, cosine;
+            ac_sincos((float) i * 0.01f, &sine, &cosine);
+            sum += sine + cosine;
+        }
+        return sum;
+    };
+}
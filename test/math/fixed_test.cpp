@@ -0,0 +1,207 @@
+#include <ace/math/fixed.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <math.h>
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE( "ac_fixed conversions", "[fixed]" ) {
+    REQUIRE( ac_fixed_from_int(3) == 3 * AC_FIXED_ONE );
+    REQUIRE( ac_fixed_from_int(-32767) == -32767 * AC_FIXED_ONE );
+    REQUIRE( ac_fixed_from_int(32768) == INT_INVALID );
+    REQUIRE( ac_fixed_from_float(1.5f) == AC_FIXED_ONE + AC_FIXED_ONE / 2 );
+    REQUIRE( ac_fixed_from_float(-0.25f) == -AC_FIXED_ONE / 4 );
+    REQUIRE( ac_fixed_from_float(40000.0f) == INT_INVALID );
+    REQUIRE( ac_fixed_from_float(NAN) == INT_INVALID );
+    REQUIRE( ac_fixed_to_float(ac_fixed_from_float(-12.75f)) == -12.75f );
+    REQUIRE( isnan(ac_fixed_to_float(INT_INVALID)) );
+}
+
+TEST_CASE( "ac_fixed arithmetic", "[fixed]" ) {
+    ac_fixed two   = ac_fixed_from_int(2);
+    ac_fixed three = ac_fixed_from_int(3);
+
+    REQUIRE( ac_fixed_add(two, three) == ac_fixed_from_int(5) );
+    REQUIRE( ac_fixed_sub(two, three) == ac_fixed_from_int(-1) );
+    REQUIRE( ac_fixed_mul(two, three) == ac_fixed_from_int(6) );
+    REQUIRE( ac_fixed_mul(-two, three) == ac_fixed_from_int(-6) );
+    REQUIRE( ac_fixed_div(three, two) == ac_fixed_from_float(1.5f) );
+    REQUIRE( ac_fixed_div(-three, two) == ac_fixed_from_float(-1.5f) );
+    REQUIRE( ac_fixed_sqrt(ac_fixed_from_int(9)) == three );
+    REQUIRE_THAT(ac_fixed_to_float(ac_fixed_sqrt(two)), WithinAbs(sqrtf(2.0f), 2e-5f));
+
+    SECTION( "rounding is to nearest, ties away from zero" )
+    {
+        REQUIRE( ac_fixed_mul(1, AC_FIXED_ONE / 2) == 1 );
+        REQUIRE( ac_fixed_mul(-1, AC_FIXED_ONE / 2) == -1 );
+        REQUIRE( ac_fixed_mul(1, AC_FIXED_ONE / 2 - 1) == 0 );
+        REQUIRE( ac_fixed_div(ac_fixed_from_int(1), ac_fixed_from_int(3)) == 21845 );
+        REQUIRE( ac_fixed_div(ac_fixed_from_int(2), ac_fixed_from_int(3)) == 43691 );
+    }
+
+    SECTION( "overflow saturates to invalid" )
+    {
+        ac_fixed large = ac_fixed_from_int(30000);
+        REQUIRE( ac_fixed_add(large, large) == INT_INVALID );
+        REQUIRE( ac_fixed_sub(-large, large) == INT_INVALID );
+        REQUIRE( ac_fixed_mul(large, two) == INT_INVALID );
+        REQUIRE( ac_fixed_div(large, AC_FIXED_ONE / 4) == INT_INVALID );
+        REQUIRE( ac_fixed_add(INT_MAX, 0) == INT_MAX );
+        REQUIRE( ac_fixed_add(INT_MAX, 1) == INT_INVALID );
+    }
+
+    SECTION( "invalid inputs give invalid results" )
+    {
+        REQUIRE( ac_fixed_add(INT_INVALID, two) == INT_INVALID );
+        REQUIRE( ac_fixed_sub(two, INT_INVALID) == INT_INVALID );
+        REQUIRE( ac_fixed_mul(two, INT_INVALID) == INT_INVALID );
+        REQUIRE( ac_fixed_div(two, 0) == INT_INVALID );
+        REQUIRE( ac_fixed_sqrt(-two) == INT_INVALID );
+    }
+}
+
+TEST_CASE( "ac_fixed_vec3", "[fixed]" ) {
+    ac_vec3       af = { { 1.0f, 2.0f, 3.0f } };
+    ac_vec3       bf = { { -4.0f, 0.5f, 2.0f } };
+    ac_fixed_vec3 a  = ac_fixed_vec3_from_vec3(&af);
+    ac_fixed_vec3 b  = ac_fixed_vec3_from_vec3(&bf);
+
+    SECTION( "add and sub" )
+    {
+        ac_vec3       expected_sum  = { { -3.0f, 2.5f, 5.0f } };
+        ac_vec3       expected_diff = { { 5.0f, 1.5f, 1.0f } };
+        ac_fixed_vec3 sum           = ac_fixed_vec3_add(&a, &b);
+        ac_fixed_vec3 diff          = ac_fixed_vec3_sub(&a, &b);
+        ac_fixed_vec3 fixed_sum     = ac_fixed_vec3_from_vec3(&expected_sum);
+        ac_fixed_vec3 fixed_diff    = ac_fixed_vec3_from_vec3(&expected_diff);
+        REQUIRE( ac_ivec3_is_equal(&sum, &fixed_sum) );
+        REQUIRE( ac_ivec3_is_equal(&diff, &fixed_diff) );
+    }
+
+    SECTION( "scale, dot, and cross" )
+    {
+        ac_fixed_vec3 scaled = ac_fixed_vec3_scale(&a, ac_fixed_from_float(0.5f));
+        ac_vec3       half   = ac_fixed_vec3_to_vec3(&scaled);
+        REQUIRE( half.x == 0.5f );
+        REQUIRE( half.z == 1.5f );
+
+        REQUIRE( ac_fixed_vec3_dot(&a, &b) == ac_fixed_from_int(3) );
+
+        ac_fixed_vec3 cross          = ac_fixed_vec3_cross(&a, &b);
+        ac_vec3       expected_cross = ac_vec3_cross(&af, &bf);
+        ac_fixed_vec3 fixed_cross    = ac_fixed_vec3_from_vec3(&expected_cross);
+        REQUIRE( ac_ivec3_is_equal(&cross, &fixed_cross) );
+    }
+
+    SECTION( "length and normalize" )
+    {
+        ac_vec3       vf = { { 3.0f, 0.0f, -4.0f } };
+        ac_fixed_vec3 v  = ac_fixed_vec3_from_vec3(&vf);
+        REQUIRE( ac_fixed_vec3_length(&v) == ac_fixed_from_int(5) );
+
+        ac_fixed_vec3 n = ac_fixed_vec3_normalize(&v);
+        REQUIRE( n.x == ac_fixed_from_float(0.6f) );
+        REQUIRE( n.y == 0 );
+        REQUIRE( n.z == ac_fixed_from_float(-0.8f) );
+
+        // the squared length of this vector overflows Q16.16, but its length does not
+        ac_fixed_vec3 large = { { 20000 * AC_FIXED_ONE, 20000 * AC_FIXED_ONE, 0 } };
+        float         length = ac_fixed_to_float(ac_fixed_vec3_length(&large));
+        REQUIRE_THAT(length, WithinAbs(20000.0f * sqrtf(2.0f), 0.01f));
+
+        ac_fixed_vec3 zero = ac_ivec3_zero();
+        ac_fixed_vec3 unit = ac_fixed_vec3_normalize(&zero);
+        REQUIRE( ac_ivec3_is_invalid(&unit) );
+    }
+
+    SECTION( "overflow and invalid inputs give the invalid vector" )
+    {
+        ac_fixed_vec3 large = { { 30000 * AC_FIXED_ONE, 0, 0 } };
+        ac_fixed_vec3 sum   = ac_fixed_vec3_add(&large, &large);
+        REQUIRE( ac_ivec3_is_invalid(&sum) );
+        REQUIRE( sum.y == INT_INVALID );
+
+        ac_fixed_vec3 invalid = ac_ivec3_invalid();
+        REQUIRE( ac_fixed_vec3_dot(&a, &invalid) == INT_INVALID );
+        ac_fixed_vec3 cross = ac_fixed_vec3_cross(&invalid, &b);
+        REQUIRE( ac_ivec3_is_invalid(&cross) );
+    }
+}
+
+TEST_CASE( "ac_fixed64 arithmetic", "[fixed]" ) {
+    ac_fixed64 two   = ac_fixed64_from_int(2);
+    ac_fixed64 three = ac_fixed64_from_int(3);
+
+    REQUIRE( ac_fixed64_from_int(-5) == -5 * AC_FIXED64_ONE );
+    REQUIRE( ac_fixed64_from_int(INT_INVALID) == AC_FIXED64_INVALID );
+    REQUIRE( ac_fixed64_from_double(0.5) == AC_FIXED64_ONE / 2 );
+    REQUIRE( ac_fixed64_from_double(3e9) == AC_FIXED64_INVALID );
+    REQUIRE( ac_fixed64_to_double(ac_fixed64_from_double(-1234.125)) == -1234.125 );
+
+    REQUIRE( ac_fixed64_add(two, three) == ac_fixed64_from_int(5) );
+    REQUIRE( ac_fixed64_sub(two, three) == ac_fixed64_from_int(-1) );
+    REQUIRE( ac_fixed64_mul(-two, three) == ac_fixed64_from_int(-6) );
+    REQUIRE( ac_fixed64_div(three, -two) == ac_fixed64_from_double(-1.5) );
+    REQUIRE( ac_fixed64_sqrt(ac_fixed64_from_int(16)) == ac_fixed64_from_int(4) );
+    REQUIRE_THAT(ac_fixed64_to_double(ac_fixed64_sqrt(two)), WithinAbs(sqrt(2.0), 1e-9));
+    REQUIRE_THAT(
+        ac_fixed64_to_double(ac_fixed64_div(ac_fixed64_from_int(1), three)),
+        WithinAbs(1.0 / 3.0, 1e-9)
+    );
+
+    SECTION( "products keep the full precision of the fraction" )
+    {
+        ac_fixed64 small = 3;
+        REQUIRE( ac_fixed64_mul(small, AC_FIXED64_ONE) == small );
+        REQUIRE( ac_fixed64_mul(ac_fixed64_from_int(65536), ac_fixed64_from_int(32767))
+                 == ac_fixed64_from_int(65536 * 32767) );
+    }
+
+    SECTION( "overflow saturates to invalid" )
+    {
+        ac_fixed64 large = ac_fixed64_from_int(2000000000);
+        REQUIRE( ac_fixed64_add(large, large) == AC_FIXED64_INVALID );
+        REQUIRE( ac_fixed64_sub(-large, large) == AC_FIXED64_INVALID );
+        REQUIRE( ac_fixed64_mul(large, two) == AC_FIXED64_INVALID );
+        REQUIRE( ac_fixed64_div(large, AC_FIXED64_ONE / 2) == AC_FIXED64_INVALID );
+        REQUIRE( ac_fixed64_div(two, 0) == AC_FIXED64_INVALID );
+        REQUIRE( ac_fixed64_sqrt(-two) == AC_FIXED64_INVALID );
+    }
+}
+
+TEST_CASE( "ac_fixed64_vec3", "[fixed]" ) {
+    ac_vec3         af = { { 1.0f, 2.0f, 3.0f } };
+    ac_vec3         bf = { { -4.0f, 0.5f, 2.0f } };
+    ac_fixed64_vec3 a  = ac_fixed64_vec3_from_vec3(&af);
+    ac_fixed64_vec3 b  = ac_fixed64_vec3_from_vec3(&bf);
+
+    ac_fixed64_vec3 sum = ac_fixed64_vec3_add(&a, &b);
+    REQUIRE( sum.x == ac_fixed64_from_int(-3) );
+    ac_fixed64_vec3 diff = ac_fixed64_vec3_sub(&a, &b);
+    REQUIRE( diff.y == ac_fixed64_from_double(1.5) );
+    ac_fixed64_vec3 scaled = ac_fixed64_vec3_scale(&a, ac_fixed64_from_double(2.5));
+    REQUIRE( scaled.z == ac_fixed64_from_double(7.5) );
+
+    REQUIRE( ac_fixed64_vec3_dot(&a, &b) == ac_fixed64_from_int(3) );
+
+    ac_fixed64_vec3 cross    = ac_fixed64_vec3_cross(&a, &b);
+    ac_vec3         expected = ac_vec3_cross(&af, &bf);
+    ac_vec3         result   = ac_fixed64_vec3_to_vec3(&cross);
+    REQUIRE( ac_vec3_is_equal(&result, &expected) );
+
+    ac_vec3         vf = { { 0.0f, -3.0f, 4.0f } };
+    ac_fixed64_vec3 v  = ac_fixed64_vec3_from_vec3(&vf);
+    REQUIRE( ac_fixed64_vec3_length(&v) == ac_fixed64_from_int(5) );
+
+    ac_fixed64_vec3 n = ac_fixed64_vec3_normalize(&v);
+    REQUIRE( n.x == 0 );
+    REQUIRE( n.y == ac_fixed64_from_double(-0.6) );
+    REQUIRE( n.z == ac_fixed64_from_double(0.8) );
+
+    ac_fixed64_vec3 zero = { { 0, 0, 0 } };
+    ac_fixed64_vec3 unit = ac_fixed64_vec3_normalize(&zero);
+    REQUIRE( ac_fixed64_vec3_is_invalid(&unit) );
+
+    ac_fixed64_vec3 invalid = ac_fixed64_vec3_invalid();
+    REQUIRE( ac_fixed64_vec3_dot(&invalid, &b) == AC_FIXED64_INVALID );
+}
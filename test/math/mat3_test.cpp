@@ -0,0 +1,80 @@
+#include <ace/math/mat3.h>
+#include <ace/math/math.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <math.h>
+
+using Catch::Matchers::WithinAbs;
+
+static void require_mat3_near(const ac_mat3& a, const ac_mat3& b)
+{
+    for ( int i = 0; i < 9; i++ )
+    {
+        CAPTURE(i);
+        REQUIRE_THAT(a.data[i], WithinAbs(b.data[i], 1e-5f));
+    }
+}
+
+TEST_CASE( "ac_mat3 layout", "[ac_mat3]" ) {
+    ac_mat3 m = ac_mat3_identity();
+    m.columns[2].x = 5.0f;
+    REQUIRE(m.data[6] == 5.0f);
+    REQUIRE(m.data[0] == 1.0f);
+    REQUIRE(m.data[4] == 1.0f);
+    REQUIRE(m.data[8] == 1.0f);
+}
+
+TEST_CASE( "ac_mat3_from_quat", "[ac_mat3]" ) {
+    ac_vec3 axis     = { 0.0f, 0.6f, 0.8f };
+    ac_quat q        = ac_quat_from_axis_angle(&axis, 1.3f);
+    ac_mat3 rotation = ac_mat3_from_quat(&q);
+    ac_vec3 v        = { 1.0f, -2.0f, 0.5f };
+
+    ac_vec3 result   = ac_mat3_transform(&rotation, &v);
+    ac_vec3 expected = ac_quat_rotate(&q, &v);
+    REQUIRE(ac_vec3_is_equal(&result, &expected));
+    REQUIRE_THAT(ac_mat3_determinant(&rotation), WithinAbs(1.0f, 1e-6f));
+}
+
+TEST_CASE( "ac_mat3_mul", "[ac_mat3]" ) {
+    ac_vec3 up = { 0.0f, 1.0f, 0.0f };
+    ac_quat a  = ac_quat_from_axis_angle(&up, 0.4f);
+    ac_quat b  = ac_quat_from_axis_angle(&up, 0.7f);
+    ac_quat ab = ac_quat_mul(&a, &b);
+
+    ac_mat3 ma      = ac_mat3_from_quat(&a);
+    ac_mat3 mb      = ac_mat3_from_quat(&b);
+    ac_mat3 product = ac_mat3_mul(&ma, &mb);
+    require_mat3_near(product, ac_mat3_from_quat(&ab));
+}
+
+TEST_CASE( "ac_mat3_transpose", "[ac_mat3]" ) {
+    ac_mat3 m = { { { { 1.0f, 2.0f, 3.0f } }, { { 4.0f, 5.0f, 6.0f } }, { { 7.0f, 8.0f, 9.0f } } } };
+    ac_mat3 t = ac_mat3_transpose(&m);
+    REQUIRE(t.data[1] == 4.0f);
+    REQUIRE(t.data[3] == 2.0f);
+    REQUIRE(t.data[8] == 9.0f);
+}
+
+TEST_CASE( "ac_mat3_inverse", "[ac_mat3]" ) {
+    SECTION( "product with the inverse is the identity" ) {
+        ac_mat3 m       = { { { { 2.0f, 0.5f, 0.0f } }, { { 1.0f, 3.0f, -1.0f } }, { { 0.0f, 1.0f, 4.0f } } } };
+        ac_mat3 inverse = ac_mat3_inverse(&m);
+        ac_mat3 product = ac_mat3_mul(&m, &inverse);
+        require_mat3_near(product, ac_mat3_identity());
+    }
+
+    SECTION( "inverse of a rotation is its transpose" ) {
+        ac_vec3 axis     = { 0.6f, 0.0f, 0.8f };
+        ac_quat q        = ac_quat_from_axis_angle(&axis, 2.1f);
+        ac_mat3 rotation = ac_mat3_from_quat(&q);
+        require_mat3_near(ac_mat3_inverse(&rotation), ac_mat3_transpose(&rotation));
+    }
+
+    SECTION( "singular matrix" ) {
+        ac_mat3 m       = { { { { 1.0f, 2.0f, 3.0f } }, { { 2.0f, 4.0f, 6.0f } }, { { 0.0f, 1.0f, 0.0f } } } };
+        ac_mat3 inverse = ac_mat3_inverse(&m);
+        REQUIRE(ac_mat3_determinant(&m) == 0.0f);
+        REQUIRE(isnan(inverse.data[0]));
+    }
+}
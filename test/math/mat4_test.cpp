@@ -0,0 +1,220 @@
+#include <ace/math/mat4.h>
+#include <ace/math/math.h>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+using Catch::Matchers::WithinAbs;
+
+static void require_mat4_near(const ac_mat4& a, const ac_mat4& b)
+{
+    for ( int i = 0; i < 16; i++ )
+    {
+        CAPTURE(i);
+        REQUIRE_THAT(a.data[i], WithinAbs(b.data[i], 1e-5f));
+    }
+}
+
+static ac_mat4 sample_transform()
+{
+    ac_vec3 translation = { 1.0f, -2.0f, 3.0f };
+    ac_vec3 axis        = { 0.0f, 0.6f, 0.8f };
+    ac_quat rotation    = ac_quat_from_axis_angle(&axis, 0.9f);
+    ac_vec3 scale       = { 2.0f, 0.5f, 1.5f };
+    return ac_mat4_from_trs(&translation, &rotation, &scale);
+}
+
+TEST_CASE( "ac_mat4 layout", "[ac_mat4]" ) {
+    REQUIRE(sizeof(ac_mat4) == 64);
+    REQUIRE(alignof(ac_mat4) == 16);
+
+    ac_vec3 translation = { 1.0f, 2.0f, 3.0f };
+    ac_mat4 m           = ac_mat4_translation(&translation);
+    // column-major, so the translation is in the last four elements as OpenGL expects
+    REQUIRE(m.data[12] == 1.0f);
+    REQUIRE(m.data[13] == 2.0f);
+    REQUIRE(m.data[14] == 3.0f);
+    REQUIRE(m.data[15] == 1.0f);
+    REQUIRE(reinterpret_cast<uintptr_t>(&m) % 16 == 0);
+}
+
+TEST_CASE( "ac_mat4 transforms", "[ac_mat4]" ) {
+    ac_vec3 p = { 0.5f, 1.0f, -2.0f };
+
+    SECTION( "identity" ) {
+        ac_mat4 identity = ac_mat4_identity();
+        ac_vec3 result   = ac_mat4_transform_point(&identity, &p);
+        REQUIRE(ac_vec3_is_equal(&result, &p));
+    }
+
+    SECTION( "translation moves points but not directions" ) {
+        ac_vec3 translation = { 1.0f, 2.0f, 3.0f };
+        ac_mat4 m           = ac_mat4_translation(&translation);
+        ac_vec3 point       = ac_mat4_transform_point(&m, &p);
+        ac_vec3 direction   = ac_mat4_transform_direction(&m, &p);
+        ac_vec3 expected    = ac_vec3_add(&p, &translation);
+        REQUIRE(ac_vec3_is_equal(&point, &expected));
+        REQUIRE(ac_vec3_is_equal(&direction, &p));
+    }
+
+    SECTION( "rotation matches the quaternion" ) {
+        ac_vec3 axis     = { 0.6f, 0.0f, 0.8f };
+        ac_quat q        = ac_quat_from_axis_angle(&axis, 1.1f);
+        ac_mat4 m        = ac_mat4_from_quat(&q);
+        ac_vec3 result   = ac_mat4_transform_point(&m, &p);
+        ac_vec3 expected = ac_quat_rotate(&q, &p);
+        REQUIRE(ac_vec3_is_equal(&result, &expected));
+    }
+
+    SECTION( "trs scales then rotates then translates" ) {
+        ac_vec3 translation = { 1.0f, -2.0f, 3.0f };
+        ac_vec3 axis        = { 0.0f, 0.6f, 0.8f };
+        ac_quat rotation    = ac_quat_from_axis_angle(&axis, 0.9f);
+        ac_vec3 scale       = { 2.0f, 0.5f, 1.5f };
+        ac_mat4 m           = ac_mat4_from_trs(&translation, &rotation, &scale);
+
+        ac_vec3 expected = { p.x * scale.x, p.y * scale.y, p.z * scale.z };
+        expected         = ac_quat_rotate(&rotation, &expected);
+        expected         = ac_vec3_add(&expected, &translation);
+        ac_vec3 result   = ac_mat4_transform_point(&m, &p);
+        REQUIRE(ac_vec3_is_equal(&result, &expected));
+    }
+}
+
+TEST_CASE( "ac_mat4_mul", "[ac_mat4]" ) {
+    ac_mat4 a = sample_transform();
+    ac_vec3 t = { -4.0f, 0.0f, 1.0f };
+    ac_mat4 b = ac_mat4_translation(&t);
+    ac_vec3 p = { 0.5f, 1.0f, -2.0f };
+
+    // transforming by the product is transforming by b then by a
+    ac_mat4 ab       = ac_mat4_mul(&a, &b);
+    ac_vec3 result   = ac_mat4_transform_point(&ab, &p);
+    ac_vec3 by_b     = ac_mat4_transform_point(&b, &p);
+    ac_vec3 expected = ac_mat4_transform_point(&a, &by_b);
+    REQUIRE(ac_vec3_is_equal(&result, &expected));
+
+    ac_mat4 identity = ac_mat4_identity();
+    ac_mat4 same     = ac_mat4_mul(&a, &identity);
+    REQUIRE(memcmp(same.data, a.data, sizeof(a.data)) == 0);
+}
+
+TEST_CASE( "ac_mat4_inverse", "[ac_mat4]" ) {
+    SECTION( "product with the inverse is the identity" ) {
+        ac_mat4 m       = sample_transform();
+        m.data[3]       = 0.25f; // make it non-affine as well
+        ac_mat4 inverse = ac_mat4_inverse(&m);
+        ac_mat4 product = ac_mat4_mul(&m, &inverse);
+        require_mat4_near(product, ac_mat4_identity());
+        REQUIRE_THAT(ac_mat4_determinant(&m) * ac_mat4_determinant(&inverse), WithinAbs(1.0f, 1e-5f));
+    }
+
+    SECTION( "transpose of the transpose" ) {
+        ac_mat4 m          = sample_transform();
+        ac_mat4 transposed = ac_mat4_transpose(&m);
+        ac_mat4 result     = ac_mat4_transpose(&transposed);
+        REQUIRE(transposed.data[1] == m.data[4]);
+        REQUIRE(memcmp(result.data, m.data, sizeof(m.data)) == 0);
+    }
+
+    SECTION( "singular matrix" ) {
+        ac_vec3 flat    = { 1.0f, 0.0f, 1.0f };
+        ac_mat4 m       = ac_mat4_scaling(&flat);
+        ac_mat4 inverse = ac_mat4_inverse(&m);
+        REQUIRE(ac_mat4_determinant(&m) == 0.0f);
+        REQUIRE(isnan(inverse.data[0]));
+    }
+}
+
+TEST_CASE( "ac_mat4 camera matrices", "[ac_mat4]" ) {
+    SECTION( "look at" ) {
+        ac_vec3 eye    = { 0.0f, 2.0f, 5.0f };
+        ac_vec3 target = { 0.0f, 2.0f, 0.0f };
+        ac_vec3 up     = { 0.0f, 1.0f, 0.0f };
+        ac_mat4 view   = ac_mat4_look_at(&eye, &target, &up);
+
+        // the eye moves to the origin and the target lies down the negative z-axis
+        ac_vec3 origin   = ac_mat4_transform_point(&view, &eye);
+        ac_vec3 centre   = ac_mat4_transform_point(&view, &target);
+        ac_vec3 expected = { 0.0f, 0.0f, -5.0f };
+        REQUIRE(ac_vec3_is_zero(&origin));
+        REQUIRE(ac_vec3_is_equal(&centre, &expected));
+    }
+
+    SECTION( "perspective" ) {
+        ac_mat4 projection = ac_mat4_perspective(AC_PI * 0.5f, 2.0f, 1.0f, 10.0f);
+        REQUIRE_THAT(projection.data[0], WithinAbs(0.5f, 1e-6f));
+        REQUIRE_THAT(projection.data[5], WithinAbs(1.0f, 1e-6f));
+
+        // the near and far planes map to -1 and 1 after the divide by w
+        ac_vec4 near_point = { 0.0f, 0.0f, -1.0f, 1.0f };
+        ac_vec4 far_point  = { 0.0f, 0.0f, -10.0f, 1.0f };
+        ac_vec4 near_clip  = ac_mat4_transform(&projection, &near_point);
+        ac_vec4 far_clip   = ac_mat4_transform(&projection, &far_point);
+        REQUIRE_THAT(near_clip.z / near_clip.w, WithinAbs(-1.0f, 1e-6f));
+        REQUIRE_THAT(far_clip.z / far_clip.w, WithinAbs(1.0f, 1e-6f));
+    }
+}
+
+TEST_CASE( "ac_mat4 batch functions", "[ac_mat4]" ) {
+    const size_t         count = 9;
+    std::vector<ac_vec3> points(count);
+    std::vector<ac_vec3> translations(count);
+    std::vector<ac_quat> rotations(count);
+    ac_vec3              axis = { 0.0f, 0.0f, 1.0f };
+    for ( size_t i = 0; i < count; i++ )
+    {
+        points[i]       = { { (float) i, 1.0f - (float) i, 0.5f } };
+        translations[i] = { { 0.0f, (float) i, 0.0f } };
+        rotations[i]    = ac_quat_from_axis_angle(&axis, 0.1f * (float) i);
+    }
+
+    SECTION( "transform points" ) {
+        ac_mat4              m = sample_transform();
+        std::vector<ac_vec3> out(count);
+        ac_mat4_transform_points_n(out.data(), &m, points.data(), count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_vec3 expected = ac_mat4_transform_point(&m, &points[i]);
+            CAPTURE(i);
+            REQUIRE(memcmp(&out[i], &expected, sizeof(expected)) == 0);
+        }
+    }
+
+    SECTION( "instance transforms" ) {
+        std::vector<ac_mat4> out(count);
+        ac_mat4_from_trs_n(out.data(), translations.data(), rotations.data(), nullptr, count);
+        ac_vec3 unit = { 1.0f, 1.0f, 1.0f };
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_mat4 expected = ac_mat4_from_trs(&translations[i], &rotations[i], &unit);
+            CAPTURE(i);
+            REQUIRE(memcmp(out[i].data, expected.data, sizeof(expected.data)) == 0);
+        }
+    }
+}
+
+TEST_CASE( "ac_mat4 benchmark", "[.][benchmark][ac_mat4]" ) {
+    const size_t         count = 4096;
+    std::vector<ac_vec3> translations(count, ac_vec3{ { 1.0f, 2.0f, 3.0f } });
+    std::vector<ac_quat> rotations(count, ac_quat_identity());
+    std::vector<ac_mat4> transforms(count);
+    std::vector<ac_vec3> points(count, ac_vec3{ { 0.5f, -1.0f, 0.25f } });
+    ac_mat4              m = sample_transform();
+
+    BENCHMARK( "instance transforms" )
+    {
+        ac_mat4_from_trs_n(transforms.data(), translations.data(), rotations.data(), nullptr, count);
+        return transforms[0].data[0];
+    };
+
+    BENCHMARK( "transform points" )
+    {
+        ac_mat4_transform_points_n(points.data(), &m, points.data(), count);
+        return points[0].x;
+    };
+}
@@ -0,0 +1,68 @@
+#include <ace/math/math.h>
+#include <ace/math/quat.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <math.h>
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE( "ac_quat_rotate", "[ac_quat]" ) {
+    ac_vec3 up = { 0.0f, 1.0f, 0.0f };
+    ac_vec3 v  = { 1.0f, 0.0f, 0.0f };
+
+    SECTION( "identity" ) {
+        ac_quat q      = ac_quat_identity();
+        ac_vec3 result = ac_quat_rotate(&q, &v);
+        REQUIRE(ac_vec3_is_equal(&result, &v));
+    }
+
+    SECTION( "quarter turn about y" ) {
+        ac_quat q      = ac_quat_from_axis_angle(&up, AC_PI * 0.5f);
+        ac_vec3 result = ac_quat_rotate(&q, &v);
+        REQUIRE_THAT(result.x, WithinAbs(0.0f, 1e-6f));
+        REQUIRE_THAT(result.z, WithinAbs(-1.0f, 1e-6f));
+    }
+
+    SECTION( "conjugate undoes the rotation" ) {
+        ac_vec3 axis    = { 0.0f, 0.6f, 0.8f };
+        ac_quat q       = ac_quat_from_axis_angle(&axis, 1.3f);
+        ac_quat inverse = ac_quat_conjugate(&q);
+        ac_vec3 rotated = ac_quat_rotate(&q, &v);
+        ac_vec3 result  = ac_quat_rotate(&inverse, &rotated);
+        REQUIRE(ac_vec3_is_equal(&result, &v));
+    }
+
+    SECTION( "products compose rotations" ) {
+        ac_quat a        = ac_quat_from_axis_angle(&up, 0.4f);
+        ac_quat b        = ac_quat_from_axis_angle(&up, 0.7f);
+        ac_quat ab       = ac_quat_mul(&a, &b);
+        ac_quat expected = ac_quat_from_axis_angle(&up, 1.1f);
+        for ( int i = 0; i < 4; i++ )
+        {
+            REQUIRE_THAT(ab.data[i], WithinAbs(expected.data[i], 1e-6f));
+        }
+    }
+}
+
+TEST_CASE( "ac_quat_integrate", "[ac_quat]" ) {
+    SECTION( "a full turn in small steps" ) {
+        ac_vec3 spin = { 0.0f, 2.0f * AC_PI, 0.0f };
+        ac_quat q    = ac_quat_identity();
+        for ( int i = 0; i < 1000; i++ )
+        {
+            q = ac_quat_integrate(&q, &spin, 0.001f);
+        }
+        ac_vec3 v      = { 1.0f, 0.0f, 0.0f };
+        ac_vec3 result = ac_quat_rotate(&q, &v);
+        REQUIRE_THAT(result.x, WithinAbs(1.0f, 1e-3f));
+        REQUIRE_THAT(result.z, WithinAbs(0.0f, 1e-2f));
+        float length = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        REQUIRE_THAT(length, WithinAbs(1.0f, 1e-6f));
+    }
+
+    SECTION( "zero length normalises to the identity" ) {
+        ac_quat zero   = { 0.0f, 0.0f, 0.0f, 0.0f };
+        ac_quat result = ac_quat_normalize(&zero);
+        REQUIRE(result.w == 1.0f);
+    }
+}
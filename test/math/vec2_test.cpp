@@ -355,6 +355,19 @@ TEST_CASE( "ac_ivec2_add", "[ac_vec2]" ) {
         ac_ivec2 result = ac_ivec2_add(&a, &b);
         REQUIRE(ac_ivec2_is_equal(&result, &ab_result) == true);
     }
+
+    SECTION( "overflowing vectors" ) {
+        ac_ivec2 a = {INT_MAX, 1};
+        ac_ivec2 b = {1, 0};
+        ac_ivec2 result = ac_ivec2_add(&a, &b);
+        REQUIRE(result.x == INT_INVALID);
+        REQUIRE(result.y == INT_INVALID);
+
+        ac_ivec2 c = {-INT_MAX, 0};
+        ac_ivec2 d = {-INT_MAX, 0};
+        result = ac_ivec2_add(&c, &d);
+        REQUIRE(ac_ivec2_is_invalid(&result) == true);
+    }
 }
 
 TEST_CASE( "ac_ivec2_sub", "[ac_vec2]" ) {
@@ -376,6 +389,14 @@ TEST_CASE( "ac_ivec2_sub", "[ac_vec2]" ) {
         ac_ivec2 result = ac_ivec2_sub(&a, &b);
         REQUIRE(ac_ivec2_is_equal(&result, &ab_result) == true);
     }
+
+    SECTION( "overflowing vectors" ) {
+        ac_ivec2 a = {-INT_MAX, 0};
+        ac_ivec2 b = {1, 0};
+        ac_ivec2 result = ac_ivec2_sub(&a, &b);
+        REQUIRE(result.x == INT_INVALID);
+        REQUIRE(result.y == INT_INVALID);
+    }
 }
 
 TEST_CASE( "ac_ivec2_negate", "[ac_vec2]" ) {
@@ -412,6 +433,16 @@ TEST_CASE( "ac_ivec2_scale", "[ac_vec2]" ) {
         ac_ivec2 result = ac_ivec2_scale(&v, 2);
         REQUIRE(ac_ivec2_is_equal(&result, &expected) == true);
     }
+
+    SECTION( "overflowing vector" ) {
+        ac_ivec2 v = {0, 1 << 30};
+        ac_ivec2 result = ac_ivec2_scale(&v, 2);
+        REQUIRE(result.x == INT_INVALID);
+        REQUIRE(ac_ivec2_is_invalid(&result) == true);
+
+        result = ac_ivec2_scale(&v, -2);
+        REQUIRE(ac_ivec2_is_invalid(&result) == true);
+    }
 }
 
 TEST_CASE( "ac_ivec2_divide", "[ac_vec2]" ) {
@@ -0,0 +1,279 @@
+#include <ace/math/vec3_batch.h>
+#include <ace/math/vec3_ext.h>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+// an odd count so that the vectorised loops also run their scalar remainders
+static const size_t count = 37;
+
+static std::vector<ac_vec3> make_vectors(float seed)
+{
+    std::vector<ac_vec3> vectors(count);
+    for ( size_t i = 0; i < count; i++ )
+    {
+        float f    = (float) i + seed;
+        vectors[i] = { { sinf(f) * 3.0f, cosf(f * 0.7f), f * 0.25f - 4.0f } };
+    }
+    return vectors;
+}
+
+// compilers may fuse the multiply-adds differently in the two versions outside deterministic builds
+static bool same_float(float a, float b)
+{
+    return (isnan(a) && isnan(b)) || fabsf(a - b) <= 1e-5f;
+}
+
+static bool same_vec3(const ac_vec3& a, const ac_vec3& b)
+{
+    return same_float(a.x, b.x) && same_float(a.y, b.y) && same_float(a.z, b.z);
+}
+
+// copies an array of structures into separate component arrays
+struct Lanes
+{
+    std::vector<float> x, y, z;
+
+    explicit Lanes(const std::vector<ac_vec3>& vectors)
+    {
+        for ( const ac_vec3& v : vectors )
+        {
+            x.push_back(v.x);
+            y.push_back(v.y);
+            z.push_back(v.z);
+        }
+    }
+
+    ac_vec3_soa soa() { return { x.data(), y.data(), z.data() }; }
+
+    ac_vec3 at(size_t i) const { return { { x[i], y[i], z[i] } }; }
+};
+
+TEST_CASE( "ac_vec3 batch functions match the single vector functions", "[ac_vec3_batch]" ) {
+    std::vector<ac_vec3> a = make_vectors(0.0f);
+    std::vector<ac_vec3> b = make_vectors(11.0f);
+    std::vector<ac_vec3> out(count);
+    std::vector<float>   scalars(count);
+    Lanes                a_lanes(a);
+    Lanes                b_lanes(b);
+    Lanes                out_lanes(out);
+    ac_vec3_soa          a_soa   = a_lanes.soa();
+    ac_vec3_soa          b_soa   = b_lanes.soa();
+    ac_vec3_soa          out_soa = out_lanes.soa();
+
+    SECTION( "add" ) {
+        ac_vec3_add_n(out.data(), a.data(), b.data(), count);
+        ac_vec3_soa_add_n(&out_soa, &a_soa, &b_soa, count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_vec3 expected = ac_vec3_add(&a[i], &b[i]);
+            CAPTURE(i);
+            REQUIRE(same_vec3(out[i], expected));
+            REQUIRE(same_vec3(out_lanes.at(i), expected));
+        }
+    }
+
+    SECTION( "scale add" ) {
+        ac_vec3_scale_add_n(out.data(), a.data(), 0.3f, b.data(), count);
+        ac_vec3_soa_scale_add_n(&out_soa, &a_soa, 0.3f, &b_soa, count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_vec3 scaled   = ac_vec3_scale(&a[i], 0.3f);
+            ac_vec3 expected = ac_vec3_add(&scaled, &b[i]);
+            CAPTURE(i);
+            REQUIRE(same_vec3(out[i], expected));
+            REQUIRE(same_vec3(out_lanes.at(i), expected));
+        }
+    }
+
+    SECTION( "dot" ) {
+        std::vector<float> lane_scalars(count);
+        ac_vec3_dot_n(scalars.data(), a.data(), b.data(), count);
+        ac_vec3_soa_dot_n(lane_scalars.data(), &a_soa, &b_soa, count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            CAPTURE(i);
+            REQUIRE(same_float(scalars[i], ac_vec3_dot(&a[i], &b[i])));
+            REQUIRE(same_float(lane_scalars[i], scalars[i]));
+        }
+    }
+
+    SECTION( "length squared" ) {
+        std::vector<float> lane_scalars(count);
+        ac_vec3_length_sq_n(scalars.data(), a.data(), count);
+        ac_vec3_soa_length_sq_n(lane_scalars.data(), &a_soa, count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            CAPTURE(i);
+            REQUIRE(same_float(scalars[i], ac_vec3_dot(&a[i], &a[i])));
+            REQUIRE(same_float(lane_scalars[i], scalars[i]));
+        }
+    }
+
+    SECTION( "normalize" ) {
+        // include degenerate vectors, which normalize to NaN
+        a[3]    = ac_vec3_zero();
+        a[20]   = ac_vec3_nan();
+        a_lanes = Lanes(a);
+        a_soa   = a_lanes.soa();
+        ac_vec3_normalize_n(out.data(), a.data(), count);
+        ac_vec3_soa_normalize_n(&out_soa, &a_soa, count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_vec3 expected = ac_vec3_normalize(&a[i]);
+            CAPTURE(i);
+            REQUIRE(same_vec3(out[i], expected));
+            REQUIRE(same_vec3(out_lanes.at(i), expected));
+        }
+        REQUIRE(ac_vec3_is_nan(&out[3]));
+        REQUIRE(ac_vec3_is_nan(&out[20]));
+    }
+
+    SECTION( "lerp" ) {
+        float factor = GENERATE( -1.0f, 0.25f, 2.0f );
+        ac_vec3_lerp_n(out.data(), a.data(), b.data(), factor, count);
+        ac_vec3_soa_lerp_n(&out_soa, &a_soa, &b_soa, factor, count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_vec3 expected = ac_vec3_lerp(&a[i], &b[i], factor);
+            CAPTURE(factor, i);
+            REQUIRE(same_vec3(out[i], expected));
+            REQUIRE(same_vec3(out_lanes.at(i), expected));
+        }
+    }
+
+    SECTION( "in place" ) {
+        std::vector<ac_vec3> expected(count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_vec3 scaled = ac_vec3_scale(&a[i], 0.5f);
+            expected[i]    = ac_vec3_add(&scaled, &b[i]);
+        }
+        ac_vec3_scale_add_n(b.data(), a.data(), 0.5f, b.data(), count);
+        ac_vec3_soa_scale_add_n(&b_soa, &a_soa, 0.5f, &b_soa, count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            CAPTURE(i);
+            REQUIRE(same_vec3(b[i], expected[i]));
+            REQUIRE(same_vec3(b_lanes.at(i), expected[i]));
+        }
+    }
+
+    SECTION( "empty arrays" ) {
+        ac_vec3_add_n(nullptr, nullptr, nullptr, 0);
+        ac_vec3_soa_normalize_n(&out_soa, &a_soa, 0);
+        REQUIRE(same_vec3(out[0], ac_vec3_zero()));
+    }
+}
+
+TEST_CASE( "ac_ivec3 batch functions match the single vector functions", "[ac_vec3_batch]" ) {
+    std::vector<ac_ivec3> a(count);
+    std::vector<ac_ivec3> b(count);
+    std::vector<ac_ivec3> out(count);
+    for ( size_t i = 0; i < count; i++ )
+    {
+        int n = (int) i;
+        a[i]  = { { n * 7 - 100, n * n, -n } };
+        b[i]  = { { 3 - n, n * 11, n * 1000 } };
+    }
+
+    // include invalid vectors and components that overflow
+    a[2]  = ac_ivec3_invalid();
+    b[5]  = ac_ivec3_invalid();
+    a[9]  = { { INT_MAX, 0, 0 } };
+    b[9]  = { { 1, 0, 0 } };
+    a[14] = { { -INT_MAX, 0, 0 } };
+    b[14] = { { 1, 0, 0 } };
+    a[30] = { { 0, 0, 1 << 30 } };
+
+    SECTION( "add" ) {
+        ac_ivec3_add_n(out.data(), a.data(), b.data(), count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_ivec3 expected = ac_ivec3_add(&a[i], &b[i]);
+            CAPTURE(i);
+            REQUIRE(memcmp(&out[i], &expected, sizeof(ac_ivec3)) == 0);
+        }
+        REQUIRE(ac_ivec3_is_invalid(&out[9]));
+    }
+
+    SECTION( "sub" ) {
+        ac_ivec3_sub_n(out.data(), a.data(), b.data(), count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_ivec3 expected = ac_ivec3_sub(&a[i], &b[i]);
+            CAPTURE(i);
+            REQUIRE(memcmp(&out[i], &expected, sizeof(ac_ivec3)) == 0);
+        }
+        REQUIRE(ac_ivec3_is_invalid(&out[14]));
+    }
+
+    SECTION( "scale" ) {
+        ac_ivec3_scale_n(out.data(), a.data(), -2, count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_ivec3 expected = ac_ivec3_scale(&a[i], -2);
+            CAPTURE(i);
+            REQUIRE(memcmp(&out[i], &expected, sizeof(ac_ivec3)) == 0);
+        }
+        REQUIRE(ac_ivec3_is_invalid(&out[30]));
+    }
+}
+
+TEST_CASE( "ac_vec3 batch benchmark", "[.][benchmark][ac_vec3_batch]" ) {
+    const size_t         n = 4096;
+    std::vector<ac_vec3> positions(n, ac_vec3{ { 1.0f, 2.0f, 3.0f } });
+    std::vector<ac_vec3> velocities(n, ac_vec3{ { 0.5f, -1.0f, 0.25f } });
+
+    BENCHMARK( "scale add, one vector at a time" )
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            ac_vec3 step = ac_vec3_scale(&velocities[i], 0.016f);
+            positions[i] = ac_vec3_add(&positions[i], &step);
+        }
+        return positions[0].x;
+    };
+
+    BENCHMARK( "scale add, batch" )
+    {
+        ac_vec3_scale_add_n(positions.data(), velocities.data(), 0.016f, positions.data(), n);
+        return positions[0].x;
+    };
+
+    BENCHMARK( "normalize, one vector at a time" )
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            velocities[i] = ac_vec3_normalize(&velocities[i]);
+        }
+        return velocities[0].x;
+    };
+
+    BENCHMARK( "normalize, batch" )
+    {
+        ac_vec3_normalize_n(velocities.data(), velocities.data(), n);
+        return velocities[0].x;
+    };
+
+    std::vector<ac_ivec3> cells(n, ac_ivec3{ { 10, -20, 30 } });
+    std::vector<ac_ivec3> offsets(n, ac_ivec3{ { 1, 0, -1 } });
+
+    BENCHMARK( "ivec3 add, one vector at a time" )
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            cells[i] = ac_ivec3_add(&cells[i], &offsets[i]);
+        }
+        return cells[0].x;
+    };
+
+    BENCHMARK( "ivec3 add, batch" )
+    {
+        ac_ivec3_add_n(cells.data(), cells.data(), offsets.data(), n);
+        return cells[0].x;
+    };
+}
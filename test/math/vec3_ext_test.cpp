@@ -1,8 +1,10 @@
 #include <ace/math/math.h>
 #include <ace/math/vec3_ext.h>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <math.h>
+#include <vector>
 
 TEST_CASE( "ac_vec3_angle", "[ac_vec3]" ) {
     SECTION( "zero magnitude vectors" ) {
@@ -266,3 +268,67 @@ TEST_CASE( "ac_vec3_reflect", "[ac_vec3]" ) {
         REQUIRE(ac_vec3_is_equal(&result, &expected) == true);
     }
 }
+
+TEST_CASE( "ac_vec3 unchecked functions", "[ac_vec3]" ) {
+    // the unchecked functions must give exactly what the checked ones give for valid input
+    for ( int i = 1; i < 1000; i++ ) {
+        float f = (float) i;
+        ac_vec3 a = {sinf(f) * 10.0f, cosf(f * 0.3f), f * 0.01f};
+        ac_vec3 b = {cosf(f) + 2.0f, sinf(f * 0.7f) * 5.0f, -f * 0.02f};
+        ac_vec3 n = ac_vec3_normalize(&b);
+
+        REQUIRE(ac_vec3_angle_unchecked(&a, &b) == ac_vec3_angle(&a, &b));
+
+        ac_vec3 projected = ac_vec3_project_unchecked(&a, &b);
+        ac_vec3 expected = ac_vec3_project(&a, &b);
+        REQUIRE(ac_vec3_is_equal(&projected, &expected) == true);
+
+        ac_vec3 reflected = ac_vec3_reflect_unchecked(&a, &n);
+        expected = ac_vec3_reflect(&a, &b);
+        REQUIRE(ac_vec3_is_equal(&reflected, &expected) == true);
+    }
+}
+
+TEST_CASE( "ac_vec3 unchecked benchmark", "[.][benchmark][ac_vec3]" ) {
+    const size_t count = 4096;
+    std::vector<ac_vec3> a(count);
+    std::vector<ac_vec3> b(count);
+    for ( size_t i = 0; i < count; i++ ) {
+        float f = (float) i + 1.0f;
+        a[i] = {sinf(f), cosf(f), f * 0.001f};
+        b[i] = {cosf(f * 0.5f), 1.0f, sinf(f * 0.5f)};
+        b[i] = ac_vec3_normalize(&b[i]);
+    }
+
+    BENCHMARK( "ac_vec3_project" ) {
+        float sum = 0.0f;
+        for ( size_t i = 0; i < count; i++ ) {
+            sum += ac_vec3_project(&a[i], &b[i]).x;
+        }
+        return sum;
+    };
+
+    BENCHMARK( "ac_vec3_project_unchecked" ) {
+        float sum = 0.0f;
+        for ( size_t i = 0; i < count; i++ ) {
+            sum += ac_vec3_project_unchecked(&a[i], &b[i]).x;
+        }
+        return sum;
+    };
+
+    BENCHMARK( "ac_vec3_reflect" ) {
+        float sum = 0.0f;
+        for ( size_t i = 0; i < count; i++ ) {
+            sum += ac_vec3_reflect(&a[i], &b[i]).x;
+        }
+        return sum;
+    };
+
+    BENCHMARK( "ac_vec3_reflect_unchecked" ) {
+        float sum = 0.0f;
+        for ( size_t i = 0; i < count; i++ ) {
+            sum += ac_vec3_reflect_unchecked(&a[i], &b[i]).x;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,302 @@
+#include <ace/math/vec3_pack.h>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+// an odd count so that the vectorised loops also run their scalar remainders
+static const size_t count = 1001;
+
+static std::vector<ac_vec3> make_vectors()
+{
+    std::vector<ac_vec3> vectors(count);
+    for ( size_t i = 0; i < count; i++ )
+    {
+        float f    = (float) i;
+        vectors[i] = { { sinf(f) * 90.0f, cosf(f * 0.7f) * 0.01f, f * 0.25f - 120.0f } };
+    }
+    return vectors;
+}
+
+// the value of a half computed independently in double precision
+static double half_reference(uint16_t half)
+{
+    int    exponent = (half >> 10) & 0x1F;
+    int    fraction = half & 0x3FF;
+    double sign     = (half & 0x8000) ? -1.0 : 1.0;
+    if ( exponent == 0 )
+    {
+        return sign * ldexp(fraction, -24);
+    }
+    return sign * ldexp(fraction + 1024, exponent - 25);
+}
+
+// compilers may fuse the multiply-adds differently in the two versions outside deterministic builds
+static bool same_vec3(const ac_vec3& a, const ac_vec3& b)
+{
+    return fabsf(a.x - b.x) <= 1e-5f && fabsf(a.y - b.y) <= 1e-5f && fabsf(a.z - b.z) <= 1e-5f;
+}
+
+TEST_CASE( "ac_half_to_float", "[pack]" ) {
+    for ( uint32_t half = 0; half < 0x10000; half++ )
+    {
+        float value = ac_half_to_float((uint16_t) half);
+        if ( (half & 0x7C00) == 0x7C00 )
+        {
+            // the largest exponent is infinity or NaN
+            REQUIRE( (half & 0x3FF ? isnan(value) : isinf(value)) );
+            continue;
+        }
+        REQUIRE( (double) value == half_reference((uint16_t) half) );
+        REQUIRE( ac_float_to_half(value) == half );
+    }
+}
+
+TEST_CASE( "ac_float_to_half", "[pack]" ) {
+    REQUIRE( ac_float_to_half(1.0f) == 0x3C00 );
+    REQUIRE( ac_float_to_half(-2.0f) == 0xC000 );
+    REQUIRE( ac_float_to_half(-0.0f) == 0x8000 );
+    REQUIRE( ac_float_to_half(65504.0f) == 0x7BFF );
+    REQUIRE( ac_float_to_half(65519.0f) == 0x7BFF );
+    REQUIRE( ac_float_to_half(65520.0f) == 0x7C00 );  // the tie rounds up to infinity
+    REQUIRE( ac_float_to_half(1e10f) == 0x7C00 );
+    REQUIRE( ac_float_to_half(-INFINITY) == 0xFC00 );
+    REQUIRE( isnan(ac_half_to_float(ac_float_to_half(NAN))) );
+    REQUIRE( ac_float_to_half(ldexpf(1.0f, -24)) == 0x0001 );
+    REQUIRE( ac_float_to_half(ldexpf(1.0f, -25)) == 0x0000 );  // ties to even
+    REQUIRE( ac_float_to_half(ldexpf(3.0f, -25)) == 0x0002 );
+    REQUIRE( ac_float_to_half(1.0f + ldexpf(1.0f, -11)) == 0x3C00 );
+    REQUIRE( ac_float_to_half(1.0f + ldexpf(3.0f, -11)) == 0x3C02 );
+
+    // every finite float in range converts to its nearest half
+    for ( float value = 1e-9f; value < 65504.0f; value *= 1.00037f )
+    {
+        uint16_t half  = ac_float_to_half(value);
+        double   error = fabs(half_reference(half) - value);
+        REQUIRE( error <= fabs(half_reference(half + 1) - value) );
+        REQUIRE( error <= fabs(half_reference(half - 1) - value) );
+    }
+}
+
+TEST_CASE( "ac_unorm16_vec3", "[pack]" ) {
+    ac_vec3 min = { { -100.0f, -1.0f, 0.0f } };
+    ac_vec3 max = { { 100.0f, 1.0f, 1000.0f } };
+
+    SECTION( "round trips within about half a step" )
+    {
+        std::vector<ac_vec3> vectors = make_vectors();
+        for ( const ac_vec3& v : vectors )
+        {
+            ac_vec3 clamped = v;
+            for ( int i = 0; i < 3; i++ )
+            {
+                clamped.data[i] = fminf(fmaxf(v.data[i], min.data[i]), max.data[i]);
+            }
+            ac_unorm16_vec3 encoded = ac_unorm16_vec3_from_vec3(&v, &min, &max);
+            ac_vec3         decoded = ac_unorm16_vec3_to_vec3(&encoded, &min, &max);
+            for ( int i = 0; i < 3; i++ )
+            {
+                float step = (max.data[i] - min.data[i]) / 65535.0f;
+                REQUIRE( fabsf(decoded.data[i] - clamped.data[i]) <= step * 0.51f );
+            }
+        }
+    }
+
+    SECTION( "bounds, out of range, and NaN" )
+    {
+        ac_vec3         v       = { { -100.0f, 5.0f, NAN } };
+        ac_unorm16_vec3 encoded = ac_unorm16_vec3_from_vec3(&v, &min, &max);
+        REQUIRE( encoded.x == 0 );
+        REQUIRE( encoded.y == 65535 );
+        REQUIRE( encoded.z == 0 );
+
+        encoded = ac_unorm16_vec3_from_vec3(&max, &min, &max);
+        REQUIRE( encoded.x == 65535 );
+        REQUIRE( encoded.z == 65535 );
+    }
+}
+
+TEST_CASE( "ac_oct_normal", "[pack]" ) {
+    SECTION( "round trips within 0.0001 radians" )
+    {
+        // a spiral of directions over the whole sphere
+        const int samples   = 20000;
+        float     max_angle = 0.0f;
+        for ( int i = 0; i < samples; i++ )
+        {
+            float   z      = 1.0f - 2.0f * ((float) i + 0.5f) / (float) samples;
+            float   radius = sqrtf(1.0f - z * z);
+            float   theta  = 2.39996323f * (float) i;
+            ac_vec3 n      = { { radius * cosf(theta), radius * sinf(theta), z } };
+
+            ac_oct_normal encoded = ac_oct_normal_from_vec3(&n);
+            ac_vec3       decoded = ac_oct_normal_to_vec3(&encoded);
+            float         length  = sqrtf(
+                decoded.x * decoded.x + decoded.y * decoded.y + decoded.z * decoded.z
+            );
+            REQUIRE( fabsf(length - 1.0f) <= 1e-6f );
+
+            // the angle from the cross product keeps its precision near zero
+            ac_vec3 cross = { { n.y * decoded.z - n.z * decoded.y,
+                                n.z * decoded.x - n.x * decoded.z,
+                                n.x * decoded.y - n.y * decoded.x } };
+            float   sine  = sqrtf(cross.x * cross.x + cross.y * cross.y + cross.z * cross.z);
+            max_angle     = fmaxf(max_angle, asinf(fminf(sine, 1.0f)));
+        }
+        REQUIRE( max_angle <= 1e-4f );
+    }
+
+    SECTION( "axes are exact" )
+    {
+        for ( int axis = 0; axis < 3; axis++ )
+        {
+            for ( float sign : { -1.0f, 1.0f } )
+            {
+                ac_vec3 n          = { { 0.0f, 0.0f, 0.0f } };
+                n.data[axis]       = sign * 2.0f;
+                ac_oct_normal code = ac_oct_normal_from_vec3(&n);
+                ac_vec3       back = ac_oct_normal_to_vec3(&code);
+                REQUIRE( back.data[axis] == sign );
+                REQUIRE( back.data[(axis + 1) % 3] == 0.0f );
+                REQUIRE( back.data[(axis + 2) % 3] == 0.0f );
+            }
+        }
+    }
+
+    SECTION( "zero and NaN vectors decode as +z" )
+    {
+        ac_vec3 inputs[2] = { { { 0.0f, 0.0f, 0.0f } }, { { NAN, 0.0f, -1.0f } } };
+        for ( const ac_vec3& n : inputs )
+        {
+            ac_oct_normal code = ac_oct_normal_from_vec3(&n);
+            ac_vec3       back = ac_oct_normal_to_vec3(&code);
+            REQUIRE( back.z == 1.0f );
+        }
+    }
+}
+
+TEST_CASE( "packed vector batches", "[pack]" ) {
+    std::vector<ac_vec3> vectors = make_vectors();
+    vectors[3]                   = { { NAN, INFINITY, 0.0f } };
+    ac_vec3 min                  = { { -100.0f, -1.0f, 0.0f } };
+    ac_vec3 max                  = { { 100.0f, 1.0f, 1000.0f } };
+
+    SECTION( "half-precision" )
+    {
+        std::vector<ac_half_vec3> encoded(count);
+        std::vector<ac_vec3>      decoded(count);
+        ac_half_vec3_from_vec3_n(encoded.data(), vectors.data(), count);
+        ac_half_vec3_to_vec3_n(decoded.data(), encoded.data(), count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_half_vec3 expected = ac_half_vec3_from_vec3(&vectors[i]);
+            ac_vec3      back     = ac_half_vec3_to_vec3(&expected);
+            REQUIRE( memcmp(&encoded[i], &expected, sizeof(ac_half_vec3)) == 0 );
+            REQUIRE( memcmp(&decoded[i], &back, sizeof(ac_vec3)) == 0 );
+        }
+    }
+
+    SECTION( "bounded 16-bit" )
+    {
+        std::vector<ac_unorm16_vec3> encoded(count);
+        std::vector<ac_vec3>         decoded(count);
+        ac_unorm16_vec3_from_vec3_n(encoded.data(), vectors.data(), &min, &max, count);
+        ac_unorm16_vec3_to_vec3_n(decoded.data(), encoded.data(), &min, &max, count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_unorm16_vec3 expected = ac_unorm16_vec3_from_vec3(&vectors[i], &min, &max);
+            ac_vec3         back     = ac_unorm16_vec3_to_vec3(&expected, &min, &max);
+            REQUIRE( memcmp(&encoded[i], &expected, sizeof(ac_unorm16_vec3)) == 0 );
+            REQUIRE( same_vec3(decoded[i], back) );
+        }
+    }
+
+    SECTION( "octahedral" )
+    {
+        std::vector<ac_oct_normal> encoded(count);
+        std::vector<ac_vec3>       decoded(count);
+        ac_oct_normal_from_vec3_n(encoded.data(), vectors.data(), count);
+        ac_oct_normal_to_vec3_n(decoded.data(), encoded.data(), count);
+        for ( size_t i = 0; i < count; i++ )
+        {
+            ac_oct_normal expected = ac_oct_normal_from_vec3(&vectors[i]);
+            ac_vec3       back     = ac_oct_normal_to_vec3(&expected);
+            REQUIRE( memcmp(&encoded[i], &expected, sizeof(ac_oct_normal)) == 0 );
+            REQUIRE( same_vec3(decoded[i], back) );
+        }
+    }
+}
+
+TEST_CASE( "packed vector benchmark", "[.][benchmark][pack]" ) {
+    const size_t               n = 4096;
+    std::vector<ac_vec3>       vectors(n);
+    std::vector<ac_half_vec3>  halves(n);
+    std::vector<ac_oct_normal> normals(n);
+    std::vector<ac_vec3>       decoded(n);
+    for ( size_t i = 0; i < n; i++ )
+    {
+        float f    = (float) i;
+        vectors[i] = { { sinf(f), cosf(f), f * 0.001f } };
+    }
+
+    BENCHMARK( "ac_half_vec3_from_vec3" )
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            halves[i] = ac_half_vec3_from_vec3(&vectors[i]);
+        }
+        return halves[n - 1].x;
+    };
+
+    BENCHMARK( "ac_half_vec3_from_vec3_n" )
+    {
+        ac_half_vec3_from_vec3_n(halves.data(), vectors.data(), n);
+        return halves[n - 1].x;
+    };
+
+    BENCHMARK( "ac_half_vec3_to_vec3" )
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            decoded[i] = ac_half_vec3_to_vec3(&halves[i]);
+        }
+        return decoded[n - 1].x;
+    };
+
+    BENCHMARK( "ac_half_vec3_to_vec3_n" )
+    {
+        ac_half_vec3_to_vec3_n(decoded.data(), halves.data(), n);
+        return decoded[n - 1].x;
+    };
+
+    BENCHMARK( "ac_oct_normal_from_vec3" )
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            normals[i] = ac_oct_normal_from_vec3(&vectors[i]);
+        }
+        return normals[n - 1].x;
+    };
+
+    BENCHMARK( "ac_oct_normal_from_vec3_n" )
+    {
+        ac_oct_normal_from_vec3_n(normals.data(), vectors.data(), n);
+        return normals[n - 1].x;
+    };
+
+    BENCHMARK( "ac_oct_normal_to_vec3" )
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            decoded[i] = ac_oct_normal_to_vec3(&normals[i]);
+        }
+        return decoded[n - 1].x;
+    };
+
+    BENCHMARK( "ac_oct_normal_to_vec3_n" )
+    {
+        ac_oct_normal_to_vec3_n(decoded.data(), normals.data(), n);
+        return decoded[n - 1].x;
+    };
+}
@@ -22,6 +22,22 @@ TEST_CASE( "ac_vec3 union aliases", "[ac_vec3]" ) {
     REQUIRE(v.data[2] == 3.0f);
 }
 
+TEST_CASE( "ac_vec3_make", "[ac_vec3]" ) {
+    ac_vec3 v = ac_vec3_make(1.0f, 2.0f, 3.0f);
+    REQUIRE(v.x == 1.0f);
+    REQUIRE(v.y == 2.0f);
+    REQUIRE(v.z == 3.0f);
+
+    ac_vec3 literal = AC_VEC3_LITERAL(1.0f, 2.0f, 3.0f);
+    REQUIRE(ac_vec3_is_equal(&literal, &v) == true);
+
+    ac_vec3 zero = AC_VEC3_ZERO;
+    REQUIRE(ac_vec3_is_zero(&zero) == true);
+
+    ac_vec3 nan = AC_VEC3_NAN;
+    REQUIRE(ac_vec3_is_nan(&nan) == true);
+}
+
 TEST_CASE( "ac_vec3_zero", "[ac_vec3]" ) {
     ac_vec3 zero = ac_vec3_zero();
     REQUIRE(zero.x == 0.0f);
@@ -402,6 +418,19 @@ TEST_CASE( "ac_ivec3_add", "[ac_vec3]" ) {
         ac_ivec3 result = ac_ivec3_add(&a, &b);
         REQUIRE(ac_ivec3_is_equal(&result, &ab_result) == true);
     }
+
+    SECTION( "overflowing vectors" ) {
+        ac_ivec3 a = {INT_MAX, 1, 1};
+        ac_ivec3 b = {1, 0, 0};
+        ac_ivec3 result = ac_ivec3_add(&a, &b);
+        REQUIRE(result.x == INT_INVALID);
+        REQUIRE(result.y == INT_INVALID);
+
+        ac_ivec3 c = {-INT_MAX, 0, 0};
+        ac_ivec3 d = {-INT_MAX, 0, 0};
+        result = ac_ivec3_add(&c, &d);
+        REQUIRE(ac_ivec3_is_invalid(&result) == true);
+    }
 }
 
 TEST_CASE( "ac_ivec3_sub", "[ac_vec3]" ) {
@@ -423,6 +452,14 @@ TEST_CASE( "ac_ivec3_sub", "[ac_vec3]" ) {
         ac_ivec3 result = ac_ivec3_sub(&a, &b);
         REQUIRE(ac_ivec3_is_equal(&result, &ab_result) == true);
     }
+
+    SECTION( "overflowing vectors" ) {
+        ac_ivec3 a = {-INT_MAX, 0, 0};
+        ac_ivec3 b = {1, 0, 0};
+        ac_ivec3 result = ac_ivec3_sub(&a, &b);
+        REQUIRE(result.x == INT_INVALID);
+        REQUIRE(result.y == INT_INVALID);
+    }
 }
 
 TEST_CASE( "ac_ivec3_negate", "[ac_vec3]" ) {
@@ -459,6 +496,16 @@ TEST_CASE( "ac_ivec3_scale", "[ac_vec3]" ) {
         ac_ivec3 result = ac_ivec3_scale(&v, 2);
         REQUIRE(ac_ivec3_is_equal(&result, &expected) == true);
     }
+
+    SECTION( "overflowing vector" ) {
+        ac_ivec3 v = {0, 0, 1 << 30};
+        ac_ivec3 result = ac_ivec3_scale(&v, 2);
+        REQUIRE(result.x == INT_INVALID);
+        REQUIRE(ac_ivec3_is_invalid(&result) == true);
+
+        result = ac_ivec3_scale(&v, -2);
+        REQUIRE(ac_ivec3_is_invalid(&result) == true);
+    }
 }
 
 TEST_CASE( "ac_ivec3_divide", "[ac_vec3]" ) {
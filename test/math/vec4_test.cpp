@@ -0,0 +1,285 @@
+#include <ace/math/math.h>
+#include <ace/math/vec4.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <math.h>
+#include <stdint.h>
+
+TEST_CASE( "ac_vec4 union aliases", "[ac_vec4]" ) {
+    ac_vec4 v = {1.0f, 2.0f, 3.0f, 4.0f};
+    REQUIRE(v.x == 1.0f);
+    REQUIRE(v.y == 2.0f);
+    REQUIRE(v.z == 3.0f);
+    REQUIRE(v.w == 4.0f);
+    REQUIRE(v.r == 1.0f);
+    REQUIRE(v.g == 2.0f);
+    REQUIRE(v.b == 3.0f);
+    REQUIRE(v.a == 4.0f);
+    REQUIRE(v.data[0] == 1.0f);
+    REQUIRE(v.data[1] == 2.0f);
+    REQUIRE(v.data[2] == 3.0f);
+    REQUIRE(v.data[3] == 4.0f);
+}
+
+TEST_CASE( "ac_vec4 alignment", "[ac_vec4]" ) {
+    REQUIRE(sizeof(ac_vec4) == 16);
+    REQUIRE(alignof(ac_vec4) == 16);
+
+    ac_vec4 values[3];
+    for ( int i = 0; i < 3; i++ )
+    {
+        REQUIRE(reinterpret_cast<uintptr_t>(&values[i]) % 16 == 0);
+    }
+}
+
+TEST_CASE( "ac_vec4_zero", "[ac_vec4]" ) {
+    ac_vec4 zero = ac_vec4_zero();
+    REQUIRE(zero.x == 0.0f);
+    REQUIRE(zero.y == 0.0f);
+    REQUIRE(zero.z == 0.0f);
+    REQUIRE(zero.w == 0.0f);
+}
+
+TEST_CASE( "ac_vec4_nan", "[ac_vec4]" ) {
+    ac_vec4 nan = ac_vec4_nan();
+    REQUIRE(isnan(nan.x));
+    REQUIRE(isnan(nan.y));
+    REQUIRE(isnan(nan.z));
+    REQUIRE(isnan(nan.w));
+}
+
+TEST_CASE( "ac_vec4 conversion", "[ac_vec4]" ) {
+    ac_vec3 v = {1.0f, 2.0f, 3.0f};
+
+    SECTION( "from vec3" ) {
+        ac_vec4 point = ac_vec4_from_vec3(&v, 1.0f);
+        REQUIRE(point.x == 1.0f);
+        REQUIRE(point.y == 2.0f);
+        REQUIRE(point.z == 3.0f);
+        REQUIRE(point.w == 1.0f);
+    }
+
+    SECTION( "round trip" ) {
+        ac_vec4 wide   = ac_vec4_from_vec3(&v, 0.0f);
+        ac_vec3 result = ac_vec4_to_vec3(&wide);
+        REQUIRE(result.x == v.x);
+        REQUIRE(result.y == v.y);
+        REQUIRE(result.z == v.z);
+    }
+
+    SECTION( "matches vec3 results" ) {
+        ac_vec3 u      = {-0.3f, 1.7f, 2.2f};
+        ac_vec4 a      = ac_vec4_from_vec3(&v, 0.0f);
+        ac_vec4 b      = ac_vec4_from_vec3(&u, 0.0f);
+        ac_vec4 cross  = ac_vec4_cross(&a, &b);
+        ac_vec3 narrow = ac_vec4_to_vec3(&cross);
+        ac_vec3 wanted = ac_vec3_cross(&v, &u);
+        REQUIRE(ac_vec3_is_equal(&narrow, &wanted) == true);
+        REQUIRE(cross.w == 0.0f);
+        REQUIRE_THAT(ac_vec4_dot(&a, &b), Catch::Matchers::WithinAbs(ac_vec3_dot(&v, &u), 1e-6f));
+    }
+}
+
+TEST_CASE( "ac_vec4_is_zero", "[ac_vec4]") {
+    auto [input, expected] = GENERATE( Catch::Generators::table<ac_vec4, bool>({
+        { ac_vec4_zero(), true },
+        { {-0.0f, 0.0f, 0.0f, 0.0f }, true },
+        { {0.0f, 0.0f, 0.0f, -0.0f }, true },
+
+        { ac_vec4_nan(), false },
+        { {1.0f, 0.0f, 0.0f, 0.0f }, false },
+        { {0.0f, 1.0f, 0.0f, 0.0f }, false },
+        { {0.0f, 0.0f, 1.0f, 0.0f }, false },
+        { {0.0f, 0.0f, 0.0f, 1.0f }, false },
+    }));
+
+    CAPTURE(input.x, input.y, input.z, input.w);
+    REQUIRE(ac_vec4_is_zero(&input) == expected);
+}
+
+TEST_CASE( "ac_vec4_is_nan", "[ac_vec4]" ) {
+    SECTION( "nan vectors" ) {
+        float x = GENERATE( Catch::Generators::values<float>({NAN, 0.0f}));
+        float w = GENERATE( Catch::Generators::values<float>({NAN, 0.0f}));
+
+        ac_vec4 v = {x, 0.0f, 0.0f, w};
+        // we only want to check the generator expressions that are not all zero
+        if (!ac_vec4_is_zero(&v))
+        {
+            CAPTURE( x, w );
+            REQUIRE(ac_vec4_is_nan(&v) == true);
+        }
+    }
+
+    SECTION( "non-nan vectors" ) {
+        ac_vec4 v = {1.0f, 0.0f, 1.0f, 0.0f};
+        REQUIRE(ac_vec4_is_nan(&v) == false);
+    }
+}
+
+TEST_CASE( "ac_vec4_is_equal", "[ac_vec4]" ) {
+    SECTION( "equal vectors" ) {
+        ac_vec4 a = {1.0f, 0.0f, 1.0f, 0.0f};
+        ac_vec4 b = {1.0f, 0.0f, 1.0f, 0.0f};
+        REQUIRE(ac_vec4_is_equal(&a, &b) == true);
+    }
+
+    SECTION( "non-equal vectors" ) {
+        auto [a, b] = GENERATE( Catch::Generators::table<ac_vec4, ac_vec4>({
+            { ac_vec4_nan(), ac_vec4_nan() },
+            { ac_vec4_nan(), ac_vec4_zero() },
+            { ac_vec4_zero(), {1.0f, 0.0f, 0.0f, 0.0f} },
+            { {1.0f, 0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f, 0.0f} },
+            { {0.0f, 0.0f, 0.0f, 1.0f}, ac_vec4_zero() }
+        }));
+
+        CAPTURE(a.x, a.y, a.z, a.w, b.x, b.y, b.z, b.w);
+        REQUIRE(ac_vec4_is_equal(&a, &b) == false);
+    }
+}
+
+TEST_CASE( "ac_vec4_add", "[ac_vec4]" ) {
+    ac_vec4 a = {1.0f, 2.0f, 3.0f, 4.0f};
+    ac_vec4 b = {5.0f, 6.0f, 7.0f, 8.0f};
+    ac_vec4 ab_result = {6.0f, 8.0f, 10.0f, 12.0f};
+    ac_vec4 result = ac_vec4_add(&a, &b);
+    REQUIRE(ac_vec4_is_equal(&result, &ab_result) == true);
+}
+
+TEST_CASE( "ac_vec4_sub", "[ac_vec4]" ) {
+    ac_vec4 a = {1.0f, 2.0f, 3.0f, 4.0f};
+    ac_vec4 b = {5.0f, 6.0f, 7.0f, 8.0f};
+    ac_vec4 ab_result = {-4.0f, -4.0f, -4.0f, -4.0f};
+    ac_vec4 result = ac_vec4_sub(&a, &b);
+    REQUIRE(ac_vec4_is_equal(&result, &ab_result) == true);
+}
+
+TEST_CASE( "ac_vec4_negate", "[ac_vec4]" ) {
+    ac_vec4 a = {1.0f, 2.0f, 3.0f, 0.0f};
+    ac_vec4 a_result = {-1.0f, -2.0f, -3.0f, 0.0f};
+    ac_vec4 result = ac_vec4_negate(&a);
+    REQUIRE(ac_vec4_is_equal(&result, &a_result) == true);
+    REQUIRE(signbit(result.w));
+}
+
+TEST_CASE( "ac_vec4_scale", "[ac_vec4]" ) {
+    ac_vec4 v = {1.0f, 2.0f, 3.0f, 4.0f};
+
+    SECTION( "scaling by 0" ) {
+        ac_vec4 result = ac_vec4_scale(&v, 0.0f);
+        REQUIRE(ac_vec4_is_zero(&result) == true);
+    }
+
+    SECTION( "scaling by 2" ) {
+        ac_vec4 expected = {2.0f, 4.0f, 6.0f, 8.0f};
+        ac_vec4 result = ac_vec4_scale(&v, 2.0f);
+        REQUIRE(ac_vec4_is_equal(&result, &expected) == true);
+    }
+
+    SECTION( "scaling by -1" ) {
+        ac_vec4 expected = {-1.0f, -2.0f, -3.0f, -4.0f};
+        ac_vec4 result = ac_vec4_scale(&v, -1.0f);
+        REQUIRE(ac_vec4_is_equal(&result, &expected) == true);
+    }
+}
+
+TEST_CASE( "ac_vec4_dot", "[ac_vec4]" ) {
+    SECTION( "parallel vectors" ) {
+        ac_vec4 a = {2.0f, 0.0f, 0.0f, 0.0f};
+        ac_vec4 b = {4.0f, 0.0f, 0.0f, 0.0f};
+        REQUIRE(ac_vec4_dot(&a, &b) == 8.0f);
+    }
+
+    SECTION( "perpendicular vectors" ) {
+        ac_vec4 a = {1.0f, 0.0f, 0.0f, 0.0f};
+        ac_vec4 b = {0.0f, 0.0f, 0.0f, 1.0f};
+        REQUIRE(ac_vec4_dot(&a, &b) == 0.0f);
+    }
+
+    SECTION( "all components" ) {
+        ac_vec4 a = {1.0f, 2.0f, 3.0f, 4.0f};
+        ac_vec4 b = {5.0f, 6.0f, 7.0f, 8.0f};
+        REQUIRE(ac_vec4_dot(&a, &b) == 70.0f);
+    }
+
+    SECTION( "fixed summation order" ) {
+        // (x + z) + (y + w) cancels the large terms first, any other order loses the small ones
+        ac_vec4 a = {1e8f, 1.0f, -1e8f, 1.0f};
+        ac_vec4 b = {1.0f, 1.0f, 1.0f, 1.0f};
+        REQUIRE(ac_vec4_dot(&a, &b) == 2.0f);
+    }
+}
+
+TEST_CASE( "ac_vec4_cross", "[ac_vec4]" ) {
+    SECTION( "parallel vectors" ) {
+        ac_vec4 a = {1.0f, 0.0f, 0.0f, 0.0f};
+        ac_vec4 b = {1.0f, 0.0f, 0.0f, 0.0f};
+        ac_vec4 result = ac_vec4_cross(&a, &b);
+        REQUIRE(ac_vec4_is_zero(&result) == true);
+    }
+
+    SECTION( "perpendicular vectors" ) {
+        ac_vec4 a = {1.0f, 0.0f, 0.0f, 1.0f};
+        ac_vec4 b = {0.0f, 1.0f, 0.0f, 1.0f};
+        ac_vec4 result = ac_vec4_cross(&a, &b);
+        REQUIRE(result.x == 0.0f);
+        REQUIRE(result.y == 0.0f);
+        REQUIRE(result.z == 1.0f);
+        REQUIRE(result.w == 0.0f);
+    }
+}
+
+TEST_CASE( "ac_vec4_magnitude", "[ac_vec4]" ) {
+    SECTION( "zero vector" ) {
+        ac_vec4 zero = ac_vec4_zero();
+        REQUIRE(ac_vec4_magnitude(&zero) == 0.0f);
+    }
+
+    SECTION( "non-unit vector" ) {
+        ac_vec4 v = {1.0f, 1.0f, 1.0f, 1.0f};
+        float result = ac_vec4_magnitude(&v);
+        REQUIRE_THAT(result,
+            Catch::Matchers::WithinRel(2.0f, AC_EPSILON) ||
+            Catch::Matchers::WithinAbs(2.0f, AC_EPSILON)
+        );
+    }
+}
+
+TEST_CASE( "ac_vec4_normalize", "[ac_vec4]" ) {
+    SECTION( "nan vector" ) {
+        ac_vec4 nan = ac_vec4_nan();
+        ac_vec4 result = ac_vec4_normalize(&nan);
+        REQUIRE(ac_vec4_is_nan(&result) == true);
+    }
+
+    SECTION( "zero vector" ) {
+        ac_vec4 zero = ac_vec4_zero();
+        ac_vec4 result = ac_vec4_normalize(&zero);
+        REQUIRE(ac_vec4_is_nan(&result) == true);
+    }
+
+    SECTION( "non-unit vector" ) {
+        ac_vec4 v = {1.0f, 1.0f, 1.0f, 1.0f};
+        ac_vec4 expected = {0.5f, 0.5f, 0.5f, 0.5f};
+        ac_vec4 result = ac_vec4_normalize(&v);
+        REQUIRE(ac_vec4_is_equal(&result, &expected) == true);
+    }
+}
+
+TEST_CASE( "ac_vec4_min and ac_vec4_max", "[ac_vec4]" ) {
+    ac_vec4 a = {1.0f, -2.0f, 3.0f, -4.0f};
+    ac_vec4 b = {-1.0f, 2.0f, -3.0f, 4.0f};
+
+    SECTION( "min" ) {
+        ac_vec4 expected = {-1.0f, -2.0f, -3.0f, -4.0f};
+        ac_vec4 result = ac_vec4_min(&a, &b);
+        REQUIRE(ac_vec4_is_equal(&result, &expected) == true);
+    }
+
+    SECTION( "max" ) {
+        ac_vec4 expected = {1.0f, 2.0f, 3.0f, 4.0f};
+        ac_vec4 result = ac_vec4_max(&a, &b);
+        REQUIRE(ac_vec4_is_equal(&result, &expected) == true);
+    }
+}
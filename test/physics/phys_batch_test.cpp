@@ -0,0 +1,115 @@
+#include "phys_test_scene.h"
+#include <ace/physics/phys_batch.h>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <memory>
+
+namespace {
+
+void make_scene(PhysWorld* world)
+{
+    BallSceneDesc desc;
+    desc.spacing       = { { 0.15f, 0.05f, 0.0f } };
+    desc.firstVelocity = { { 0.0f, 0.0f, -0.1f } };
+    desc.velocityStep  = { { 0.2f, 0.0f, 0.0f } };
+    make_ball_scene(world, desc);
+}
+
+void count_contacts(PhysWorld* world, unsigned, unsigned)
+{
+    (*static_cast<unsigned*>(world->userData))++;
+}
+
+}  // namespace
+
+TEST_CASE( "phys_batch_step matches serial stepping", "[phys_batch]" ) {
+    auto source = std::make_unique<PhysWorld>();
+    make_scene(source.get());
+
+    auto reference = std::make_unique<PhysWorld>();
+    std::memcpy(reference.get(), source.get(), sizeof(PhysWorld));
+    for ( int i = 0; i < 120; i++ )
+    {
+        phys_step(reference.get());
+    }
+
+    PhysBatch* batch = phys_batch_create(4);
+    REQUIRE(batch != nullptr);
+    REQUIRE(phys_batch_num_threads(batch) >= 1);
+
+    const unsigned num_worlds = 13;
+    PhysWorld*     worlds     = phys_batch_clone_worlds(batch, source.get(), num_worlds);
+    REQUIRE(worlds != nullptr);
+
+    PhysBatchStats stats = phys_batch_step(batch, worlds, num_worlds, 120);
+    REQUIRE(stats.worldSteps == num_worlds * 120ull);
+    REQUIRE(stats.seconds >= 0.0);
+
+    for ( unsigned w = 0; w < num_worlds; w++ )
+    {
+        CAPTURE(w);
+        for ( unsigned e = 0; e < reference->numEnts; e++ )
+        {
+            REQUIRE(worlds[w].positions[e].x == reference->positions[e].x);
+            REQUIRE(worlds[w].positions[e].y == reference->positions[e].y);
+            REQUIRE(worlds[w].positions[e].z == reference->positions[e].z);
+        }
+    }
+
+    phys_batch_free_worlds(worlds);
+    phys_batch_destroy(batch);
+}
+
+TEST_CASE( "phys_batch world callbacks use per-world user data", "[phys_batch]" ) {
+    auto source = std::make_unique<PhysWorld>();
+    make_scene(source.get());
+    for ( unsigned i = 0; i < source->numDynamicEntities; i++ )
+    {
+        phys_add_world_collision_callback(
+            source.get(),
+            source->dynamicEntities[i],
+            count_contacts
+        );
+    }
+
+    unsigned shared  = 0;
+    source->userData = &shared;
+
+    PhysBatch* batch      = phys_batch_create(3);
+    const int  num_worlds = 6;
+    PhysWorld* worlds     = phys_batch_clone_worlds(batch, source.get(), num_worlds);
+
+    // the clones do not share the source's state, each is given its own
+    unsigned counters[num_worlds] = {};
+    for ( int w = 0; w < num_worlds; w++ )
+    {
+        REQUIRE(worlds[w].userData == nullptr);
+        worlds[w].userData = &counters[w];
+    }
+
+    phys_batch_step(batch, worlds, num_worlds, 240);
+    for ( int w = 0; w < num_worlds; w++ )
+    {
+        CAPTURE(w);
+        REQUIRE(counters[w] > 0);
+        REQUIRE(counters[w] == counters[0]);
+    }
+    REQUIRE(shared == 0);
+
+    phys_batch_free_worlds(worlds);
+    phys_batch_destroy(batch);
+}
+
+TEST_CASE( "phys_batch single threaded", "[phys_batch]" ) {
+    PhysBatch* batch = phys_batch_create(0);
+    REQUIRE(phys_batch_num_threads(batch) == 1);
+
+    auto source = std::make_unique<PhysWorld>();
+    make_scene(source.get());
+    PhysWorld* worlds = phys_batch_clone_worlds(batch, source.get(), 2);
+    phys_batch_step(batch, worlds, 2, 10);
+    REQUIRE(std::memcmp(worlds[0].positions, worlds[1].positions, sizeof(worlds[0].positions)) == 0);
+
+    phys_batch_free_worlds(worlds);
+    phys_batch_destroy(batch);
+}
@@ -0,0 +1,201 @@
+#include "phys_test_scene.h"
+#include <ace/physics/phys_replay.h>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace {
+
+void make_scene(PhysWorld* world, float friction = 0.0f)
+{
+    BallSceneDesc desc;
+    desc.numBalls        = 10;
+    desc.firstPosition   = { { 0.0f, 0.4f, 0.0f } };
+    desc.spacing         = { { 0.25f, 0.1f, 0.0f } };
+    desc.firstVelocity   = { { 0.3f, 0.0f, 0.0f } };
+    desc.velocityStep    = { { 0.0f, 0.0f, 0.1f } };
+    desc.friction        = friction;
+    desc.rollingFriction = friction * 0.002f;  // weak enough that bounced balls keep spinning
+    make_ball_scene(world, desc);
+    world->gravity = { { 0.0f, -4.0f, 0.0f } };
+}
+
+/// Records \p numFrames steps of the scene, keeping a copy of each frame's world.
+std::vector<std::unique_ptr<PhysWorld>> record_scene(
+    const std::filesystem::path& path,
+    const PhysRecorderConfig&    config,
+    unsigned                     numFrames,
+    float                        friction = 0.0f
+)
+{
+    auto world = std::make_unique<PhysWorld>();
+    make_scene(world.get(), friction);
+
+    PhysRecorder* recorder = phys_recorder_open(path.string().c_str(), world.get(), &config);
+    REQUIRE(recorder != nullptr);
+
+    std::vector<std::unique_ptr<PhysWorld>> frames;
+    for ( unsigned i = 0; i < numFrames; i++ )
+    {
+        phys_step(world.get());
+        REQUIRE(phys_recorder_record(recorder, world.get()));
+        frames.push_back(std::make_unique<PhysWorld>(*world));
+    }
+
+    PhysRecorderStats stats = phys_recorder_stats(recorder);
+    REQUIRE(stats.frames == numFrames);
+    REQUIRE(stats.encodedBytes < stats.rawBytes);
+    REQUIRE(phys_recorder_close(recorder));
+    return frames;
+}
+
+}  // namespace
+
+TEST_CASE( "phys_replay lossless playback", "[phys_replay]" ) {
+    auto path = std::filesystem::temp_directory_path() / "ace_phys_replay_test.acrp";
+
+    PhysRecorderConfig config = {};
+    config.keyframeInterval   = 16;
+    config.bufferSize         = 256;  // small enough to wrap the ring buffer many times
+    auto frames               = record_scene(path, config, 100);
+
+    PhysReplay* replay = phys_replay_open(path.string().c_str());
+    REQUIRE(replay != nullptr);
+    REQUIRE(phys_replay_num_frames(replay) == 100);
+    REQUIRE(phys_replay_num_entities(replay) == frames[0]->numEnts);
+
+    auto world = std::make_unique<PhysWorld>();
+    make_scene(world.get());
+
+    SECTION( "every frame matches the recording" ) {
+        for ( unsigned f = 0; f < frames.size(); f++ )
+        {
+            CAPTURE(f);
+            REQUIRE(phys_replay_next(replay, world.get()));
+            REQUIRE(phys_world_hash(world.get()) == phys_world_hash(frames[f].get()));
+        }
+        REQUIRE_FALSE(phys_replay_next(replay, world.get()));
+    }
+
+    SECTION( "seeking" ) {
+        for ( unsigned f : { 57u, 3u, 16u, 99u, 0u } )
+        {
+            CAPTURE(f);
+            REQUIRE(phys_replay_seek(replay, f));
+            REQUIRE(phys_replay_next(replay, world.get()));
+            REQUIRE(phys_world_hash(world.get()) == phys_world_hash(frames[f].get()));
+        }
+        REQUIRE_FALSE(phys_replay_seek(replay, 100));
+    }
+
+    SECTION( "entity count mismatch" ) {
+        phys_init_world(world.get());
+        REQUIRE_FALSE(phys_replay_next(replay, world.get()));
+    }
+
+    phys_replay_close(replay);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE( "phys_replay lossless playback with friction", "[phys_replay]" ) {
+    auto path   = std::filesystem::temp_directory_path() / "ace_phys_replay_friction.acrp";
+    auto frames = record_scene(path, PhysRecorderConfig{}, 60, 0.5f);
+
+    // friction spins the balls, so the recording must carry their orientations and spin
+    float spin = 0.0f;
+    for ( unsigned e = 0; e < frames.back()->numEnts; e++ )
+    {
+        spin += ac_vec3_magnitude(&frames.back()->angularVelocities[e]);
+    }
+    REQUIRE(spin > 0.0f);
+
+    PhysReplay* replay = phys_replay_open(path.string().c_str());
+    REQUIRE(replay != nullptr);
+
+    auto world = std::make_unique<PhysWorld>();
+    make_scene(world.get(), 0.5f);
+    for ( unsigned f = 0; f < frames.size(); f++ )
+    {
+        CAPTURE(f);
+        REQUIRE(phys_replay_next(replay, world.get()));
+        REQUIRE(phys_world_hash(world.get()) == phys_world_hash(frames[f].get()));
+    }
+
+    phys_replay_close(replay);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE( "phys_replay quantized playback", "[phys_replay]" ) {
+    auto path = std::filesystem::temp_directory_path() / "ace_phys_replay_quantized.acrp";
+
+    PhysRecorderConfig config = {};
+    config.quantizeBits       = 12;
+    auto frames               = record_scene(path, config, 60);
+
+    PhysReplay* replay = phys_replay_open(path.string().c_str());
+    REQUIRE(replay != nullptr);
+
+    auto world = std::make_unique<PhysWorld>();
+    make_scene(world.get());
+    for ( unsigned f = 0; f < frames.size(); f++ )
+    {
+        REQUIRE(phys_replay_next(replay, world.get()));
+        for ( unsigned e = 0; e < world->numEnts; e++ )
+        {
+            CAPTURE(f, e);
+            REQUIRE_THAT(
+                world->positions[e].x, Catch::Matchers::WithinAbs(frames[f]->positions[e].x, 1e-3)
+            );
+            REQUIRE_THAT(
+                world->positions[e].y, Catch::Matchers::WithinAbs(frames[f]->positions[e].y, 1e-3)
+            );
+            REQUIRE_THAT(
+                world->positions[e].z, Catch::Matchers::WithinAbs(frames[f]->positions[e].z, 1e-3)
+            );
+        }
+    }
+
+    phys_replay_close(replay);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE( "phys_replay truncated recording", "[phys_replay]" ) {
+    auto path = std::filesystem::temp_directory_path() / "ace_phys_replay_truncated.acrp";
+    record_scene(path, PhysRecorderConfig{}, 20);
+
+    auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 3);
+
+    PhysReplay* replay = phys_replay_open(path.string().c_str());
+    REQUIRE(replay != nullptr);
+    REQUIRE(phys_replay_num_frames(replay) == 19);
+    phys_replay_close(replay);
+
+    std::filesystem::resize_file(path, 8);
+    REQUIRE(phys_replay_open(path.string().c_str()) == nullptr);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE( "phys_replay recording overhead", "[.][benchmark][phys_replay]" ) {
+    auto path  = std::filesystem::temp_directory_path() / "ace_phys_replay_benchmark.acrp";
+    auto world = std::make_unique<PhysWorld>();
+    make_scene(world.get());
+
+    BENCHMARK( "phys_step" )
+    {
+        phys_step(world.get());
+    };
+
+    PhysRecorder* recorder = phys_recorder_open(path.string().c_str(), world.get(), nullptr);
+    BENCHMARK( "phys_step + phys_recorder_record" )
+    {
+        phys_step(world.get());
+        return phys_recorder_record(recorder, world.get());
+    };
+    phys_recorder_close(recorder);
+    std::filesystem::remove(path);
+}
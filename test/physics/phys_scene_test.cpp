@@ -0,0 +1,216 @@
+#include "phys_test_scene.h"
+#include <ace/physics/phys_scene.h>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace {
+
+void make_scene(PhysWorld* world)
+{
+    BallSceneDesc desc;
+    desc.numBalls        = 6;
+    desc.spacing         = { { 0.3f, 0.0f, 0.0f } };
+    desc.firstVelocity   = { { 0.0f, 0.0f, 0.2f } };
+    desc.velocityStep    = { { 0.1f, 0.0f, 0.0f } };
+    desc.friction        = 0.3f;
+    desc.rollingFriction = 0.01f;
+    make_ball_scene(world, desc);
+    world->gravity = { { 0.0f, -4.0f, 0.0f } };
+
+    // the balls are entities 1 to 6, give them spin, differing masses and a rotation to save
+    for ( unsigned i = 0; i < desc.numBalls; i++ )
+    {
+        world->angularVelocities[i + 1] = { { 2.0f, 0.0f, -1.0f * (float) i } };
+        world->masses[i + 1]            = 1.0f + (float) i;
+    }
+    world->orientations[2] = { 0.0f, 0.6f, 0.0f, 0.8f };
+
+    // an entity without a collider
+    ac_vec3 marker = { 1.0f, 2.0f, 3.0f };
+    phys_add_entity(world, &marker);
+    world->sleeping[3] = true;
+}
+
+std::vector<unsigned char> read_file(const std::filesystem::path& path)
+{
+    std::vector<unsigned char> data(std::filesystem::file_size(path));
+    FILE*                      file = std::fopen(path.string().c_str(), "rb");
+    REQUIRE(file != nullptr);
+    REQUIRE(std::fread(data.data(), 1, data.size(), file) == data.size());
+    std::fclose(file);
+    return data;
+}
+
+}  // namespace
+
+TEST_CASE( "phys_scene round trip", "[phys_scene]" ) {
+    auto source = std::make_unique<PhysWorld>();
+    make_scene(source.get());
+
+    auto path = std::filesystem::temp_directory_path() / "ace_phys_scene_test.acew";
+    REQUIRE(phys_scene_save(source.get(), path.string().c_str()));
+
+    auto       loaded = std::make_unique<PhysWorld>();
+    PhysScene* scene  = phys_scene_load(loaded.get(), path.string().c_str());
+    REQUIRE(scene != nullptr);
+
+    SECTION( "world state is restored" ) {
+        REQUIRE(loaded->numEnts == source->numEnts);
+        REQUIRE(loaded->numColliders == source->numColliders);
+        REQUIRE(loaded->numStaticEntities == source->numStaticEntities);
+        REQUIRE(loaded->numDynamicEntities == source->numDynamicEntities);
+        REQUIRE(loaded->gravity.y == source->gravity.y);
+        REQUIRE(loaded->timeStep == source->timeStep);
+        REQUIRE(loaded->friction == source->friction);
+        REQUIRE(loaded->rollingFriction == source->rollingFriction);
+        for ( unsigned i = 0; i < source->numEnts; i++ )
+        {
+            CAPTURE(i);
+            REQUIRE(std::memcmp(&loaded->positions[i], &source->positions[i], sizeof(ac_vec3)) == 0);
+            REQUIRE(std::memcmp(&loaded->velocities[i], &source->velocities[i], sizeof(ac_vec3)) == 0);
+            REQUIRE(std::memcmp(&loaded->orientations[i], &source->orientations[i], sizeof(ac_quat)) == 0);
+            REQUIRE(std::memcmp(&loaded->angularVelocities[i], &source->angularVelocities[i], sizeof(ac_vec3)) == 0);
+            REQUIRE(std::memcmp(&loaded->inverseInertias[i], &source->inverseInertias[i], sizeof(ac_vec3)) == 0);
+            REQUIRE(loaded->masses[i] == source->masses[i]);
+            REQUIRE(loaded->sleeping[i] == source->sleeping[i]);
+            REQUIRE((loaded->colliders[i].data == nullptr) == (source->colliders[i].data == nullptr));
+        }
+    }
+
+    SECTION( "shared shapes are stored once" ) {
+        REQUIRE(loaded->colliders[1].data == loaded->colliders[2].data);
+        REQUIRE(loaded->colliders[1].data != &test_ball_shape);
+        REQUIRE(static_cast<Sphere*>(loaded->colliders[1].data)->radius == test_ball_shape.radius);
+        REQUIRE(static_cast<AABB*>(loaded->colliders[0].data)->half_extents.y == 0.5f);
+    }
+
+    SECTION( "loaded world simulates identically" ) {
+        for ( int i = 0; i < 90; i++ )
+        {
+            phys_step(source.get());
+            phys_step(loaded.get());
+        }
+        REQUIRE(phys_world_hash(loaded.get()) == phys_world_hash(source.get()));
+    }
+
+    SECTION( "loading from memory matches loading from a file" ) {
+        std::vector<unsigned char> data   = read_file(path);
+        auto                       memory = std::make_unique<PhysWorld>();
+        PhysScene* memoryScene = phys_scene_load_memory(memory.get(), data.data(), data.size());
+        REQUIRE(memoryScene != nullptr);
+        REQUIRE(phys_world_hash(memory.get()) == phys_world_hash(loaded.get()));
+        phys_scene_free(memoryScene);
+    }
+
+    SECTION( "version 2 files load unrotated and at rest" ) {
+        // version 2 files end before the orientation, angular velocity, inertia and friction
+        std::vector<unsigned char> data = read_file(path);
+        data[4]                         = 2;
+        data.resize(data.size() - source->numEnts * 40 - 8);
+        auto       old      = std::make_unique<PhysWorld>();
+        PhysScene* oldScene = phys_scene_load_memory(old.get(), data.data(), data.size());
+        REQUIRE(oldScene != nullptr);
+        REQUIRE(old->orientations[2].w == 1.0f);
+        REQUIRE(old->angularVelocities[1].x == 0.0f);
+        REQUIRE(old->inverseInertias[1].x == source->inverseInertias[1].x);
+        REQUIRE(old->friction == 0.0f);
+        phys_scene_free(oldScene);
+    }
+
+    phys_scene_free(scene);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE( "phys_scene keeps entity handles", "[phys_scene]" ) {
+    auto source = std::make_unique<PhysWorld>();
+    make_scene(source.get());
+
+    // leave a free slot and a reused slot with a new generation
+    REQUIRE(phys_remove_entity(source.get(), 2));
+    REQUIRE(phys_remove_entity(source.get(), 4));
+    ac_vec3  position = { 0.0f, 1.0f, 0.0f };
+    unsigned reused   = phys_add_entity(source.get(), &position);
+    phys_make_entity_dynamic(source.get(), reused);
+
+    auto path = std::filesystem::temp_directory_path() / "ace_phys_scene_handles.acew";
+    REQUIRE(phys_scene_save(source.get(), path.string().c_str()));
+
+    auto       loaded = std::make_unique<PhysWorld>();
+    PhysScene* scene  = phys_scene_load(loaded.get(), path.string().c_str());
+    REQUIRE(scene != nullptr);
+
+    REQUIRE(phys_is_entity_valid(loaded.get(), reused));
+    REQUIRE_FALSE(phys_is_entity_valid(loaded.get(), 2));
+    REQUIRE_FALSE(phys_is_entity_valid(loaded.get(), 4));
+    REQUIRE(loaded->numDynamicEntities == source->numDynamicEntities);
+    REQUIRE(loaded->numFreeEntities == 1);
+
+    // the free slot and list positions are usable after loading
+    REQUIRE(phys_remove_entity(loaded.get(), reused));
+    unsigned added = phys_add_entity(loaded.get(), &position);
+    REQUIRE(phys_entity_index(added) == phys_entity_index(reused));
+    REQUIRE(loaded->numDynamicEntities == source->numDynamicEntities - 1);
+
+    phys_scene_free(scene);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE( "phys_scene rejects invalid data", "[phys_scene]" ) {
+    auto source = std::make_unique<PhysWorld>();
+    make_scene(source.get());
+
+    auto path = std::filesystem::temp_directory_path() / "ace_phys_scene_invalid.acew";
+    REQUIRE(phys_scene_save(source.get(), path.string().c_str()));
+    std::vector<unsigned char> data = read_file(path);
+    std::filesystem::remove(path);
+
+    auto world = std::make_unique<PhysWorld>();
+
+    SECTION( "missing file" ) {
+        REQUIRE(phys_scene_load(world.get(), path.string().c_str()) == nullptr);
+    }
+
+    SECTION( "bad magic" ) {
+        data[0] = 'X';
+        REQUIRE(phys_scene_load_memory(world.get(), data.data(), data.size()) == nullptr);
+    }
+
+    SECTION( "truncated" ) {
+        REQUIRE(phys_scene_load_memory(world.get(), data.data(), data.size() - 4) == nullptr);
+        REQUIRE(phys_scene_load_memory(world.get(), data.data(), 8) == nullptr);
+    }
+
+    SECTION( "unknown version" ) {
+        data[4] = AC_PHYS_SCENE_VERSION + 1;
+        REQUIRE(phys_scene_load_memory(world.get(), data.data(), data.size()) == nullptr);
+    }
+
+    SECTION( "shape index out of range" ) {
+        // the collider section of the first entity follows the positions, velocities, masses and
+        // sleeping sections
+        size_t n      = source->numEnts;
+        size_t offset = sizeof(PhysSceneHeader) + n * 28 + ((n + 3) & ~size_t(3)) + 4;
+        data[offset]  = 0xFF;
+        REQUIRE(phys_scene_load_memory(world.get(), data.data(), data.size()) == nullptr);
+    }
+
+    SECTION( "counts larger than the data" ) {
+        // the header size, sphere count and AABB count, set to values whose section sizes wrap a
+        // 32-bit size_t
+        for ( size_t field : { offsetof(PhysSceneHeader, headerSize),
+                               offsetof(PhysSceneHeader, numSpheres),
+                               offsetof(PhysSceneHeader, numAABBs) } )
+        {
+            CAPTURE(field);
+            std::vector<unsigned char> corrupt = data;
+            std::memset(&corrupt[field], 0xFF, 4);
+            REQUIRE(
+                phys_scene_load_memory(world.get(), corrupt.data(), corrupt.size()) == nullptr
+            );
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#include "phys_test_scene.h"
+#include <ace/physics/phys_snapshot.h>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <vector>
+
+namespace {
+
+void make_snapshot_scene(PhysWorld* world)
+{
+    BallSceneDesc desc;
+    desc.numBalls      = 6;
+    desc.firstPosition = { { 0.0f, 0.3f, 0.0f } };
+    desc.firstVelocity = { { 0.5f, 0.0f, 0.0f } };
+    desc.velocityStep  = { { 0.0f, 0.0f, 0.1f } };
+    make_ball_scene(world, desc);
+}
+
+}  // namespace
+
+TEST_CASE( "phys_world_snapshot and phys_world_restore", "[phys_snapshot]" ) {
+    auto world = std::make_unique<PhysWorld>();
+    make_snapshot_scene(world.get());
+    phys_update(world.get(), 0.05f);
+
+    std::vector<unsigned char> buffer(phys_world_snapshot_size(world.get()));
+    REQUIRE(phys_world_snapshot(world.get(), buffer.data(), buffer.size()) == buffer.size());
+
+    uint64_t hash        = phys_world_hash(world.get());
+    float    accumulator = world->accumulator;
+
+    SECTION( "restore rewinds the world" ) {
+        for ( int i = 0; i < 60; i++ )
+        {
+            phys_step(world.get());
+        }
+        REQUIRE(phys_world_hash(world.get()) != hash);
+
+        REQUIRE(phys_world_restore(world.get(), buffer.data(), buffer.size()));
+        REQUIRE(phys_world_hash(world.get()) == hash);
+        REQUIRE(world->accumulator == accumulator);
+    }
+
+    SECTION( "restored worlds replay identically" ) {
+        for ( int i = 0; i < 30; i++ )
+        {
+            phys_step(world.get());
+        }
+        uint64_t expected = phys_world_hash(world.get());
+
+        REQUIRE(phys_world_restore(world.get(), buffer.data(), buffer.size()));
+        for ( int i = 0; i < 30; i++ )
+        {
+            phys_step(world.get());
+        }
+        REQUIRE(phys_world_hash(world.get()) == expected);
+    }
+
+    SECTION( "buffer too small" ) {
+        REQUIRE(phys_world_snapshot(world.get(), buffer.data(), buffer.size() - 1) == 0);
+        REQUIRE_FALSE(phys_world_restore(world.get(), buffer.data(), buffer.size() - 1));
+    }
+
+    SECTION( "world with different entities" ) {
+        ac_vec3 position = { { 0.0f, 0.0f, 0.0f } };
+        phys_add_entity(world.get(), &position);
+        REQUIRE_FALSE(phys_world_restore(world.get(), buffer.data(), buffer.size()));
+    }
+
+    SECTION( "world with a removed entity" ) {
+        REQUIRE(phys_remove_entity(world.get(), 1));
+        REQUIRE_FALSE(phys_world_restore(world.get(), buffer.data(), buffer.size()));
+
+        // reusing the slot does not make the snapshot valid again
+        ac_vec3 position = { { 0.0f, 0.0f, 0.0f } };
+        phys_add_entity(world.get(), &position);
+        REQUIRE_FALSE(phys_world_restore(world.get(), buffer.data(), buffer.size()));
+    }
+
+    SECTION( "invalid buffer" ) {
+        std::vector<unsigned char> garbage(buffer.size(), 0xAB);
+        REQUIRE_FALSE(phys_world_restore(world.get(), garbage.data(), garbage.size()));
+        REQUIRE(phys_world_hash(world.get()) == hash);
+    }
+}
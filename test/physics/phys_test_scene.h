@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief A row of balls above a floor, the scene shared by the physics tests.
+ */
+#pragma once
+#include <ace/geometry/shapes.h>
+#include <ace/physics/phys_world.h>
+
+inline Sphere test_ball_shape  = { 0.1f };
+inline AABB   test_floor_shape = { { 5.0f, 0.5f, 5.0f } };
+
+/// The layout of \ref make_ball_scene, ball i starts at firstPosition + i * spacing and moves at
+/// firstVelocity + i * velocityStep.
+struct BallSceneDesc
+{
+    unsigned numBalls        = 8;
+    ac_vec3  firstPosition   = { { 0.0f, 0.5f, 0.0f } };
+    ac_vec3  spacing         = { { 0.15f, 0.0f, 0.0f } };
+    ac_vec3  firstVelocity   = { { 0.0f, 0.0f, 0.0f } };
+    ac_vec3  velocityStep    = { { 0.0f, 0.0f, 0.0f } };
+    float    friction        = 0.0f;
+    float    rollingFriction = 0.0f;
+};
+
+/// Reinitialises \p world with a static floor whose top is at y = 0 as entity 0, followed by the
+/// dynamic balls as entities 1 to numBalls.
+inline void make_ball_scene(PhysWorld* world, const BallSceneDesc& desc)
+{
+    phys_init_world(world);
+    world->friction        = desc.friction;
+    world->rollingFriction = desc.rollingFriction;
+
+    ac_vec3  floor_position = { { 0.0f, -0.5f, 0.0f } };
+    unsigned floor          = phys_add_entity(world, &floor_position);
+    phys_add_entity_collider(world, Collider{ AABB_C, &test_floor_shape }, floor);
+    phys_make_entity_static(world, floor);
+
+    for ( unsigned i = 0; i < desc.numBalls; i++ )
+    {
+        float    step     = (float) i;
+        ac_vec3  position = { { desc.firstPosition.x + step * desc.spacing.x,
+                                desc.firstPosition.y + step * desc.spacing.y,
+                                desc.firstPosition.z + step * desc.spacing.z } };
+        unsigned ball     = phys_add_entity(world, &position);
+        phys_add_entity_collider(world, Collider{ SPHERE_C, &test_ball_shape }, ball);
+        phys_make_entity_dynamic(world, ball);
+        world->velocities[ball] = { { desc.firstVelocity.x + step * desc.velocityStep.x,
+                                      desc.firstVelocity.y + step * desc.velocityStep.y,
+                                      desc.firstVelocity.z + step * desc.velocityStep.z } };
+    }
+}
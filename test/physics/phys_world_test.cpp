@@ -0,0 +1,926 @@
+#include <ace/geometry/mesh.h>
+#include <ace/geometry/shapes.h>
+#include <ace/physics/phys_world.h>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstring>
+#include <memory>
+
+//--------------------------------------------------------------------------------------------------
+// world initialisation
+//--------------------------------------------------------------------------------------------------
+
+TEST_CASE( "phys_init_world", "[phys_world]" ) {
+    // start from garbage to show every field is cleared
+    auto world = std::make_unique<PhysWorld>();
+    std::memset(world.get(), 0xAB, sizeof(PhysWorld));
+    phys_init_world(world.get());
+
+    REQUIRE(world->numEnts == 0);
+    REQUIRE(world->userData == nullptr);
+    REQUIRE(world->gravity.y == -9.8f);
+    REQUIRE(world->timeStep == 1.0f / 120.0f);
+    REQUIRE(world->convexPairs[0].entity1 == AC_PHYS_ERROR_ENT);
+
+    // a slot used for the first time gets the non-zero defaults
+    ac_vec3  position = { { 1.0f, 2.0f, 3.0f } };
+    unsigned entity   = phys_add_entity(world.get(), &position);
+    REQUIRE(world->masses[entity] == 1.0f);
+    REQUIRE(world->orientations[entity].w == 1.0f);
+    REQUIRE(world->staticIndices[entity] == AC_PHYS_NO_INDEX);
+    REQUIRE(world->dynamicIndices[entity] == AC_PHYS_NO_INDEX);
+    REQUIRE(world->forces[entity].x == 0.0f);
+    REQUIRE(world->callbacks[entity] == nullptr);
+}
+
+//--------------------------------------------------------------------------------------------------
+// interpolation
+//--------------------------------------------------------------------------------------------------
+
+TEST_CASE( "phys_get_interpolation_alpha", "[phys_world]" ) {
+    auto world = std::make_unique<PhysWorld>();
+    phys_init_world(world.get());
+    world->timeStep = 0.1f;
+
+    REQUIRE(phys_get_interpolation_alpha(world.get()) == 0.0f);
+
+    phys_update(world.get(), 0.25f);
+    REQUIRE_THAT(phys_get_interpolation_alpha(world.get()), Catch::Matchers::WithinAbs(0.5f, 1e-4f));
+}
+
+TEST_CASE( "phys_get_interpolated_position", "[phys_world]" ) {
+    auto world = std::make_unique<PhysWorld>();
+    phys_init_world(world.get());
+    world->timeStep      = 0.1f;
+    world->gravity       = { { 0.0f, 0.0f, 0.0f } };
+    world->airResistance = 0.0f;
+
+    ac_vec3  start  = { { 0.0f, 1.0f, 0.0f } };
+    unsigned entity = phys_add_entity(world.get(), &start);
+    phys_make_entity_dynamic(world.get(), entity);
+    world->velocities[entity] = { { 1.0f, 0.0f, 0.0f } };
+
+    SECTION( "before stepping" ) {
+        ac_vec3 position = phys_get_interpolated_position(world.get(), entity);
+        REQUIRE(position.x == 0.0f);
+        REQUIRE(position.y == 1.0f);
+    }
+
+    SECTION( "between steps" ) {
+        phys_update(world.get(), 0.15f);
+        ac_vec3 position = phys_get_interpolated_position(world.get(), entity);
+        REQUIRE_THAT(position.x, Catch::Matchers::WithinAbs(0.05f, 1e-4f));
+        REQUIRE_THAT(position.y, Catch::Matchers::WithinAbs(1.0f, 1e-6f));
+
+        ac_vec3 positions[AC_MAX_PHYS_ENTS];
+        phys_get_interpolated_positions(world.get(), positions);
+        REQUIRE(positions[entity].x == position.x);
+        REQUIRE(positions[entity].y == position.y);
+        REQUIRE(positions[entity].z == position.z);
+    }
+
+    SECTION( "after setting the position" ) {
+        phys_update(world.get(), 0.15f);
+        ac_vec3 teleport = { { 5.0f, 5.0f, 5.0f } };
+        phys_set_entity_position(world.get(), entity, &teleport);
+
+        ac_vec3 position = phys_get_interpolated_position(world.get(), entity);
+        REQUIRE(position.x == 5.0f);
+        REQUIRE(position.y == 5.0f);
+        REQUIRE(position.z == 5.0f);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// sub-stepping
+//--------------------------------------------------------------------------------------------------
+
+TEST_CASE( "phys_update sub-step cap", "[phys_world]" ) {
+    auto world = std::make_unique<PhysWorld>();
+    phys_init_world(world.get());
+    world->timeStep    = 0.1f;
+    world->maxSubSteps = 5;
+
+    SECTION( "within the cap" ) {
+        phys_update(world.get(), 0.35f);
+        REQUIRE(world->stats.subSteps == 3);
+        REQUIRE(world->stats.droppedTime == 0.0f);
+        REQUIRE(world->stats.droppedUpdates == 0);
+    }
+
+    SECTION( "beyond the cap" ) {
+        phys_update(world.get(), 1.05f);
+        REQUIRE(world->stats.subSteps == 5);
+        REQUIRE_THAT(world->stats.droppedTime, Catch::Matchers::WithinAbs(0.5f, 1e-4f));
+        REQUIRE_THAT(world->accumulator, Catch::Matchers::WithinAbs(0.05f, 1e-4f));
+        REQUIRE(world->stats.droppedUpdates == 1);
+
+        phys_update(world.get(), 1.0f);
+        REQUIRE_THAT(world->stats.totalDroppedTime, Catch::Matchers::WithinAbs(1.0f, 1e-4f));
+        REQUIRE(world->stats.droppedUpdates == 2);
+    }
+
+    SECTION( "no cap" ) {
+        world->maxSubSteps = 0;
+        phys_update(world.get(), 1.05f);
+        REQUIRE(world->stats.subSteps == 10);
+        REQUIRE(world->stats.droppedTime == 0.0f);
+    }
+}
+
+TEST_CASE( "phys_update adaptive solver iterations", "[phys_world]" ) {
+    auto world = std::make_unique<PhysWorld>();
+    phys_init_world(world.get());
+    world->timeStep            = 0.1f;
+    world->solverIterations    = 4;
+    world->minSolverIterations = 1;
+
+    SECTION( "disabled" ) {
+        phys_update(world.get(), 0.4f);
+        REQUIRE(world->stats.solverIterations == 4);
+    }
+
+    SECTION( "on time" ) {
+        world->adaptiveSolver = true;
+        phys_update(world.get(), 0.1f);
+        REQUIRE(world->stats.solverIterations == 4);
+    }
+
+    SECTION( "behind" ) {
+        world->adaptiveSolver = true;
+        phys_update(world.get(), 0.2f);
+        REQUIRE(world->stats.solverIterations == 2);
+
+        phys_update(world.get(), 1.0f);
+        REQUIRE(world->stats.solverIterations == 1);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// hashing
+//--------------------------------------------------------------------------------------------------
+
+namespace {
+
+Sphere hash_ball_shape = { 0.1f };
+
+void make_hash_scene(PhysWorld* world)
+{
+    phys_init_world(world);
+    for ( int i = 0; i < 4; i++ )
+    {
+        ac_vec3  position = { { 0.15f * (float) i, 1.0f, 0.0f } };
+        unsigned ball     = phys_add_entity(world, &position);
+        phys_add_entity_collider(world, Collider{ SPHERE_C, &hash_ball_shape }, ball);
+        phys_make_entity_dynamic(world, ball);
+    }
+}
+
+}  // namespace
+
+TEST_CASE( "phys_world_hash", "[phys_world]" ) {
+    auto a = std::make_unique<PhysWorld>();
+    auto b = std::make_unique<PhysWorld>();
+    make_hash_scene(a.get());
+    make_hash_scene(b.get());
+
+    REQUIRE(phys_world_hash(a.get()) == phys_world_hash(b.get()));
+
+    phys_step(a.get());
+    REQUIRE(phys_world_hash(a.get()) != phys_world_hash(b.get()));
+
+    phys_step(b.get());
+    REQUIRE(phys_world_hash(a.get()) == phys_world_hash(b.get()));
+
+    SECTION( "sleeping state is hashed" ) {
+        a->sleeping[0] = true;
+        REQUIRE(phys_world_hash(a.get()) != phys_world_hash(b.get()));
+    }
+
+    SECTION( "timing state is not hashed" ) {
+        a->accumulator = 0.5f;
+        REQUIRE(phys_world_hash(a.get()) == phys_world_hash(b.get()));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// entity handles
+//--------------------------------------------------------------------------------------------------
+
+TEST_CASE( "phys_remove_entity", "[phys_world]" ) {
+    auto world = std::make_unique<PhysWorld>();
+    phys_init_world(world.get());
+
+    ac_vec3  position = { { 1.0f, 2.0f, 3.0f } };
+    unsigned a        = phys_add_entity(world.get(), &position);
+    unsigned b        = phys_add_entity(world.get(), &position);
+    unsigned c        = phys_add_entity(world.get(), &position);
+    phys_make_entity_dynamic(world.get(), a);
+    phys_make_entity_dynamic(world.get(), b);
+    phys_make_entity_static(world.get(), c);
+    phys_make_entity_dynamic(world.get(), c);
+
+    REQUIRE(a == 0);  // the first handle for a slot is its index
+    REQUIRE(phys_is_entity_valid(world.get(), b));
+
+    SECTION( "removed entities leave the lists dense" ) {
+        REQUIRE(phys_remove_entity(world.get(), a));
+        REQUIRE_FALSE(phys_is_entity_valid(world.get(), a));
+        REQUIRE(world->numDynamicEntities == 2);
+        REQUIRE(world->numStaticEntities == 1);
+        REQUIRE(world->dynamicEntities[0] == phys_entity_index(c));
+        REQUIRE(world->dynamicEntities[1] == phys_entity_index(b));
+
+        REQUIRE(phys_remove_entity(world.get(), c));
+        REQUIRE(world->numDynamicEntities == 1);
+        REQUIRE(world->numStaticEntities == 0);
+        REQUIRE(world->dynamicEntities[0] == phys_entity_index(b));
+    }
+
+    SECTION( "slots are reused with a new generation" ) {
+        REQUIRE(phys_remove_entity(world.get(), b));
+        REQUIRE_FALSE(phys_remove_entity(world.get(), b));
+
+        unsigned d = phys_add_entity(world.get(), &position);
+        REQUIRE(phys_entity_index(d) == phys_entity_index(b));
+        REQUIRE(d != b);
+        REQUIRE(world->numEnts == 3);
+        REQUIRE(phys_is_entity_valid(world.get(), d));
+        REQUIRE_FALSE(phys_is_entity_valid(world.get(), b));
+        REQUIRE(phys_entity_handle(world.get(), phys_entity_index(d)) == d);
+
+        // the slot is reset to the state of a new entity
+        REQUIRE(world->velocities[phys_entity_index(d)].x == 0.0f);
+        REQUIRE(world->colliders[phys_entity_index(d)].data == nullptr);
+        REQUIRE(world->dynamicIndices[phys_entity_index(d)] == AC_PHYS_NO_INDEX);
+    }
+
+    SECTION( "invalid handles" ) {
+        REQUIRE_FALSE(phys_is_entity_valid(world.get(), AC_PHYS_ERROR_ENT));
+        REQUIRE_FALSE(phys_remove_entity(world.get(), 3));
+        REQUIRE_FALSE(phys_remove_entity(world.get(), a | (1u << AC_PHYS_ENT_INDEX_BITS)));
+    }
+}
+
+TEST_CASE( "stale handles", "[phys_world]" ) {
+    auto world = std::make_unique<PhysWorld>();
+    phys_init_world(world.get());
+
+    Sphere   sphere   = { 0.5f };
+    ac_vec3  position = { { 1.0f, 2.0f, 3.0f } };
+    unsigned stale    = phys_add_entity(world.get(), &position);
+    REQUIRE(phys_remove_entity(world.get(), stale));
+
+    SECTION( "a removed entity is not simulated" ) {
+        phys_make_entity_dynamic(world.get(), stale);
+        phys_make_entity_static(world.get(), stale);
+        REQUIRE(world->numDynamicEntities == 0);
+        REQUIRE(world->numStaticEntities == 0);
+
+        unsigned reused = phys_add_entity(world.get(), &position);
+        REQUIRE(world->dynamicIndices[phys_entity_index(reused)] == AC_PHYS_NO_INDEX);
+    }
+
+    SECTION( "the entity reusing the slot is unchanged" ) {
+        unsigned reused = phys_add_entity(world.get(), &position);
+        unsigned index  = phys_entity_index(reused);
+        REQUIRE(index == phys_entity_index(stale));
+        phys_make_entity_dynamic(world.get(), reused);
+
+        ac_vec3 moved   = { { 9.0f, 9.0f, 9.0f } };
+        ac_vec3 inertia = { { 1.0f, 1.0f, 1.0f } };
+        ac_vec3 push    = { { 5.0f, 0.0f, 0.0f } };
+        phys_set_entity_position(world.get(), stale, &moved);
+        phys_add_entity_collider(world.get(), Collider{ SPHERE_C, &sphere }, stale);
+        phys_set_entity_inverse_inertia(world.get(), stale, &inertia);
+        phys_sleep_entity(world.get(), stale, true);
+        phys_add_collision_callback(world.get(), stale, [](unsigned, unsigned) {});
+        phys_add_world_collision_callback(
+            world.get(), stale, [](PhysWorld*, unsigned, unsigned) {}
+        );
+        phys_apply_force(world.get(), stale, &push);
+        phys_apply_force_at_point(world.get(), stale, &push, &moved);
+        phys_apply_impulse(world.get(), stale, &push);
+        phys_apply_impulse_at_point(world.get(), stale, &push, &moved);
+        phys_apply_forces(world.get(), &stale, &push, 1);
+        phys_apply_impulses(world.get(), &stale, &push, 1);
+
+        REQUIRE(world->positions[index].x == 1.0f);
+        REQUIRE(world->colliders[index].data == nullptr);
+        REQUIRE(world->numColliders == 0);
+        REQUIRE(world->inverseInertias[index].x == 0.0f);
+        REQUIRE_FALSE(world->sleeping[index]);
+        REQUIRE(world->callbacks[index] == nullptr);
+        REQUIRE(world->worldCallbacks[index] == nullptr);
+        REQUIRE(world->forces[index].x == 0.0f);
+        REQUIRE(world->torques[index].z == 0.0f);
+        REQUIRE(world->velocities[index].x == 0.0f);
+        REQUIRE(world->angularVelocities[index].z == 0.0f);
+
+        ac_vec3 interpolated = phys_get_interpolated_position(world.get(), stale);
+        REQUIRE(ac_vec3_is_nan(&interpolated));
+    }
+}
+
+TEST_CASE( "phys_add_entity reuses slots under churn", "[phys_world]" ) {
+    auto world = std::make_unique<PhysWorld>();
+    phys_init_world(world.get());
+
+    Sphere   sphere   = { 0.5f };
+    Collider collider = { SPHERE_C, &sphere };
+    ac_vec3  position = { { 0.0f, 0.0f, 0.0f } };
+    unsigned live[8];
+    for ( unsigned& entity : live )
+    {
+        entity = phys_add_entity(world.get(), &position);
+        phys_make_entity_dynamic(world.get(), entity);
+        phys_add_entity_collider(world.get(), collider, entity);
+    }
+
+    // far more spawns than the world has slots
+    for ( unsigned i = 0; i < AC_MAX_PHYS_ENTS * 20; i++ )
+    {
+        unsigned& slot = live[i % 8];
+        REQUIRE(phys_remove_entity(world.get(), slot));
+        slot = phys_add_entity(world.get(), &position);
+        REQUIRE(slot != AC_PHYS_ERROR_ENT);
+        phys_make_entity_dynamic(world.get(), slot);
+
+        // replacing a collider does not change the count
+        phys_add_entity_collider(world.get(), collider, slot);
+        phys_add_entity_collider(world.get(), collider, slot);
+        REQUIRE(world->colliders[phys_entity_index(slot)].data == &sphere);
+    }
+
+    REQUIRE(world->numEnts == 8);
+    REQUIRE(world->numDynamicEntities == 8);
+    REQUIRE(world->numColliders == 8);
+
+    // removing a collider does
+    phys_add_entity_collider(world.get(), Collider{ SPHERE_C, nullptr }, live[0]);
+    REQUIRE(world->numColliders == 7);
+    for ( unsigned entity : live )
+    {
+        REQUIRE(phys_is_entity_valid(world.get(), entity));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// bulk creation
+//--------------------------------------------------------------------------------------------------
+
+namespace {
+
+Sphere bulk_ball_shape = { 0.1f };
+
+unsigned bulk_contacts = 0;
+
+void count_bulk_contact(unsigned, unsigned)
+{
+    bulk_contacts++;
+}
+
+}  // namespace
+
+TEST_CASE( "phys_add_entities", "[phys_world]" ) {
+    auto bulk = std::make_unique<PhysWorld>();
+    auto each = std::make_unique<PhysWorld>();
+    phys_init_world(bulk.get());
+    phys_init_world(each.get());
+
+    const unsigned count        = 5;
+    PhysEntityDesc descs[count] = {};
+    for ( unsigned i = 0; i < count; i++ )
+    {
+        descs[i].position = { { 0.15f * (float) i, 0.5f, 0.0f } };
+        descs[i].velocity = { { 1.0f, 0.0f, 0.0f } };
+        descs[i].mass     = 1.0f + (float) i;
+        descs[i].collider = Collider{ SPHERE_C, &bulk_ball_shape };
+        descs[i].flags    = AC_PHYS_ENT_DYNAMIC;
+        descs[i].callback = count_bulk_contact;
+
+        // the same entity added one call at a time
+        unsigned id = phys_add_entity(each.get(), &descs[i].position);
+        phys_add_entity_collider(each.get(), descs[i].collider, id);
+        phys_make_entity_dynamic(each.get(), id);
+        phys_add_collision_callback(each.get(), id, count_bulk_contact);
+        each->velocities[id] = descs[i].velocity;
+        each->masses[id]     = descs[i].mass;
+    }
+    descs[count - 1].flags |= AC_PHYS_ENT_SLEEPING;
+    phys_sleep_entity(each.get(), count - 1, true);
+
+    unsigned ids[count];
+    REQUIRE(phys_add_entities(bulk.get(), descs, count, ids) == count);
+    REQUIRE(bulk->numEnts == count);
+    REQUIRE(bulk->numColliders == count);
+    REQUIRE(bulk->numDynamicEntities == count);
+    REQUIRE(bulk->sleeping[phys_entity_index(ids[count - 1])]);
+    REQUIRE(phys_world_hash(bulk.get()) == phys_world_hash(each.get()));
+
+    SECTION( "simulates identically to per-entity setup" ) {
+        bulk_contacts = 0;
+        phys_step(bulk.get());
+        unsigned bulkContacts = bulk_contacts;
+        REQUIRE(bulkContacts > 0);
+
+        bulk_contacts = 0;
+        phys_step(each.get());
+        REQUIRE(bulk_contacts == bulkContacts);
+        REQUIRE(phys_world_hash(bulk.get()) == phys_world_hash(each.get()));
+    }
+
+    SECTION( "struct of arrays" ) {
+        auto         soa = std::make_unique<PhysWorld>();
+        ac_vec3      positions[count];
+        ac_vec3      velocities[count];
+        float        masses[count];
+        Collider     colliders[count];
+        unsigned     flags[count];
+        PhysCallBack callbacks[count];
+        for ( unsigned i = 0; i < count; i++ )
+        {
+            positions[i]  = descs[i].position;
+            velocities[i] = descs[i].velocity;
+            masses[i]     = descs[i].mass;
+            colliders[i]  = descs[i].collider;
+            flags[i]      = descs[i].flags;
+            callbacks[i]  = descs[i].callback;
+        }
+
+        PhysEntityStreams streams = {};
+        streams.positions         = positions;
+        streams.velocities        = velocities;
+        streams.masses            = masses;
+        streams.colliders         = colliders;
+        streams.flags             = flags;
+        streams.callbacks         = callbacks;
+
+        phys_init_world(soa.get());
+        REQUIRE(phys_add_entities_soa(soa.get(), &streams, count, nullptr) == count);
+        REQUIRE(phys_world_hash(soa.get()) == phys_world_hash(bulk.get()));
+        REQUIRE(soa->numDynamicEntities == count);
+        REQUIRE(soa->callbacks[0] == count_bulk_contact);
+    }
+
+    SECTION( "defaults" ) {
+        PhysEntityStreams streams = {};
+        streams.positions         = &descs[0].position;
+
+        unsigned id;
+        REQUIRE(phys_add_entities_soa(bulk.get(), &streams, 1, &id) == 1);
+        unsigned index = phys_entity_index(id);
+        REQUIRE(bulk->masses[index] == 1.0f);
+        REQUIRE(bulk->velocities[index].x == 0.0f);
+        REQUIRE(bulk->colliders[index].data == nullptr);
+        REQUIRE(bulk->dynamicIndices[index] == AC_PHYS_NO_INDEX);
+    }
+
+    SECTION( "reuses free slots" ) {
+        REQUIRE(phys_remove_entity(bulk.get(), ids[1]));
+        REQUIRE(phys_remove_entity(bulk.get(), ids[3]));
+        REQUIRE(phys_add_entities(bulk.get(), descs, 3, ids) == 3);
+        REQUIRE(bulk->numEnts == count + 1);
+        REQUIRE(bulk->numDynamicEntities == count + 1);
+    }
+
+    SECTION( "all or nothing when full" ) {
+        std::unique_ptr<PhysEntityDesc[]> many(new PhysEntityDesc[AC_MAX_PHYS_ENTS]());
+        REQUIRE(phys_add_entities(bulk.get(), many.get(), AC_MAX_PHYS_ENTS, nullptr) == 0);
+        REQUIRE(bulk->numEnts == count);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+// static baking
+//--------------------------------------------------------------------------------------------------
+
+namespace {
+
+Sphere bake_ball_shape = { 0.1f };
+Sphere bake_post_shape = { 0.2f };
+AABB   bake_tile_shape = { { 0.5f, 0.25f, 0.5f } };
+
+/// A floor of tiles with posts between them, added in increasing x so the list order matches the
+/// baked order.
+void make_bake_scene(PhysWorld* world)
+{
+    phys_init_world(world);
+    for ( int x = 0; x < 10; x++ )
+    {
+        for ( int z = 0; z < 4; z++ )
+        {
+            ac_vec3  position = { { (float) x, -0.25f, (float) z } };
+            unsigned tile     = phys_add_entity(world, &position);
+            phys_add_entity_collider(world, Collider{ AABB_C, &bake_tile_shape }, tile);
+            phys_make_entity_static(world, tile);
+        }
+        ac_vec3  position = { { (float) x + 0.5f, 0.2f, 1.5f } };
+        unsigned post     = phys_add_entity(world, &position);
+        phys_add_entity_collider(world, Collider{ SPHERE_C, &bake_post_shape }, post);
+        phys_make_entity_static(world, post);
+    }
+
+    for ( int i = 0; i < 12; i++ )
+    {
+        ac_vec3  position = { { 0.7f * (float) i, 0.3f, 0.3f * (float) (i % 4) } };
+        unsigned ball     = phys_add_entity(world, &position);
+        phys_add_entity_collider(world, Collider{ SPHERE_C, &bake_ball_shape }, ball);
+        phys_make_entity_dynamic(world, ball);
+        world->velocities[ball] = { { 0.5f, 0.0f, 0.4f } };
+    }
+}
+
+}  // namespace
+
+TEST_CASE( "phys_bake_static", "[phys_world]" ) {
+    auto baked   = std::make_unique<PhysWorld>();
+    auto unbaked = std::make_unique<PhysWorld>();
+    make_bake_scene(baked.get());
+    make_bake_scene(unbaked.get());
+
+    REQUIRE(phys_bake_static(baked.get()));
+    REQUIRE(baked->staticBaked);
+    REQUIRE(baked->numBakedStatics == 50);
+    for ( unsigned i = 1; i < baked->numBakedStatics; i++ )
+    {
+        const PhysBakedStatic& a = baked->bakedStatics[i - 1];
+        const PhysBakedStatic& b = baked->bakedStatics[i];
+        REQUIRE(a.center.x - a.halfExtents.x <= b.center.x - b.halfExtents.x);
+    }
+
+    SECTION( "simulates identically to unbaked statics" ) {
+        for ( int i = 0; i < 240; i++ )
+        {
+            phys_step(baked.get());
+            phys_step(unbaked.get());
+        }
+        REQUIRE(phys_world_hash(baked.get()) == phys_world_hash(unbaked.get()));
+    }
+
+    SECTION( "changing statics discards the bake" ) {
+        ac_vec3 position = { { 20.0f, 0.0f, 0.0f } };
+        phys_set_entity_position(baked.get(), 0, &position);
+        REQUIRE_FALSE(baked->staticBaked);
+
+        REQUIRE(phys_bake_static(baked.get()));
+        REQUIRE(phys_remove_entity(baked.get(), 1));
+        REQUIRE_FALSE(baked->staticBaked);
+
+        REQUIRE(phys_bake_static(baked.get()));
+        unsigned added = phys_add_entity(baked.get(), &position);
+        phys_make_entity_dynamic(baked.get(), added);
+        REQUIRE(baked->staticBaked);
+        phys_make_entity_static(baked.get(), added);
+        REQUIRE_FALSE(baked->staticBaked);
+    }
+}
+
+TEST_CASE( "mesh and heightfield colliders", "[phys_world]" ) {
+    // one quad floor shared by two entities, and a flat heightfield beside them
+    ac_vec3      vertices[] = { { { -1.0f, 0.0f, -1.0f } },
+                                { { -1.0f, 0.0f, 1.0f } },
+                                { { 1.0f, 0.0f, -1.0f } },
+                                { { 1.0f, 0.0f, 1.0f } } };
+    uint32_t     indices[]  = { 0, 1, 2, 2, 1, 3 };
+    float        heights[9] = {};
+    TriangleMesh mesh;
+    Heightfield  heightfield;
+    Sphere       ball = { 0.25f };
+    REQUIRE(triangle_mesh_build(&mesh, vertices, 4, indices, 2));
+    REQUIRE(heightfield_init(&heightfield, heights, 3, 3, 1.0f));
+
+    auto make_scene = [&](PhysWorld* world) {
+        phys_init_world(world);
+        for ( int i = 0; i < 2; i++ )
+        {
+            ac_vec3  position = { { 4.0f * (float) i, 0.0f, 0.0f } };
+            unsigned floor    = phys_add_entity(world, &position);
+            phys_add_entity_collider(world, Collider{ MESH_C, &mesh }, floor);
+            phys_make_entity_static(world, floor);
+        }
+        ac_vec3  position = { { 8.0f, 0.0f, -1.0f } };
+        unsigned ground   = phys_add_entity(world, &position);
+        phys_add_entity_collider(world, Collider{ HEIGHTFIELD_C, &heightfield }, ground);
+        phys_make_entity_static(world, ground);
+
+        for ( int i = 0; i < 3; i++ )
+        {
+            ac_vec3  drop = { { 4.0f * (float) i + 0.3f, 1.0f, 0.2f } };
+            unsigned body = phys_add_entity(world, &drop);
+            phys_add_entity_collider(world, Collider{ SPHERE_C, &ball }, body);
+            phys_make_entity_dynamic(world, body);
+        }
+    };
+
+    auto baked   = std::make_unique<PhysWorld>();
+    auto unbaked = std::make_unique<PhysWorld>();
+    make_scene(baked.get());
+    make_scene(unbaked.get());
+    REQUIRE(phys_bake_static(baked.get()));
+    REQUIRE(baked->numBakedStatics == 3);
+
+    for ( int i = 0; i < 300; i++ )
+    {
+        phys_step(baked.get());
+        phys_step(unbaked.get());
+    }
+    for ( unsigned body = 3; body < 6; body++ )
+    {
+        // each ball comes to rest on the surface below it
+        REQUIRE_THAT(baked->positions[body].y, Catch::Matchers::WithinAbs(0.25f, 0.02f));
+    }
+    REQUIRE(phys_world_hash(baked.get()) == phys_world_hash(unbaked.get()));
+
+    triangle_mesh_free(&mesh);
+}
+
+TEST_CASE( "convex colliders", "[phys_world]" ) {
+    Cylinder cylinder       = { 0.25f, 0.5f };
+    Convex   cylinderConvex = { cylinder_support, &cylinder };
+    AABB     floor          = { { 2.0f, 0.5f, 2.0f } };
+
+    auto make_scene = [&](PhysWorld* world) {
+        phys_init_world(world);
+        ac_vec3  floorPosition = { { 0.0f, -0.5f, 0.0f } };
+        unsigned ground        = phys_add_entity(world, &floorPosition);
+        phys_add_entity_collider(world, Collider{ AABB_C, &floor }, ground);
+        phys_make_entity_static(world, ground);
+
+        ac_vec3  drop = { { 0.3f, 1.0f, -0.2f } };
+        unsigned body = phys_add_entity(world, &drop);
+        phys_add_entity_collider(world, Collider{ CONVEX_C, &cylinderConvex }, body);
+        phys_make_entity_dynamic(world, body);
+    };
+
+    auto baked   = std::make_unique<PhysWorld>();
+    auto unbaked = std::make_unique<PhysWorld>();
+    make_scene(baked.get());
+    make_scene(unbaked.get());
+    REQUIRE(phys_bake_static(baked.get()));
+
+    for ( int i = 0; i < 300; i++ )
+    {
+        phys_step(baked.get());
+        phys_step(unbaked.get());
+    }
+    // the cylinder stands on its base and keeps the warm start of its contact
+    REQUIRE_THAT(baked->positions[1].y, Catch::Matchers::WithinAbs(0.5f, 0.02f));
+    REQUIRE(phys_world_hash(baked.get()) == phys_world_hash(unbaked.get()));
+
+    bool cached = false;
+    for ( const PhysConvexPair& pair : baked->convexPairs )
+    {
+        cached = cached || (pair.entity1 == 1 && pair.entity2 == 0 && pair.cache.count > 0);
+    }
+    REQUIRE(cached);
+}
+
+TEST_CASE( "box contact manifolds", "[phys_world]" ) {
+    AABB  box   = { { 0.5f, 0.5f, 0.5f } };
+    AABB  table = { { 2.0f, 0.5f, 2.0f } };
+    Plane floor = { { 0.0f, 1.0f, 0.0f } };
+
+    auto world = std::make_unique<PhysWorld>();
+    phys_init_world(world.get());
+    ac_vec3  floorPosition = { { 0.0f, 0.0f, 0.0f } };
+    unsigned ground        = phys_add_entity(world.get(), &floorPosition);
+    phys_add_entity_collider(world.get(), Collider{ PLANE_C, &floor }, ground);
+    phys_make_entity_static(world.get(), ground);
+
+    ac_vec3  tablePosition = { { 10.0f, 0.5f, 0.0f } };
+    unsigned desk          = phys_add_entity(world.get(), &tablePosition);
+    phys_add_entity_collider(world.get(), Collider{ AABB_C, &table }, desk);
+    phys_make_entity_static(world.get(), desk);
+
+    ac_vec3  onFloor = { { 0.0f, 1.0f, 0.0f } };
+    ac_vec3  onTable = { { 10.3f, 2.0f, -0.4f } };
+    unsigned boxes[] = { phys_add_entity(world.get(), &onFloor),
+                         phys_add_entity(world.get(), &onTable) };
+    for ( unsigned entity : boxes )
+    {
+        phys_add_entity_collider(world.get(), Collider{ AABB_C, &box }, entity);
+        phys_make_entity_dynamic(world.get(), entity);
+    }
+    REQUIRE_FALSE(phys_bake_static(world.get()));
+
+    for ( int i = 0; i < 240; i++ )
+    {
+        phys_step(world.get());
+    }
+
+    // once settled the boxes stay put rather than bouncing on their contacts
+    ac_vec3 settled[] = { world->positions[boxes[0]], world->positions[boxes[1]] };
+    for ( int i = 0; i < 120; i++ )
+    {
+        phys_step(world.get());
+        REQUIRE_THAT(world->positions[boxes[0]].y, Catch::Matchers::WithinAbs(settled[0].y, 1e-4f));
+        REQUIRE_THAT(world->positions[boxes[1]].y, Catch::Matchers::WithinAbs(settled[1].y, 1e-4f));
+    }
+    REQUIRE_THAT(settled[0].y, Catch::Matchers::WithinAbs(0.5f, 0.01f));
+    REQUIRE_THAT(settled[1].y, Catch::Matchers::WithinAbs(1.5f, 0.01f));
+    REQUIRE_THAT(settled[1].x, Catch::Matchers::WithinAbs(10.3f, 1e-4f));
+
+    unsigned points = 0;
+    for ( const PhysManifoldPair& pair : world->manifolds )
+    {
+        if ( pair.entity1 != AC_PHYS_ERROR_ENT )
+        {
+            points += pair.manifold.numPoints;
+        }
+    }
+    REQUIRE(points == 8);
+}
+
+TEST_CASE( "contact friction", "[phys_world]" ) {
+    auto world = std::make_unique<PhysWorld>();
+    phys_init_world(world.get());
+    world->airResistance = 0.0f;
+    world->friction      = 0.2f;
+
+    static Sphere ball  = { 0.1f };
+    static AABB   floor = { { 5.0f, 0.5f, 5.0f } };
+
+    ac_vec3  floorPosition = { { 0.0f, -0.5f, 0.0f } };
+    unsigned ground        = phys_add_entity(world.get(), &floorPosition);
+    phys_add_entity_collider(world.get(), Collider{ AABB_C, &floor }, ground);
+    phys_make_entity_static(world.get(), ground);
+
+    ac_vec3  start  = { { 0.0f, 0.099f, 0.0f } };
+    unsigned sphere = phys_add_entity(world.get(), &start);
+    phys_add_entity_collider(world.get(), Collider{ SPHERE_C, &ball }, sphere);
+    phys_make_entity_dynamic(world.get(), sphere);
+    world->velocities[sphere] = { { 1.0f, 0.0f, 0.0f } };
+    REQUIRE(world->inverseInertias[sphere].x == 2.5f / (0.1f * 0.1f));
+
+    SECTION( "a sliding ball starts rolling" ) {
+        for ( int i = 0; i < 60; i++ )
+        {
+            phys_step(world.get());
+        }
+
+        // rolling without slipping is v = -w x r, a solid sphere keeps 5/7 of its speed
+        float speed = world->velocities[sphere].x;
+        REQUIRE_THAT(speed, Catch::Matchers::WithinAbs(5.0f / 7.0f, 0.02f));
+        REQUIRE_THAT(world->angularVelocities[sphere].z, Catch::Matchers::WithinAbs(-speed / 0.1f, 0.1f));
+        REQUIRE(world->orientations[sphere].w < 1.0f);
+    }
+
+    SECTION( "rolling friction brings the ball to rest" ) {
+        world->rollingFriction = 0.05f;
+        for ( int i = 0; i < 600; i++ )
+        {
+            phys_step(world.get());
+        }
+        REQUIRE(world->velocities[sphere].x == 0.0f);
+        REQUIRE(world->angularVelocities[sphere].z == 0.0f);
+        REQUIRE(world->positions[sphere].x > 0.1f);
+    }
+
+    SECTION( "without friction the ball slides" ) {
+        world->friction = 0.0f;
+        for ( int i = 0; i < 60; i++ )
+        {
+            phys_step(world.get());
+        }
+        REQUIRE_THAT(world->velocities[sphere].x, Catch::Matchers::WithinAbs(1.0f, 1e-4f));
+        REQUIRE(world->angularVelocities[sphere].z == 0.0f);
+    }
+}
+
+TEST_CASE( "forces and impulses", "[phys_world]" ) {
+    auto world = std::make_unique<PhysWorld>();
+    phys_init_world(world.get());
+    world->timeStep           = 0.1f;
+    world->gravity            = { { 0.0f, 0.0f, 0.0f } };
+    world->airResistance      = 0.0f;
+    world->velocityThreshhold = 0.0f;
+
+    static Sphere ball = { 0.5f };
+
+    ac_vec3  start  = { { 0.0f, 0.0f, 0.0f } };
+    unsigned bodies[2];
+    for ( unsigned& body : bodies )
+    {
+        body = phys_add_entity(world.get(), &start);
+        phys_add_entity_collider(world.get(), Collider{ SPHERE_C, &ball }, body);
+        phys_make_entity_dynamic(world.get(), body);
+        start.x += 5.0f;
+    }
+    world->masses[bodies[0]] = 2.0f;
+    unsigned wall            = phys_add_entity(world.get(), &start);
+    phys_add_entity_collider(world.get(), Collider{ SPHERE_C, &ball }, wall);
+    phys_make_entity_static(world.get(), wall);
+
+    SECTION( "forces are integrated for one step" ) {
+        ac_vec3 force = { { 4.0f, 0.0f, 0.0f } };
+        phys_apply_force(world.get(), bodies[0], &force);
+        phys_apply_force(world.get(), bodies[0], &force);
+        phys_step(world.get());
+        REQUIRE_THAT(world->velocities[bodies[0]].x, Catch::Matchers::WithinAbs(0.4f, 1e-6f));
+        REQUIRE(world->forces[bodies[0]].x == 0.0f);
+
+        phys_step(world.get());
+        REQUIRE_THAT(world->velocities[bodies[0]].x, Catch::Matchers::WithinAbs(0.4f, 1e-6f));
+    }
+
+    SECTION( "impulses change the velocity immediately and wake the entity" ) {
+        phys_sleep_entity(world.get(), bodies[0], true);
+        ac_vec3 impulse = { { 0.0f, 3.0f, 0.0f } };
+        phys_apply_impulse(world.get(), bodies[0], &impulse);
+        REQUIRE(world->velocities[bodies[0]].y == 1.5f);
+        REQUIRE_FALSE(world->sleeping[bodies[0]]);
+    }
+
+    SECTION( "off centre pushes spin the entity" ) {
+        // a solid sphere of mass 1 and radius 0.5 has an inertia of 0.1
+        ac_vec3 impulse = { { 1.0f, 0.0f, 0.0f } };
+        ac_vec3 top     = { { 5.0f, 0.5f, 0.0f } };
+        phys_apply_impulse_at_point(world.get(), bodies[1], &impulse, &top);
+        REQUIRE(world->velocities[bodies[1]].x == 1.0f);
+        REQUIRE_THAT(world->angularVelocities[bodies[1]].z, Catch::Matchers::WithinAbs(-5.0f, 1e-5f));
+
+        ac_vec3 force = { { 0.0f, 0.0f, 1.0f } };
+        phys_apply_force_at_point(world.get(), bodies[1], &force, &top);
+        phys_step(world.get());
+        REQUIRE_THAT(world->angularVelocities[bodies[1]].x, Catch::Matchers::WithinAbs(0.5f, 1e-5f));
+        REQUIRE(world->torques[bodies[1]].x == 0.0f);
+    }
+
+    SECTION( "batches" ) {
+        ac_vec3 pushes[] = { { { 2.0f, 0.0f, 0.0f } }, { { 0.0f, 0.0f, 1.0f } } };
+        phys_apply_impulses(world.get(), bodies, pushes, 2);
+        REQUIRE(world->velocities[bodies[0]].x == 1.0f);
+        REQUIRE(world->velocities[bodies[1]].z == 1.0f);
+
+        phys_apply_forces(world.get(), bodies, pushes, 2);
+        REQUIRE(world->forces[bodies[0]].x == 2.0f);
+        REQUIRE(world->forces[bodies[1]].z == 1.0f);
+    }
+
+    SECTION( "static entities are unaffected" ) {
+        ac_vec3 push = { { 1.0f, 0.0f, 0.0f } };
+        phys_apply_impulse(world.get(), wall, &push);
+        phys_apply_force(world.get(), wall, &push);
+        REQUIRE(world->velocities[wall].x == 0.0f);
+        REQUIRE(world->forces[wall].x == 0.0f);
+    }
+}
+
+TEST_CASE( "phys_bake_static benchmark", "[.][benchmark][phys_world]" ) {
+    // statics outnumber dynamics four to one, real levels are closer to 20:1
+    auto baked   = std::make_unique<PhysWorld>();
+    auto unbaked = std::make_unique<PhysWorld>();
+    make_bake_scene(baked.get());
+    make_bake_scene(unbaked.get());
+    phys_bake_static(baked.get());
+
+    BENCHMARK( "phys_step unbaked" )
+    {
+        phys_step(unbaked.get());
+    };
+    BENCHMARK( "phys_step baked" )
+    {
+        phys_step(baked.get());
+    };
+}
+
+TEST_CASE( "phys_init_world benchmark", "[.][benchmark][phys_world]" ) {
+    auto world = std::make_unique<PhysWorld>();
+
+    BENCHMARK( "phys_init_world" )
+    {
+        phys_init_world(world.get());
+        return world->numEnts;
+    };
+}
+
+// the integrator is internal to the world, it is declared here to time it on its own
+extern "C" void update_movements(PhysWorld* world);
+
+TEST_CASE( "update_movements benchmark", "[.][benchmark][phys_world]" ) {
+    // run from builds with and without the AC_MATH_INLINE option to compare the two
+#ifdef AC_MATH_INLINE
+    const char* name = "update_movements inline math";
+#else
+    const char* name = "update_movements out of line math";
+#endif
+
+    auto world = std::make_unique<PhysWorld>();
+    phys_init_world(world.get());
+    world->velocityThreshhold = 0.0f;
+    for ( unsigned i = 0; i < AC_MAX_PHYS_ENTS; i++ )
+    {
+        ac_vec3  position = { { (float) i, 0.0f, 0.0f } };
+        unsigned entity   = phys_add_entity(world.get(), &position);
+        phys_make_entity_dynamic(world.get(), entity);
+        world->velocities[entity]        = { { 1.0f, 2.0f, (float) (i % 7) } };
+        world->angularVelocities[entity] = { { 0.0f, (float) (i % 2), 0.0f } };
+    }
+
+    BENCHMARK( name )
+    {
+        update_movements(world.get());
+    };
+}